@@ -9,13 +9,77 @@
 
 #ifdef BT_PLATFORM_WINDOWS
 #include "Berta/Platform/Windows/D2D.h"
+#else
+#include "Berta/Paint/DefaultFont.h"
 #endif
 
 namespace Berta
 {
+	namespace
+	{
+#ifdef BT_PLATFORM_WINDOWS
+		bool MeasureTextLayout(PaintNativeHandle* handle, const std::wstring& wstr, size_t length, DWRITE_TEXT_METRICS& metrics)
+		{
+			IDWriteTextLayout* textLayout = nullptr;
+
+			HRESULT hr = DirectX::D2DModule::GetInstance().GetWriteFactory()->CreateTextLayout
+			(
+				wstr.c_str(),
+				static_cast<UINT32>(length),
+				handle->m_textFormat,
+				FLT_MAX, FLT_MAX,
+				&textLayout
+			);
+
+			if (FAILED(hr))
+			{
+				return false;
+			}
+
+			textLayout->GetMetrics(&metrics);
+			textLayout->Release();
+			return true;
+		}
+#endif
+
+		Size MeasureText(PaintNativeHandle* handle, const std::wstring& wstr, size_t length)
+		{
+#ifdef BT_PLATFORM_WINDOWS
+			DWRITE_TEXT_METRICS metrics = {};
+			if (MeasureTextLayout(handle, wstr, length, metrics))
+			{
+				return { static_cast<uint32_t>(std::ceilf(metrics.width)), static_cast<uint32_t>(std::ceilf(metrics.height)) };
+			}
+
+			return {};
+#else
+			return DefaultFont::Measure(wstr, length, handle->m_fontSize);
+#endif
+		}
+
+		bool MeasureLayoutExtent(PaintNativeHandle* handle, const std::wstring& wstr, TextExtentCache::LayoutExtent& extent)
+		{
+#ifdef BT_PLATFORM_WINDOWS
+			DWRITE_TEXT_METRICS metrics = {};
+			if (!MeasureTextLayout(handle, wstr, wstr.size(), metrics))
+			{
+				return false;
+			}
+
+			extent.Width = metrics.width;
+			extent.Height = static_cast<uint32_t>(std::ceilf(metrics.height));
+#else
+			extent.Width = DefaultFont::MeasureWidth(wstr, wstr.size(), handle->m_fontSize);
+			extent.Height = DefaultFont::GetLineHeight(handle->m_fontSize);
+#endif
+			return true;
+		}
+	}
+
 	PaintNativeHandle::~PaintNativeHandle()
 	{
 #ifdef BT_PLATFORM_WINDOWS
+		m_brushes.Clear();
 
 		if (m_bitmapRT)
 		{
@@ -40,7 +104,7 @@ namespace Berta
 		//return Size(static_cast<uint32_t>(bmp.bmWidth), static_cast<uint32_t>(bmp.bmHeight));
 		return {};
 #else
-		return {};
+		return handle ? handle->m_size : Size{};
 #endif
 	}
 
@@ -56,31 +120,59 @@ namespace Berta
 
 	Size API::GetTextExtentSize(PaintNativeHandle* handle, const std::wstring& wstr, size_t length)
 	{
+		if (!handle)
+		{
+			return {};
+		}
+
+		if (handle->m_textExtents)
+		{
+			return handle->m_textExtents->Measure(wstr, length, [handle](const std::wstring& text, size_t textLength)
+			{
+				return MeasureText(handle, text, textLength);
+			});
+		}
+
+		return MeasureText(handle, wstr, length);
+	}
+
+	void API::BindTextExtentCache(PaintNativeHandle* handle, const TextExtentCache::FontKey& fontKey)
+	{
+		auto& textExtents = TextExtentCache::Get(fontKey);
+		handle->m_textExtents = &textExtents;
+		if (textExtents.IsAsciiResolved())
+		{
+			return;
+		}
+
+		TextExtentCache::AsciiAdvances asciiAdvances;
 #ifdef BT_PLATFORM_WINDOWS
-		IDWriteTextLayout* textLayout = nullptr;
-		
-		HRESULT hr = DirectX::D2DModule::GetInstance().GetWriteFactory()->CreateTextLayout
-		(
-			wstr.c_str(), 
-			static_cast<UINT32>(length),
-			handle->m_textFormat,
-			FLT_MAX, FLT_MAX,
-			&textLayout
-		);
-
-		if (SUCCEEDED(hr))
+		// Natural advances, DWRITE_TEXT_METRICS::width leaves out trailing spaces.
+		asciiAdvances.ExcludesTrailingWhitespace = true;
+		for (wchar_t character = TextExtentCache::FirstAscii; character <= TextExtentCache::LastAscii; ++character)
 		{
 			DWRITE_TEXT_METRICS metrics = {};
-			textLayout->GetMetrics(&metrics);
+			if (!MeasureTextLayout(handle, std::wstring(1, character), 1, metrics))
+			{
+				return;
+			}
 
-			textLayout->Release();
-			return { static_cast<uint32_t>(std::ceilf(metrics.width)), static_cast<uint32_t>(std::ceilf(metrics.height)) };
+			asciiAdvances.Advances[character - TextExtentCache::FirstAscii] = metrics.widthIncludingTrailingWhitespace;
+			asciiAdvances.LineHeight = (std::max)(asciiAdvances.LineHeight, static_cast<uint32_t>(std::ceilf(metrics.height)));
 		}
-
-		return {};
 #else
-		return {};
+		for (wchar_t character = TextExtentCache::FirstAscii; character <= TextExtentCache::LastAscii; ++character)
+		{
+			asciiAdvances.Advances[character - TextExtentCache::FirstAscii] = DefaultFont::GetGlyph(character)->Advance / 64.0f;
+		}
+
+		asciiAdvances.Scale = static_cast<double>(handle->m_fontSize) / DefaultFont::PixelSize;
+		asciiAdvances.LineHeight = DefaultFont::GetLineHeight(handle->m_fontSize);
 #endif
+		textExtents.SetAsciiAdvances(asciiAdvances, [handle](const std::wstring& text, TextExtentCache::LayoutExtent& extent)
+		{
+			return MeasureLayoutExtent(handle, text, extent);
+		});
 	}
 
 	void API::Dispose(RootPaintNativeHandle& rootHandle)
@@ -92,6 +184,7 @@ namespace Berta
 			rootHandle.RenderTarget = nullptr;
 		}
 #else
+		rootHandle.Target = nullptr;
 #endif
 	}
 }
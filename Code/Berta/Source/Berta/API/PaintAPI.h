@@ -8,19 +8,38 @@
 #define BT_PAINT_API_HEADER
 
 #include <string>
+#include <vector>
 #include "Berta/Core/Base.h"
 #include "Berta/Core/BasicTypes.h"
+#include "Berta/Paint/TextExtentCache.h"
+
+#ifdef BT_PLATFORM_WINDOWS
+#include "Berta/Platform/Windows/D2DResourceCache.h"
+#endif
 
 namespace Berta
 {
+#ifndef BT_PLATFORM_WINDOWS
+	struct VirtualWindow;
+#endif
+
 	struct PaintNativeHandle
 	{
 #ifdef BT_PLATFORM_WINDOWS
 		ID2D1BitmapRenderTarget* m_bitmapRT{ nullptr };
 		IDWriteTextFormat* m_textFormat{ nullptr };
 		Size m_textExtent;
+		DirectX::BrushCache m_brushes;		// Of m_bitmapRT.
 #else
+		// Software backend, see Rasterizer.
+		std::vector<uint32_t> m_pixels;		// BGRA8, premultiplied alpha, m_size.Width pixels per row.
+		std::vector<Rectangle> m_clips;		// Effective clip of each PushClip (already intersected).
+		Size m_size;
+		Size m_textExtent;
+		uint32_t m_fontSize{ 12 };			// Pixels, scaled with the DPI in Graphics::BuildFont.
+		bool m_aliased{ false };
 #endif
+		TextExtentCache* m_textExtents{ nullptr };	// Of the current font and DPI, see API::BindTextExtentCache.
 
 		PaintNativeHandle() = default;
 		~PaintNativeHandle();
@@ -53,17 +72,20 @@ namespace Berta
 #else
 			operator bool() const
 			{
-				return false;
+				return Target != nullptr;
 			}
+
 			bool operator==(const RootPaintNativeHandle& other) const
 			{
-				return false;
+				return Target == other.Target;
 			}
 
 			bool operator!=(const RootPaintNativeHandle& other) const
 			{
-				return false;
+				return Target != other.Target;
 			}
+
+			VirtualWindow* Target{ nullptr };	// Presented by Graphics::Paste, see VirtualDisplay.
 #endif
 
 		};
@@ -72,6 +94,8 @@ namespace Berta
 		Size GetTextExtentSize(PaintNativeHandle* handle, const std::string& wstr);
 		Size GetTextExtentSize(PaintNativeHandle* handle, const std::wstring& wstr);
 		Size GetTextExtentSize(PaintNativeHandle* handle, const std::wstring& wstr, size_t length);
+		// Call after (re)building the font of the handle, measurements go through the cache afterwards.
+		void BindTextExtentCache(PaintNativeHandle* handle, const TextExtentCache::FontKey& fontKey);
 
 		void Dispose(RootPaintNativeHandle& rootHandle);
 	}
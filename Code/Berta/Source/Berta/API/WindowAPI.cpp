@@ -7,6 +7,10 @@
 #include "btpch.h"
 #include "WindowAPI.h"
 
+#ifndef BT_PLATFORM_WINDOWS
+#include "Berta/Platform/Headless/VirtualDisplay.h"
+#endif
+
 namespace Berta
 {
 #ifdef BT_PLATFORM_WINDOWS
@@ -29,8 +33,8 @@ namespace Berta
 					static_cast<LONG>((rectangle.Y + rectangle.Height) * scalingFactor)
 				};
 			}
-		}
 #endif
+		}
 
 		NativeWindowResult CreateNativeWindow(NativeWindowHandle parentHandle, const Rectangle& rectangle, const FormStyle& formStyle, bool isNested)
 		{
@@ -138,7 +142,17 @@ namespace Berta
 				GetNativeWindowDPI(parentHandle)
 			};
 #else
-			return {};
+			auto& display = VirtualDisplay::GetInstance();
+			auto window = display.Create(parentHandle.Handle, rectangle, formStyle, isNested);
+			display.SetCaption(window, L"Berta Window");
+
+			return NativeWindowResult
+			{
+				{ window },
+				window->ClientSize,
+				{ 0u, 0u },	// No non client area.
+				window->DPI
+			};
 #endif
 		}
 
@@ -147,6 +161,7 @@ namespace Berta
 #ifdef BT_PLATFORM_WINDOWS
 			::SetWindowText(nativeHandle.Handle, caption.c_str());
 #else
+			VirtualDisplay::GetInstance().SetCaption(nativeHandle.Handle, caption);
 #endif
 		}
 
@@ -163,6 +178,7 @@ namespace Berta
 				return result;
 			}
 #else
+			return nativeHandle.Handle->Caption;
 #endif
 			return {};
 		}
@@ -175,6 +191,12 @@ namespace Berta
 				BT_CORE_ERROR << "DestroyWindow Failed. GetLastError() = " << ::GetLastError() <<  std::endl;
 			}
 #else
+			if (!VirtualDisplay::GetInstance().Exists(nativeHandle.Handle))
+			{
+				BT_CORE_ERROR << "DestroyNativeWindow Failed. Unknown window." << std::endl;
+				return;
+			}
+			VirtualDisplay::GetInstance().Destroy(nativeHandle.Handle);
 #endif
 		}
 
@@ -183,6 +205,7 @@ namespace Berta
 #ifdef BT_PLATFORM_WINDOWS
 			::ShowWindow(nativeHandle.Handle, visible ? (active ? SW_SHOW : SW_SHOWNA) : SW_HIDE);
 #else
+			VirtualDisplay::GetInstance().Show(nativeHandle.Handle, visible);
 #endif
 		}
 
@@ -192,6 +215,12 @@ namespace Berta
 			RECT rect;
 			::GetClientRect(nativeHandle.Handle, &rect);
 			::InvalidateRect(nativeHandle.Handle, &rect, FALSE);
+#else
+			NativeEvent paintEvent;
+			paintEvent.EventType = NativeEvent::Type::Paint;
+			paintEvent.Target = nativeHandle;
+			paintEvent.Area = nativeHandle.Handle->ClientSize.ToRectangle();
+			VirtualDisplay::GetInstance().Post(std::move(paintEvent));
 #endif
 		}
 
@@ -206,6 +235,8 @@ namespace Berta
 			{
 				BT_CORE_ERROR << "ReleaseCapture ::GetLastError() = " << ::GetLastError() << std::endl;
 			}
+#else
+			VirtualDisplay::GetInstance().Capture(nativeHandle.Handle, capture);
 #endif
 		}
 
@@ -218,7 +249,11 @@ namespace Berta
 			}
 			return ::GetDpiForWindow(nativeHandle.Handle);
 #else
-			return 96u;
+			if (nativeHandle.Handle == nullptr)
+			{
+				return VirtualDisplay::GetInstance().GetDpi();
+			}
+			return nativeHandle.Handle->DPI;
 #endif
 		}
 
@@ -227,6 +262,7 @@ namespace Berta
 #ifdef BT_PLATFORM_WINDOWS
 			::EnableWindow(nativeHandle.Handle, isEnabled);
 #else
+			nativeHandle.Handle->Enabled = isEnabled;
 #endif
 		}
 
@@ -235,7 +271,7 @@ namespace Berta
 #ifdef BT_PLATFORM_WINDOWS
 			return { ::GetAncestor(nativeHandle.Handle, GA_PARENT) };
 #else
-			return {};
+			return { nativeHandle.Handle->Parent };
 #endif
 		}
 
@@ -244,7 +280,7 @@ namespace Berta
 #ifdef BT_PLATFORM_WINDOWS
 			return { ::GetWindow(nativeHandle.Handle, GW_OWNER) };
 #else
-			return {};
+			return { nativeHandle.Handle->Owner };
 #endif
 		}
 
@@ -254,6 +290,8 @@ namespace Berta
 			::SetParent(nativeHandle.Handle, parentNativeHandle.Handle);
 
 			::SetWindowPos(nativeHandle.Handle, NULL, 0, 0, 0, 0, SWP_NOSIZE | SWP_NOMOVE | SWP_NOZORDER | SWP_FRAMECHANGED);
+#else
+			VirtualDisplay::GetInstance().SetParent(nativeHandle.Handle, parentNativeHandle.Handle);
 #endif
 		}
 
@@ -280,6 +318,14 @@ namespace Berta
 			auto borderHeight = (windowAreaRECT.bottom - windowAreaRECT.top) - clientRECT.bottom;
 
 			::MoveWindow(nativeHandle.Handle, x, y, newArea.Width + borderWidth, newArea.Height + borderHeight, forceRepaint);
+#else
+			auto& display = VirtualDisplay::GetInstance();
+			Point position{ newArea.X, newArea.Y };
+			if (auto owner = nativeHandle.Handle->Owner)
+			{
+				position += display.GetScreenPosition(owner);
+			}
+			display.Move(nativeHandle.Handle, position, { newArea.Width, newArea.Height });
 #endif
 		}
 
@@ -302,6 +348,14 @@ namespace Berta
 			}
 
 			::MoveWindow(nativeHandle.Handle, adjustedPosition.X, adjustedPosition.Y, nativeRECT.right - nativeRECT.left, nativeRECT.bottom - nativeRECT.top, forceRepaint);
+#else
+			auto& display = VirtualDisplay::GetInstance();
+			auto position = newPosition;
+			if (auto owner = nativeHandle.Handle->Owner)
+			{
+				position += display.GetScreenPosition(owner);
+			}
+			display.Move(nativeHandle.Handle, position, nativeHandle.Handle->ClientSize);
 #endif
 		}
 
@@ -312,7 +366,7 @@ namespace Berta
 			::GetWindowRect(nativeHandle.Handle, &nativeRECT);
 			::MoveWindow(nativeHandle.Handle, nativeRECT.left, nativeRECT.top, static_cast<int>(newSize.Width), static_cast<int>(newSize.Height), true);
 #else
-
+			VirtualDisplay::GetInstance().Move(nativeHandle.Handle, nativeHandle.Handle->Position, newSize);
 #endif
 		}
 
@@ -336,7 +390,13 @@ namespace Berta
 			}
 			return { nativeRECT.left, nativeRECT.top };
 #else
-			return {};
+			auto window = nativeHandle.Handle;
+			if (window->Owner)
+			{
+				auto& display = VirtualDisplay::GetInstance();
+				return display.GetScreenPosition(window) - display.GetScreenPosition(window->Owner);
+			}
+			return window->Position;
 #endif
 		}
 
@@ -374,6 +434,8 @@ namespace Berta
 			{
 				::SetClassLongPtr(nativeHandle.Handle, GCLP_HCURSOR, reinterpret_cast<LONG_PTR>(nativeCursor.Handle));
 			}
+#else
+			VirtualDisplay::GetInstance().SetCursor(nativeHandle.Handle, newCursor);
 #endif
 			return true;
 		}
@@ -386,7 +448,7 @@ namespace Berta
 				static_cast<uint32_t>(::GetSystemMetrics(SM_CYSCREEN))
 			};
 #else
-			return {};
+			return VirtualDisplay::GetInstance().GetScreenSize();
 #endif
 		}
 
@@ -400,7 +462,7 @@ namespace Berta
 			}
 			return {};
 #else
-			return {};
+			return point + VirtualDisplay::GetInstance().GetScreenPosition(nativeHandle.Handle);
 #endif
 		}
 
@@ -415,7 +477,7 @@ namespace Berta
 
 			return point;
 #else
-			return {};
+			return point - VirtualDisplay::GetInstance().GetScreenPosition(nativeHandle.Handle);
 #endif
 		}
 
@@ -426,6 +488,12 @@ namespace Berta
 			param->Body = body;
 
 			::PostMessage(nativeHandle.Handle, static_cast<UINT>(CustomMessageId::CustomCallback), reinterpret_cast<WPARAM>(param), 0);
+#else
+			NativeEvent callbackEvent;
+			callbackEvent.EventType = NativeEvent::Type::Callback;
+			callbackEvent.Target = nativeHandle;
+			callbackEvent.Callback = std::move(body);
+			VirtualDisplay::GetInstance().Post(std::move(callbackEvent));
 #endif
 		}
 
@@ -439,6 +507,13 @@ namespace Berta
 			rect.bottom = newArea.Y + newArea.Height;
 
 			::SendMessage(nativeHandle.Handle, WM_DPICHANGED, MAKELPARAM(oldDpi, newDpi), reinterpret_cast<LPARAM>(&rect));
+#else
+			NativeEvent dpiEvent;
+			dpiEvent.EventType = NativeEvent::Type::DpiChanged;
+			dpiEvent.Target = nativeHandle;
+			dpiEvent.Dpi = newDpi;
+			dpiEvent.Area = newArea;
+			VirtualDisplay::GetInstance().Send(std::move(dpiEvent));
 #endif
 		}
 
@@ -450,7 +525,7 @@ namespace Berta
 
 			return Point(nativePoint.x, nativePoint.y);
 #else
-			return {};
+			return VirtualDisplay::GetInstance().GetMousePosition();
 #endif
 		}
 	}
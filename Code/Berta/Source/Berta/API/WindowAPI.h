@@ -7,14 +7,21 @@
 #ifndef BT_WINDOW_API_HEADER
 #define BT_WINDOW_API_HEADER
 
+#include <functional>
 #include <string>
 #include "Berta/Core/Base.h"
 #include "Berta/Core/BasicTypes.h"
 
+#ifdef BT_PLATFORM_WINDOWS
 #include "Berta/Platform/Windows/Messages.h"
+#endif
 
 namespace Berta
 {
+#ifndef BT_PLATFORM_WINDOWS
+	struct VirtualWindow;
+#endif
+
 	namespace API
 	{
 		struct NativeWindowHandle
@@ -39,22 +46,26 @@ namespace Berta
 
 			operator bool () const { return Handle != nullptr; }
 #else
+			VirtualWindow* Handle{ nullptr };	// Platform/Headless/VirtualDisplay.h
+
+			NativeWindowHandle(VirtualWindow* handle) : Handle(handle) {}
+
 			constexpr bool operator<(const NativeWindowHandle& other) const
 			{
-				return false;
-		}
+				return Handle < other.Handle;
+			}
 
 			constexpr bool operator==(const NativeWindowHandle& other) const
 			{
-				return false;
+				return Handle == other.Handle;
 			}
 
 			constexpr bool operator!=(const NativeWindowHandle& other) const
 			{
-				return false;
+				return Handle != other.Handle;
 			}
 
-			operator bool() const { return false; }
+			operator bool() const { return Handle != nullptr; }
 #endif
 			NativeWindowHandle() = default;
 			NativeWindowHandle(const NativeWindowHandle&) = default;
@@ -74,6 +85,8 @@ namespace Berta
 #ifdef BT_PLATFORM_WINDOWS
 			HCURSOR Handle{ nullptr };
 			Cursor CursorType{ Cursor::Default };
+#else
+			Cursor CursorType{ Cursor::Default };
 #endif
 		};
 
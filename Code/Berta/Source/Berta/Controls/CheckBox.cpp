@@ -16,7 +16,6 @@ namespace Berta
 		m_control = &control;
 
 		m_module.m_window = m_control->Handle();
-		m_module.m_events = reinterpret_cast<CheckBoxEvents*>(m_control->Handle()->Events.get());
 	}
 
 	void CheckBoxReactor::Update(Graphics& graphics)
@@ -98,7 +97,10 @@ namespace Berta
 	void CheckBoxReactor::Module::EmitCheckedChangedEvent()
 	{
 		ArgCheckBox argCheckBox{ m_isChecked };
-		m_events->CheckedChanged.Emit(argCheckBox);
+		if (auto events = reinterpret_cast<CheckBoxEvents*>(m_window->Events.get()))
+		{
+			events->CheckedChanged.Emit(argCheckBox);
+		}
 	}
 
 	CheckBox::CheckBox(Window* parent, const Rectangle& rectangle)
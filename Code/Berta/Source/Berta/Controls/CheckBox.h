@@ -21,6 +21,12 @@ namespace Berta
 	struct CheckBoxEvents : public ControlEvents
 	{
 		Event<ArgCheckBox> CheckedChanged;
+
+		void DisconnectAll(EventOwner owner) override
+		{
+			ControlEvents::DisconnectAll(owner);
+			CheckedChanged.DisconnectAll(owner);
+		}
 	};
 
 	class CheckBoxReactor : public ControlReactor
@@ -40,7 +46,6 @@ namespace Berta
 
 			bool m_isChecked{ false };
 			Window* m_window{ nullptr };
-			CheckBoxEvents* m_events{ nullptr };
 		};
 
 		Module& GetModule() { return m_module; }
@@ -38,7 +38,7 @@ namespace Berta
 		m_module.m_textEditor = new TextEditor(*m_control);
 
 		auto window = m_control->Handle();
-		window->Events->Focus.Connect([&](const ArgFocus& args)
+		window->GetEvents().Focus.Connect([&](const ArgFocus& args)
 		{
 			if (!args.Focused && m_module.m_floatBox)
 			{
@@ -162,17 +162,17 @@ namespace Berta
 		{
 			if (args.Key == KeyboardKey::ArrowUp)
 			{
-				if (m_module.m_floatBox->MoveSelectedItem(-1))
+				for (uint32_t i = 0; i < args.RepeatCount; ++i)
 				{
-					redraw = true;
+					redraw = m_module.m_floatBox->MoveSelectedItem(-1) || redraw;
 				}
 			}
 
 			if (args.Key == KeyboardKey::ArrowDown)
 			{
-				if (m_module.m_floatBox->MoveSelectedItem(1))
+				for (uint32_t i = 0; i < args.RepeatCount; ++i)
 				{
-					redraw = true;
+					redraw = m_module.m_floatBox->MoveSelectedItem(1) || redraw;
 				}
 			}
 			if (args.Key == KeyboardKey::Enter)
@@ -191,7 +191,7 @@ namespace Berta
 		{
 			if (args.Key == KeyboardKey::ArrowUp)
 			{
-				int newIndex = (std::max)(0, (std::min)(m_module.Data.m_selectedIndex - 1, (int)(m_module.Data.m_items.size()) - 1));
+				int newIndex = (std::max)(0, (std::min)(m_module.Data.m_selectedIndex - static_cast<int>(args.RepeatCount), (int)(m_module.Data.m_items.size()) - 1));
 				if (m_module.Data.m_selectedIndex != newIndex && !m_module.Data.m_items.empty()) {
 					m_module.Data.m_selectedIndex = newIndex;
 					m_module.m_text = m_module.Data.m_items[newIndex].m_text;
@@ -201,7 +201,7 @@ namespace Berta
 			}
 			if (args.Key == KeyboardKey::ArrowDown)
 			{
-				int newIndex = (std::max)(0, (std::min)(m_module.Data.m_selectedIndex + 1, (int)(m_module.Data.m_items.size()) - 1));
+				int newIndex = (std::max)(0, (std::min)(m_module.Data.m_selectedIndex + static_cast<int>(args.RepeatCount), (int)(m_module.Data.m_items.size()) - 1));
 				if (m_module.Data.m_selectedIndex != newIndex && !m_module.Data.m_items.empty()) {
 					m_module.Data.m_selectedIndex = newIndex;
 					m_module.m_text = m_module.Data.m_items[newIndex].m_text;
@@ -298,8 +298,10 @@ namespace Berta
 		ArgComboBox argComboBox{};
 		argComboBox.SelectedIndex = index;
 
-		auto events = dynamic_cast<ComboboxEvents*>(m_owner->Events.get());
-		events->Selected.Emit(argComboBox);
+		if (auto events = dynamic_cast<ComboboxEvents*>(m_owner->Events.get()))
+		{
+			events->Selected.Emit(argComboBox);
+		}
 	}
 
 	ComboBox::ComboBox(Window* parent, const Rectangle& rectangle)
@@ -33,6 +33,12 @@ namespace Berta
 	struct ComboboxEvents : public ControlEvents
 	{
 		Event<ArgComboBox>	Selected;
+
+		void DisconnectAll(EventOwner owner) override
+		{
+			ControlEvents::DisconnectAll(owner);
+			Selected.DisconnectAll(owner);
+		}
 	};
 
 	class ComboBoxReactor : public ControlReactor
@@ -129,7 +129,7 @@ namespace Berta
 			return;
 		}
 
-		int direction = args.WheelDelta > 0 ? -1 : 1;
+		int direction = (args.WheelDelta > 0 ? -1 : 1) * args.GetNotches();
 		int newOffset = std::clamp(m_state.m_offset + direction, (int)m_scrollBar->GetMin(), (int)m_scrollBar->GetMax());
 
 		if (newOffset != m_state.m_offset)
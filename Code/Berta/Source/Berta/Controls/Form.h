@@ -7,7 +7,9 @@
 #ifndef BT_FORM_HEADER
 #define BT_FORM_HEADER
 
+#ifdef BT_PLATFORM_WINDOWS
 #include <Windows.h>
+#endif
 #include <string>
 
 #include "Berta/EntryPoint.h"
@@ -31,7 +31,10 @@ namespace Berta
 		{
 			ArgTextChanged args;
 			args.NewValue = m_textEditor->GetContent();
-			reinterpret_cast<InputTextEvents*>(m_control->Handle()->Events.get())->ValueChanged.Emit(args);
+			if (auto events = reinterpret_cast<InputTextEvents*>(m_control->Handle()->Events.get()))
+			{
+				events->ValueChanged.Emit(args);
+			}
 		});
 	}
 
@@ -96,7 +99,13 @@ namespace Berta
 
 	void InputTextReactor::KeyPressed(Graphics& graphics, const ArgKeyboard& args)
 	{
-		bool redraw = m_textEditor->OnKeyPressed(args);
+		// Key auto-repeats may arrive folded into one event (see InputQueue), each one edits the text.
+		bool redraw = false;
+		for (uint32_t i = 0; i < args.RepeatCount; ++i)
+		{
+			redraw = m_textEditor->OnKeyPressed(args) || redraw;
+		}
+
 		if (redraw)
 		{
 			auto window = m_control->Handle();
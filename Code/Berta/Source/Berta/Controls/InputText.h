@@ -24,6 +24,12 @@ namespace Berta
 	struct InputTextEvents : public ControlEvents
 	{
 		Event<ArgTextChanged> ValueChanged;
+
+		void DisconnectAll(EventOwner owner) override
+		{
+			ControlEvents::DisconnectAll(owner);
+			ValueChanged.DisconnectAll(owner);
+		}
 	};
 
 	class InputTextReactor : public ControlReactor
@@ -33,6 +39,7 @@ namespace Berta
 
 		void Init(ControlBase& control) override;
 		void Update(Graphics& graphics) override;
+		bool IsOpaque() const override { return true; }
 		
 		void MouseEnter(Graphics& graphics, const ArgMouse& args) override;
 		void MouseLeave(Graphics& graphics, const ArgMouse& args) override;
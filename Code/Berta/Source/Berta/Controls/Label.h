@@ -17,6 +17,7 @@ namespace Berta
 	{
 	public:
 		void Update(Graphics& graphics) override;
+		bool IsOpaque() const override { return true; }
 
 	private:
 	};
@@ -25,14 +25,22 @@ namespace Berta
 		m_module.CalculateVisibleIndices();
 	}
 
-	void ListBoxReactor::Update(Graphics& graphics)
+	void ListBoxReactor::Shutdown()
+	{
+		m_module.CancelHeaderAutoSizing();
+	}
+
+	void ListBoxReactor::Update(Graphics& graphics, const Rectangle& damage)
 	{
 		//BT_CORE_TRACE << " -- Listbox Update() " << std::endl;
 		auto enabled = m_control->GetEnabled();
-		graphics.DrawRectangle(m_module.m_window->ClientSize.ToRectangle(), m_module.m_window->Appearance->BoxBackground, true);
+		graphics.DrawRectangle(damage, m_module.m_window->Appearance->BoxBackground, true);
 
-		m_module.DrawList(graphics);
-		m_module.DrawHeaders(graphics);
+		m_module.DrawList(graphics, damage);
+		if (damage.Y < (int)m_module.m_viewport.m_backgroundRect.Y)
+		{
+			m_module.DrawHeaders(graphics);
+		}
 
 		if (m_module.m_mouseSelection.m_started && m_module.m_mouseSelection.m_startPosition != m_module.m_mouseSelection.m_endPosition)
 		{
@@ -67,48 +75,9 @@ namespace Berta
 			return;
 		}
 
+		// Measuring every cell of a big list takes a while, don't do it inside the input handler.
 		auto selectedHeader = m_module.m_headers.m_sorted[m_module.m_headers.m_selectedIndex];
-		auto maxCellWidth = 0u;
-		for (size_t i = 0; i < m_module.m_list.m_items.size(); i++)
-		{
-			const auto& cell = m_module.m_list.m_items[i].m_cells[selectedHeader];
-			auto cellWidth = graphics.GetTextExtent(cell.m_text).Width;
-			if (cellWidth > maxCellWidth)
-			{
-				maxCellWidth = cellWidth;
-			}
-		}
-		maxCellWidth = m_module.m_window->ToDownwardScale(maxCellWidth);
-		auto leftMarginTextHeader = 5u;
-		maxCellWidth += leftMarginTextHeader * 2u;
-
-		auto newWidth = (std::max)(maxCellWidth, LISTBOX_MIN_HEADER_WIDTH);
-		bool needUpdate = newWidth != m_module.m_headers.m_items[selectedHeader].m_bounds.Width;
-		if (!needUpdate)
-			return;
-
-		m_module.m_headers.m_items[selectedHeader].m_bounds.Width = newWidth;
-		m_module.CalculateViewport(m_module.m_viewport);
-		m_module.BuildHeaderBounds(selectedHeader);
-
-		if (m_module.UpdateScrollBars())
-		{
-			if (m_module.m_scrollBarVert)
-				m_module.m_scrollBarVert->Handle()->Renderer.Update();
-
-			if (m_module.m_scrollBarHoriz)
-				m_module.m_scrollBarHoriz->Handle()->Renderer.Update();
-		}
-
-		hoveredArea = m_module.DetermineHoverArea(args.Position);
-		if (hoveredArea != InteractionArea::HeaderSplitter)
-		{
-			GUI::ChangeCursor(m_module.m_window, Cursor::Default);
-		}
-		m_module.m_pressedArea = InteractionArea::None;
-		m_module.m_hoveredArea = hoveredArea;
-
-		GUI::MarkAsNeedUpdate(m_module.m_window);
+		m_module.StartHeaderAutoSizing(selectedHeader);
 	}
 
 	void ListBoxReactor::Resize(Graphics& graphics, const ArgResize& args)
@@ -176,7 +145,7 @@ namespace Berta
 		{
 			if (args.ButtonState.NoButtonsPressed())
 			{
-				needUpdate |= m_module.SetHoveredListItem();
+				m_module.SetHoveredListItem();
 
 				if (hoveredArea == InteractionArea::HeaderSplitter)
 				{
@@ -280,12 +249,12 @@ namespace Berta
 				int newIndex = positionY / (int)itemHeight;
 				auto absIndex = m_module.m_list.m_sortedIndexes[newIndex];
 
-				needUpdate |= m_module.SetHoveredListItem(&m_module.m_list.m_items[absIndex]) && !m_module.m_list.m_items[absIndex].m_isSelected;
+				m_module.SetHoveredListItem(&m_module.m_list.m_items[absIndex]);
 			}
 		}
 		else if (hoveredArea == InteractionArea::ListBlank || hoveredArea == InteractionArea::None)
 		{
-			needUpdate |= m_module.SetHoveredListItem();
+			m_module.SetHoveredListItem();
 
 			if (m_module.m_mouseSelection.m_started)
 			{
@@ -400,8 +369,8 @@ namespace Berta
 			GUI::ChangeCursor(m_module.m_window, Cursor::Default);
 		}
 
-		bool needUpdate = m_module.m_mouseSelection.m_hoveredItem != nullptr;
-		m_module.m_mouseSelection.m_hoveredItem = nullptr;
+		bool needUpdate = false;
+		m_module.SetHoveredListItem();
 		if (args.ButtonState.NoButtonsPressed() && (m_module.m_hoveredArea == InteractionArea::Header || m_module.m_hoveredArea == InteractionArea::HeaderSplitter)
 			&& m_module.m_headers.m_selectedIndex != -1)
 		{
@@ -423,7 +392,7 @@ namespace Berta
 			return;
 		}
 
-		int direction = args.WheelDelta > 0 ? -1 : 1;
+		int direction = (args.WheelDelta > 0 ? -1 : 1) * args.GetNotches();
 		direction *= args.IsVertical ? m_module.m_scrollBarVert->GetStepValue() : m_module.m_scrollBarHoriz->GetStepValue();
 		auto min = args.IsVertical ? m_module.m_scrollBarVert->GetMin() : m_module.m_scrollBarHoriz->GetMin();
 		auto max = args.IsVertical ? m_module.m_scrollBarVert->GetMax() : m_module.m_scrollBarHoriz->GetMax();
@@ -461,7 +430,8 @@ namespace Berta
 		bool needUpdate = false;
 		if (args.Key == KeyboardKey::ArrowUp || args.Key == KeyboardKey::ArrowDown)
 		{
-			auto direction = args.Key == KeyboardKey::ArrowUp ? -1 : 1;
+			int direction = args.Key == KeyboardKey::ArrowUp ? -1 : 1;
+			int amount = direction * static_cast<int>(args.RepeatCount);
 
 			int selectedIndex = -1;
 			if (m_module.m_mouseSelection.m_selectedItem)
@@ -473,7 +443,12 @@ namespace Berta
 				selectedIndex = (direction == -1 ? (int)m_module.m_list.m_items.size() : -1);
 			}
 
-			auto newItemIndex = selectedIndex + direction;
+			auto newItemIndex = selectedIndex + amount;
+			if (args.RepeatCount > 1 && !m_module.m_list.m_items.empty())
+			{
+				// Folded auto-repeat: stop at the first/last item instead of dropping the whole batch.
+				newItemIndex = std::clamp(newItemIndex, 0, (int)m_module.m_list.m_items.size() - 1);
+			}
 			if (newItemIndex >= 0 && newItemIndex < (int)m_module.m_list.m_items.size())
 			{
 				auto absoluteIndex = m_module.m_list.m_sortedIndexes[newItemIndex];
@@ -1161,7 +1136,7 @@ namespace Berta
 		DrawStringInBox(graphics, name, textRect, textColor);
 	}
 
-	void ListBoxReactor::Module::DrawList(Graphics& graphics)
+	void ListBoxReactor::Module::DrawList(Graphics& graphics, const Rectangle& damage)
 	{
 		bool enabled = true;
 		auto headerHeight = m_window->ToScale(m_appearance->HeadersHeight);
@@ -1174,7 +1149,13 @@ namespace Berta
 		auto& itemHeightWithMargin = m_viewport.m_itemHeightWithMargin;
 		auto leftMarginListItemText = m_window->ToScale(3u);
 
-		for (size_t i = m_viewport.m_startingVisibleIndex; i < m_viewport.m_endingVisibleIndex; i++)
+		// Rows outside the damaged band are left as they are.
+		auto damageStartIndex = (damage.Y - listOffset.Y) / (int)itemHeightWithMargin;
+		auto damageEndIndex = (damage.Y + (int)damage.Height - listOffset.Y) / (int)itemHeightWithMargin + 1;
+		auto startIndex = (std::max)({ 0, m_viewport.m_startingVisibleIndex, damageStartIndex });
+		auto endIndex = (std::min)(m_viewport.m_endingVisibleIndex, damageEndIndex);
+
+		for (size_t i = startIndex; (int)i < endIndex; i++)
 		{
 			auto absoluteIndex = m_list.m_sortedIndexes[i];
 			auto& item = m_list.m_items[absoluteIndex];
@@ -1269,7 +1250,10 @@ namespace Berta
 	{
 		if (m_mouseSelection.m_hoveredItem != index)
 		{
+			// Only the rows losing and gaining the highlight change.
+			GUI::MarkAsNeedUpdate(m_window, GetListItemRect(m_mouseSelection.m_hoveredItem));
 			m_mouseSelection.m_hoveredItem = index;
+			GUI::MarkAsNeedUpdate(m_window, GetListItemRect(index));
 			return true;
 		}
 		return false;
@@ -1352,6 +1336,24 @@ namespace Berta
 		return -1;
 	}
 
+	Rectangle ListBoxReactor::Module::GetListItemRect(List::Item* item)
+	{
+		if (item == nullptr)
+		{
+			return {};
+		}
+
+		for (int i = (std::max)(m_viewport.m_startingVisibleIndex, 0); i < m_viewport.m_endingVisibleIndex; i++)
+		{
+			if (item == &m_list.m_items[m_list.m_sortedIndexes[i]])
+			{
+				auto rowY = m_viewport.m_backgroundRect.Y - m_scrollOffset.Y + (int)(m_viewport.m_itemHeightWithMargin * i);
+				return { m_viewport.m_backgroundRect.X, rowY, m_viewport.m_backgroundRect.Width + m_viewport.m_columnOffsetStartOff, m_viewport.m_itemHeightWithMargin };
+			}
+		}
+		return {};
+	}
+
 	bool ListBoxReactor::Module::HandleMultiSelection(List::Item* item, const ArgMouse& args)
 	{
 		bool needUpdate = false;
@@ -1783,6 +1785,96 @@ namespace Berta
 		m_headers.m_selectedIndex = -1;
 	}
 
+	void ListBoxReactor::Module::StartHeaderAutoSizing(size_t headerIndex)
+	{
+		CancelHeaderAutoSizing();
+
+		m_headerAutoSizing.m_headerIndex = headerIndex;
+		m_headerAutoSizing.m_nextItemIndex = 0;
+		m_headerAutoSizing.m_maxCellWidth = 0;
+		m_headerAutoSizing.m_taskId = GUI::ScheduleIdle(m_window, [this](const IdleDeadline& deadline)
+		{
+			return ContinueHeaderAutoSizing(deadline);
+		}, LISTBOX_HEADER_AUTOSIZING_DEADLINE);
+	}
+
+	bool ListBoxReactor::Module::ContinueHeaderAutoSizing(const IdleDeadline& deadline)
+	{
+		auto& autoSizing = m_headerAutoSizing;
+		if (autoSizing.m_headerIndex >= m_headers.m_items.size())
+		{
+			autoSizing.m_taskId = InvalidIdleTaskId;
+			return false;
+		}
+
+		auto& graphics = m_window->Renderer.GetGraphics();
+		while (autoSizing.m_nextItemIndex < m_list.m_items.size())
+		{
+			const auto& cells = m_list.m_items[autoSizing.m_nextItemIndex].m_cells;
+			++autoSizing.m_nextItemIndex;
+			if (autoSizing.m_headerIndex < cells.size())
+			{
+				auto cellWidth = graphics.GetTextExtent(cells[autoSizing.m_headerIndex].m_text).Width;
+				autoSizing.m_maxCellWidth = (std::max)(autoSizing.m_maxCellWidth, cellWidth);
+			}
+
+			if ((autoSizing.m_nextItemIndex % 64) == 0 && deadline.ShouldYield())
+			{
+				return true;
+			}
+		}
+
+		autoSizing.m_taskId = InvalidIdleTaskId;
+
+		auto maxCellWidth = m_window->ToDownwardScale(autoSizing.m_maxCellWidth);
+		auto leftMarginTextHeader = 5u;
+		maxCellWidth += leftMarginTextHeader * 2u;
+
+		ApplyHeaderWidth(autoSizing.m_headerIndex, (std::max)(maxCellWidth, LISTBOX_MIN_HEADER_WIDTH));
+		return false;
+	}
+
+	void ListBoxReactor::Module::CancelHeaderAutoSizing()
+	{
+		if (m_headerAutoSizing.m_taskId != InvalidIdleTaskId)
+		{
+			GUI::CancelIdle(m_headerAutoSizing.m_taskId);
+			m_headerAutoSizing.m_taskId = InvalidIdleTaskId;
+		}
+	}
+
+	void ListBoxReactor::Module::ApplyHeaderWidth(size_t headerIndex, uint32_t newWidth)
+	{
+		bool needUpdate = newWidth != m_headers.m_items[headerIndex].m_bounds.Width;
+		if (!needUpdate)
+			return;
+
+		m_headers.m_items[headerIndex].m_bounds.Width = newWidth;
+		CalculateViewport(m_viewport);
+		BuildHeaderBounds(headerIndex);
+
+		if (UpdateScrollBars())
+		{
+			if (m_scrollBarVert)
+				m_scrollBarVert->Handle()->Renderer.Update();
+
+			if (m_scrollBarHoriz)
+				m_scrollBarHoriz->Handle()->Renderer.Update();
+		}
+
+		// The mouse may have moved on while the column was being measured.
+		auto hoveredArea = DetermineHoverArea(GUI::GetMousePositionToWindow(m_window));
+		if (hoveredArea != InteractionArea::HeaderSplitter)
+		{
+			GUI::ChangeCursor(m_window, Cursor::Default);
+		}
+		m_pressedArea = InteractionArea::None;
+		m_hoveredArea = hoveredArea;
+
+		// Not inside an event anymore, nobody else will redraw it.
+		GUI::UpdateWindow(m_window);
+	}
+
 	void ListBoxReactor::Module::StartSelectingHeader(const Point& mousePosition)
 	{
 		GUI::Capture(m_window);
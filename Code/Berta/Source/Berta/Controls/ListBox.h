@@ -7,6 +7,7 @@
 #ifndef BT_LIST_BOX_HEADER
 #define BT_LIST_BOX_HEADER
 
+#include "Berta/Core/IdleScheduler.h"
 #include "Berta/GUI/Window.h"
 #include "Berta/GUI/Control.h"
 #include "Berta/Controls/ScrollBar.h"
@@ -18,6 +19,7 @@
 namespace Berta
 {
 	constexpr uint32_t LISTBOX_MIN_HEADER_WIDTH = 80u;
+	constexpr std::chrono::milliseconds LISTBOX_HEADER_AUTOSIZING_DEADLINE{ 100 };
 
 	struct ListBoxItem;
 
@@ -37,13 +39,21 @@ namespace Berta
 	struct ListBoxEvents : public ControlEvents
 	{
 		Event<ArgListBox> Selected;
+
+		void DisconnectAll(EventOwner owner) override
+		{
+			ControlEvents::DisconnectAll(owner);
+			Selected.DisconnectAll(owner);
+		}
 	};
 
 	class ListBoxReactor : public ControlReactor
 	{
 	public:
 		void Init(ControlBase& control) override;
-		void Update(Graphics& graphics) override;
+		void Shutdown() override;
+		void Update(Graphics& graphics, const Rectangle& damage) override;
+		bool IsOpaque() const override { return true; }
 		void DblClick(Graphics& graphics, const ArgMouse& args) override;
 		void Resize(Graphics& graphics, const ArgResize& args) override;
 		void MouseDown(Graphics& graphics, const ArgMouse& args) override;
@@ -81,6 +91,15 @@ namespace Berta
 			std::vector<size_t> m_sorted;
 		};
 
+		// Double click on a header splitter: the column width is measured in idle time.
+		struct HeaderAutoSizing
+		{
+			IdleTaskId m_taskId{ InvalidIdleTaskId };
+			size_t m_headerIndex{ 0 };
+			size_t m_nextItemIndex{ 0 };
+			uint32_t m_maxCellWidth{ 0 };
+		};
+
 		struct Cell
 		{
 			Cell(const std::string& text) : m_text(text){}
@@ -196,11 +215,16 @@ namespace Berta
 			void StopHeadersSizing();
 			void StartSelectingHeader(const Point& mousePosition);
 
+			void StartHeaderAutoSizing(size_t headerIndex);
+			bool ContinueHeaderAutoSizing(const IdleDeadline& deadline);
+			void CancelHeaderAutoSizing();
+			void ApplyHeaderWidth(size_t headerIndex, uint32_t newWidth);
+
 			void DrawStringInBox(Graphics& graphics, const std::string& str, const Rectangle& boxBounds, const Color& textColor);
 
 			void DrawHeaders(Graphics& graphics);
 			void DrawHeaderItem(Graphics& graphics, const Rectangle& rect, const std::string& name, bool isHovered, const Rectangle& textRect, const Color& textColor);
-			void DrawList(Graphics& graphics);
+			void DrawList(Graphics& graphics, const Rectangle& damage);
 
 			void CalculateSelectionBox(Point& startPoint, Point& endPoint, Size& boxSize) const;
 			bool SetHoveredListItem(List::Item* index = nullptr);
@@ -209,8 +233,10 @@ namespace Berta
 			void SortHeader(size_t headerIndex, bool ascending);
 
 			int GetListItemIndex(List::Item* item);
+			Rectangle GetListItemRect(List::Item* item);
 
 			Headers m_headers;
+			HeaderAutoSizing m_headerAutoSizing;
 			List m_list;
 
 			InteractionArea m_hoveredArea{ InteractionArea::None };
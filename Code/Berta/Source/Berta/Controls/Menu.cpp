@@ -20,12 +20,12 @@ namespace Berta
 	void Menu::Append(const std::string& text, ClickCallback onClick)
 	{
 		std::wstring wstr(text.begin(), text.end());
-		auto& newItem = m_items.emplace_back(new Menu::Item{ wstr , onClick });
+		auto& newItem = m_items.emplace_back(new Menu::Item{ wstr , std::move(onClick) });
 	}
 
 	void Menu::Append(const std::wstring& text, ClickCallback onClick)
 	{
-		auto& newItem = m_items.emplace_back(new Menu::Item{ text , onClick });
+		auto& newItem = m_items.emplace_back(new Menu::Item{ text , std::move(onClick) });
 	}
 
 	void Menu::AppendSeparator()
@@ -378,11 +378,17 @@ namespace Berta
 		auto lastMenuItem = GetLastMenuItem();
 		if (args.Key == KeyboardKey::ArrowUp)
 		{
-			lastMenuItem->MoveToNextItem(true);
+			for (uint32_t i = 0; i < args.RepeatCount; ++i)
+			{
+				lastMenuItem->MoveToNextItem(true);
+			}
 		}
 		else if (args.Key == KeyboardKey::ArrowDown)
 		{
-			lastMenuItem->MoveToNextItem(false);
+			for (uint32_t i = 0; i < args.RepeatCount; ++i)
+			{
+				lastMenuItem->MoveToNextItem(false);
+			}
 		}
 		else if (args.Key == KeyboardKey::ArrowLeft)
 		{
@@ -9,6 +9,7 @@
 
 #include "Berta/GUI/Window.h"
 #include "Berta/GUI/Control.h"
+#include "Berta/Core/Delegate.h"
 #include "Berta/Core/Timer.h"
 #include "Berta/Paint/Image.h"
 #include <string>
@@ -66,7 +67,7 @@ namespace Berta
 		friend class MenuBoxReactor;
 		friend class MenuBarReactor;
 
-		using ClickCallback = std::function<void(MenuItem&)>;
+		using ClickCallback = Delegate<void(MenuItem&)>;
 		using DestroyCallback = std::function<void()>;
 
 		void Append(const std::string& text, ClickCallback onClick = {});
@@ -83,7 +84,7 @@ namespace Berta
 			Item(const std::wstring& _text, ClickCallback _onClick) : 
 				m_text(_text), 
 				m_isSpearator(false),
-				m_onClick(_onClick){}
+				m_onClick(std::move(_onClick)){}
 
 			std::wstring m_text;
 			bool m_isSpearator{ false };
@@ -125,6 +126,7 @@ namespace Berta
 
 		void Init(ControlBase& control) override;
 		void Update(Graphics& graphics) override;
+		bool IsOpaque() const override { return true; }
 
 		void MouseEnter(Graphics& graphics, const ArgMouse& args) override;
 		void MouseLeave(Graphics& graphics, const ArgMouse& args) override;
@@ -19,7 +19,7 @@ namespace Berta
 		m_module.m_owner = control.Handle();
 		m_module.m_rootMenuItemReactor = this;
 
-		m_module.m_owner->Events->Focus.Connect([&](const ArgFocus& args)
+		m_module.m_owner->GetEvents().Focus.Connect([&](const ArgFocus& args)
 		{
 			if (!args.Focused && m_module.IsMenuOpen())
 			{
@@ -151,11 +151,17 @@ namespace Berta
 			auto lastMenuItem = GetLastMenuItem();
 			if (args.Key == KeyboardKey::ArrowUp)
 			{
-				lastMenuItem->MoveToNextItem(true);
+				for (uint32_t i = 0; i < args.RepeatCount; ++i)
+				{
+					lastMenuItem->MoveToNextItem(true);
+				}
 			}
 			else if (args.Key == KeyboardKey::ArrowDown)
 			{
-				lastMenuItem->MoveToNextItem(false);
+				for (uint32_t i = 0; i < args.RepeatCount; ++i)
+				{
+					lastMenuItem->MoveToNextItem(false);
+				}
 			}
 			else if (args.Key == KeyboardKey::ArrowLeft)
 			{
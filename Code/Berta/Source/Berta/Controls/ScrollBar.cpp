@@ -275,7 +275,10 @@ namespace Berta
 	{
 		ArgScrollBar argScrollbar{};
 		argScrollbar.Value = m_value;
-		reinterpret_cast<ScrollBarEvents*>(m_control->Handle()->Events.get())->ValueChanged.Emit(argScrollbar);
+		if (auto events = reinterpret_cast<ScrollBarEvents*>(m_control->Handle()->Events.get()))
+		{
+			events->ValueChanged.Emit(argScrollbar);
+		}
 	}
 
 	uint32_t ScrollBarReactor::GetButtonSize() const
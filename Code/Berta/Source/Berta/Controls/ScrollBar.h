@@ -25,6 +25,12 @@ namespace Berta
 	struct ScrollBarEvents : public ControlEvents
 	{
 		Event<ArgScrollBar>	ValueChanged;
+
+		void DisconnectAll(EventOwner owner) override
+		{
+			ControlEvents::DisconnectAll(owner);
+			ValueChanged.DisconnectAll(owner);
+		}
 	};
 
 	class ScrollBarReactor : public ControlReactor
@@ -32,6 +38,7 @@ namespace Berta
 	public:
 		void Init(ControlBase& control) override;
 		void Update(Graphics& graphics) override;
+		bool IsOpaque() const override { return true; }
 
 		void MouseLeave(Graphics& graphics, const ArgMouse& args) override;
 		void MouseDown(Graphics& graphics, const ArgMouse& args) override;
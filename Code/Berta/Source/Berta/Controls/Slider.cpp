@@ -239,7 +239,10 @@ namespace Berta
 	{
 		ArgSlider argScrollbar{};
 		argScrollbar.Value = m_value;
-		reinterpret_cast<SliderEvents*>(m_control->Handle()->Events.get())->ValueChanged.Emit(argScrollbar);
+		if (auto events = reinterpret_cast<SliderEvents*>(m_control->Handle()->Events.get()))
+		{
+			events->ValueChanged.Emit(argScrollbar);
+		}
 	}
 
 	void SliderReactor::UpdateSliderBoxValue(int position)
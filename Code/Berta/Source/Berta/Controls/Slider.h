@@ -24,6 +24,12 @@ namespace Berta
 	struct SliderEvents : public ControlEvents
 	{
 		Event<ArgSlider>	ValueChanged;
+
+		void DisconnectAll(EventOwner owner) override
+		{
+			ControlEvents::DisconnectAll(owner);
+			ValueChanged.DisconnectAll(owner);
+		}
 	};
 
 	class SliderReactor : public ControlReactor
@@ -31,6 +37,7 @@ namespace Berta
 	public:
 		void Init(ControlBase& control) override;
 		void Update(Graphics& graphics) override;
+		bool IsOpaque() const override { return true; }
 
 		void MouseLeave(Graphics& graphics, const ArgMouse& args) override;
 		void MouseDown(Graphics& graphics, const ArgMouse& args) override;
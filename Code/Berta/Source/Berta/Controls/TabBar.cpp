@@ -15,7 +15,6 @@ namespace Berta
 	{
 		m_control = &control;
 		m_module.m_owner = control.Handle();
-		m_module.m_events = reinterpret_cast<TabBarEvents*>(m_module.m_owner->Events.get());
 		m_module.m_appearance = reinterpret_cast<TabBarAppearance*>(m_module.m_owner->Appearance.get());
 	}
 
@@ -139,7 +138,10 @@ namespace Berta
 			newSelectedTabItem->PanelPtr->Show();
 
 			ArgTabBar argsTabBar{ newSelectedTabItem->Id };
-			m_module.m_events->TabChanged.Emit(argsTabBar);
+			if (auto events = reinterpret_cast<TabBarEvents*>(m_module.m_owner->Events.get()))
+			{
+				events->TabChanged.Emit(argsTabBar);
+			}
 
 			GUI::MarkAsNeedUpdate(m_module.m_owner);
 		}
@@ -323,7 +325,10 @@ namespace Berta
 		if (removeSelectedIndex && m_selectedTabIndex >= 0)
 		{
 			ArgTabBar argsTabBar{ current->Id };
-			m_events->TabChanged.Emit(argsTabBar);
+			if (auto events = reinterpret_cast<TabBarEvents*>(m_owner->Events.get()))
+			{
+				events->TabChanged.Emit(argsTabBar);
+			}
 
 			current->PanelPtr->Show();
 		}
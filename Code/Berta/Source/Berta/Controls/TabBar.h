@@ -30,6 +30,12 @@ namespace Berta
 	struct TabBarEvents : public ControlEvents
 	{
 		Event<ArgTabBar> TabChanged;
+
+		void DisconnectAll(EventOwner owner) override
+		{
+			ControlEvents::DisconnectAll(owner);
+			TabChanged.DisconnectAll(owner);
+		}
 	};
 	struct TabBarAppearance : public ControlAppearance
 	{
@@ -41,6 +47,7 @@ namespace Berta
 	public:
 		void Init(ControlBase& control) override;
 		void Update(Graphics& graphics) override;
+		bool IsOpaque() const override { return true; }
 
 		void MouseDown(Graphics& graphics, const ArgMouse& args) override;
 		void Resize(Graphics& graphics, const ArgResize& args) override;
@@ -62,7 +69,7 @@ namespace Berta
 
 			Point Position{};
 			Point Center{};
-			Size Size{};
+			Berta::Size Size{};
 			Rectangle PanelArea{};
 
 			std::string Id;
@@ -101,7 +108,6 @@ namespace Berta
 			std::list<PanelItem> m_panels;
 			int m_selectedTabIndex{ -1 };
 			Window* m_owner{ nullptr };
-			TabBarEvents* m_events{ nullptr };
 			TabBarAppearance* m_appearance{ nullptr };
 			TabBarPosition m_tabPosition{ TabBarPosition::Top };
 
@@ -18,20 +18,19 @@ namespace Berta
 	{
 		m_control = &control;
 		m_module.m_appearance = reinterpret_cast<ThumbListBoxAppearance*>(control.Handle()->Appearance.get());
-		m_module.m_events = reinterpret_cast<ThumbListBoxEvents*>(control.Handle()->Events.get());
 
 		m_module.m_window = control.Handle();
 		m_module.m_control = m_control;
 		m_module.CalculateViewport(m_module.m_viewport);
 	}
 
-	void ThumbListBoxReactor::Update(Graphics& graphics)
+	void ThumbListBoxReactor::Update(Graphics& graphics, const Rectangle& damage)
 	{
 		//BT_CORE_TRACE << "  - ThumbListBoxReactor::Update " << std::endl;
 		auto window = m_control->Handle();
 		bool enabled = m_control->GetEnabled();
 
-		graphics.DrawRectangle(window->ClientSize.ToRectangle(), window->Appearance->BoxBackground, true);
+		graphics.DrawRectangle(damage, window->Appearance->BoxBackground, true);
 
 		Point offset{ 0, -m_module.m_state.m_offset };
 
@@ -44,6 +43,10 @@ namespace Berta
 			auto& item = m_module.m_items[i];
 
 			Rectangle cardRect{ item.m_bounds.X + offset.X, item.m_bounds.Y + offset.Y, m_module.m_viewport.m_cardSize.Width, m_module.m_viewport.m_cardSize.Height };
+			if (!cardRect.Intersect(damage))
+			{
+				continue; // Outside the damaged area, left as it is.
+			}
 			
 			Rectangle thumbnailRect = { cardRect.X, cardRect.Y, thumbFrameSize.Width, thumbFrameSize.Height };
 			const bool& isSelected = item.m_isSelected;
@@ -158,9 +161,13 @@ namespace Berta
 	void ThumbListBoxReactor::MouseMove(Graphics& graphics, const ArgMouse& args)
 	{
 		bool needUpdate = false;
+		Rectangle damage;
 
 		if (m_module.m_mouseSelection.m_started)
 		{
+			// Only the old and new selection boxes and the cards changing selection are redrawn.
+			damage = m_module.GetSelectionBoxRect();
+
 			auto logicalPosition = args.Position;
 			logicalPosition.Y -= m_module.m_state.m_offset;
 			m_module.m_mouseSelection.m_endPosition = logicalPosition;
@@ -172,10 +179,13 @@ namespace Berta
 			needUpdate |= (boxSize.Width > 0 && boxSize.Height > 0);
 			if (boxSize.Width > 0 && boxSize.Height > 0)
 			{
+				damage = damage.Union(m_module.GetSelectionBoxRect());
+
 				Rectangle selectionRect{ startPoint.X, startPoint.Y + m_module.m_state.m_offset * 2, boxSize.Width, boxSize.Height};
 				for (size_t i = m_module.m_viewport.m_startingVisibleIndex; i < m_module.m_viewport.m_endingVisibleIndex; i++)
 				{
 					auto& item = m_module.m_items[i];
+					bool wasSelected = item.m_isSelected;
 					bool intersection = item.m_bounds.Intersect(selectionRect);
 					bool alreadySelected = m_module.m_mouseSelection.IsAlreadySelected(i);
 
@@ -194,13 +204,18 @@ namespace Berta
 					{
 						item.m_isSelected = intersection || alreadySelected;
 					}
+
+					if (item.m_isSelected != wasSelected)
+					{
+						damage = damage.Union(m_module.GetItemRect(i));
+					}
 				}
 			}
 		}
 
 		if (needUpdate)
 		{
-			GUI::MarkAsNeedUpdate(*m_control);
+			GUI::MarkAsNeedUpdate(*m_control, damage);
 		}
 	}
 
@@ -240,7 +255,7 @@ namespace Berta
 			return;
 		}
 
-		int direction = args.WheelDelta > 0 ? -1 : 1;
+		int direction = (args.WheelDelta > 0 ? -1 : 1) * args.GetNotches();
 		direction *= m_module.m_scrollBar->GetStepValue();
 		int newOffset = std::clamp(m_module.m_state.m_offset + direction, (int)m_module.m_scrollBar->GetMin(), (int)m_module.m_scrollBar->GetMax());
 
@@ -262,6 +277,21 @@ namespace Berta
 		m_module.m_shiftPressed = m_module.m_shiftPressed || args.Key == KeyboardKey::Shift;
 		m_module.m_ctrlPressed = m_module.m_ctrlPressed || args.Key == KeyboardKey::Control;
 
+		// Key auto-repeats may arrive folded into one event (see InputQueue), each one moves the selection.
+		bool needUpdate = false;
+		for (uint32_t i = 0; i < args.RepeatCount; ++i)
+		{
+			needUpdate = HandleKeyPressed(args) || needUpdate;
+		}
+
+		if (needUpdate)
+		{
+			GUI::MarkAsNeedUpdate(*m_control);
+		}
+	}
+
+	bool ThumbListBoxReactor::HandleKeyPressed(const ArgKeyboard& args)
+	{
 		bool needUpdate = false;
 		if (args.Key == KeyboardKey::ArrowLeft || args.Key == KeyboardKey::ArrowRight || args.Key == KeyboardKey::ArrowUp || args.Key == KeyboardKey::ArrowDown)
 		{
@@ -377,11 +407,7 @@ namespace Berta
 				needUpdate = true;
 			}
 		}
-
-		if (needUpdate)
-		{
-			GUI::MarkAsNeedUpdate(*m_control);
-		}
+		return needUpdate;
 	}
 
 	void ThumbListBoxReactor::KeyReleased(Graphics& graphics, const ArgKeyboard& args)
@@ -525,6 +551,21 @@ namespace Berta
 		boxSize = { (uint32_t)(endPoint.X - startPoint.X), (uint32_t)(endPoint.Y - startPoint.Y) };
 	}
 
+	Rectangle ThumbListBoxReactor::Module::GetSelectionBoxRect()
+	{
+		Point startPoint, endPoint;
+		Size boxSize;
+		CalculateSelectionBox(startPoint, endPoint, boxSize);
+
+		return { startPoint.X, startPoint.Y + m_state.m_offset, boxSize.Width, boxSize.Height };
+	}
+
+	Rectangle ThumbListBoxReactor::Module::GetItemRect(size_t index) const
+	{
+		auto& item = m_items[index];
+		return { item.m_bounds.X, item.m_bounds.Y - m_state.m_offset, m_viewport.m_cardSize.Width, m_viewport.m_cardSize.Height };
+	}
+
 	bool ThumbListBoxReactor::Module::Clear()
 	{
 		bool needUpdate = !m_items.empty();
@@ -842,7 +883,10 @@ namespace Berta
 		args.Index = index;
 		args.Visible = visible;
 		BT_CORE_DEBUG << " - visibility item = " << index << ". visible=" << visible << std::endl;
-		m_events->ItemVisibility.Emit(args);
+		if (auto events = reinterpret_cast<ThumbListBoxEvents*>(m_window->Events.get()))
+		{
+			events->ItemVisibility.Emit(args);
+		}
 	}
 
 	void ThumbListBoxReactor::Module::Draw() const
@@ -39,13 +39,21 @@ namespace Berta
 	{
 		Event<ArgThumbListBox>	Selected;
 		Event<ArgThumbListBoxItemVisibility>	ItemVisibility;
+
+		void DisconnectAll(EventOwner owner) override
+		{
+			ControlEvents::DisconnectAll(owner);
+			Selected.DisconnectAll(owner);
+			ItemVisibility.DisconnectAll(owner);
+		}
 	};
 
 	class ThumbListBoxReactor : public ControlReactor
 	{
 	public:
 		void Init(ControlBase& control) override;
-		void Update(Graphics& graphics) override;
+		void Update(Graphics& graphics, const Rectangle& damage) override;
+		bool IsOpaque() const override { return true; }
 		void Resize(Graphics& graphics, const ArgResize& args) override;
 		void MouseDown(Graphics& graphics, const ArgMouse& args) override;
 		void MouseMove(Graphics& graphics, const ArgMouse& args) override;
@@ -112,6 +120,8 @@ namespace Berta
 			void CalculateViewport(ViewportData& viewportData) const;
 			void CalculateVisibleIndices();
 			void CalculateSelectionBox(Point& startPoint, Point& endPoint, Size& boxSize);
+			Rectangle GetSelectionBoxRect();
+			Rectangle GetItemRect(size_t index) const;
 			void BuildItems();
 			bool Clear();
 			void Erase(size_t index);
@@ -151,7 +161,6 @@ namespace Berta
 			bool m_shiftPressed{ false };
 			bool m_ctrlPressed{ false };
 
-			ThumbListBoxEvents* m_events{ nullptr };
 			MouseSelection m_mouseSelection;
 			ViewportData m_viewport;
 		private:
@@ -162,6 +171,8 @@ namespace Berta
 		const Module& GetModule() const { return m_module; }
 
 	private:
+		bool HandleKeyPressed(const ArgKeyboard& args);
+
 		Module m_module;
 	};
 
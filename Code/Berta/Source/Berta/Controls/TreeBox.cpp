@@ -25,19 +25,19 @@ namespace Berta
 		m_module.CalculateViewport(m_module.m_viewport);
 	}
 
-	void TreeBoxReactor::Update(Graphics& graphics)
+	void TreeBoxReactor::Update(Graphics& graphics, const Rectangle& damage)
 	{
 		//BT_CORE_TRACE << " -- TreeBox Update() " << std::endl;
 		auto window = m_control->Handle();
 		bool enabled = m_control->GetEnabled();
 
-		graphics.DrawRectangle(window->ClientSize.ToRectangle(), window->Appearance->BoxBackground, true);
+		graphics.DrawRectangle(damage, window->Appearance->BoxBackground, true);
 
 		if (m_module.m_showNavigationLines)
 		{
 			m_module.DrawNavigationLines(graphics);
 		}
-		m_module.DrawTreeNodes(graphics);
+		m_module.DrawTreeNodes(graphics, damage);
 
 		if (m_module.m_viewport.m_needHorizontalScroll && m_module.m_viewport.m_needVerticalScroll)
 		{
@@ -64,14 +64,8 @@ namespace Berta
 
 	void TreeBoxReactor::MouseLeave(Graphics& graphics, const ArgMouse& args)
 	{
-		bool needUpdate = m_module.m_mouseSelection.m_hoveredNode != nullptr;
-		m_module.m_mouseSelection.m_hoveredNode = nullptr;
-
+		m_module.SetHoveredNode(nullptr);
 		m_module.m_hoveredArea = InteractionArea::None;
-		if (needUpdate)
-		{
-			GUI::MarkAsNeedUpdate(m_module.m_window);
-		}
 	}
 
 	void TreeBoxReactor::MouseDown(Graphics& graphics, const ArgMouse& args)
@@ -167,7 +161,6 @@ namespace Berta
 	void TreeBoxReactor::MouseMove(Graphics& graphics, const ArgMouse& args)
 	{
 		auto hoveredArea = m_module.DetermineHoverArea(args.Position);
-		bool needUpdate = false;
 		
 		if (hoveredArea == InteractionArea::Node || hoveredArea == InteractionArea::Expander)
 		{
@@ -178,21 +171,14 @@ namespace Berta
 			int index = positionY / nodeHeightInt;
 			index -= m_module.m_viewport.m_startingVisibleIndex;
 
-			needUpdate = m_module.m_visibleNodes[index] != m_module.m_mouseSelection.m_hoveredNode;
-			m_module.m_mouseSelection.m_hoveredNode = m_module.m_visibleNodes[index];
+			m_module.SetHoveredNode(m_module.m_visibleNodes[index]);
 		}
 		else if (hoveredArea == InteractionArea::Blank)
 		{
-			needUpdate = m_module.m_mouseSelection.m_hoveredNode != nullptr;
-			m_module.m_mouseSelection.m_hoveredNode = nullptr;
+			m_module.SetHoveredNode(nullptr);
 		}
 
 		m_module.m_hoveredArea = hoveredArea;
-
-		if (needUpdate)
-		{
-			GUI::MarkAsNeedUpdate(m_module.m_window);
-		}
 	}
 
 	void TreeBoxReactor::MouseUp(Graphics& graphics, const ArgMouse& args)
@@ -206,7 +192,7 @@ namespace Berta
 			return;
 		}
 
-		int direction = args.WheelDelta > 0 ? -1 : 1;
+		int direction = (args.WheelDelta > 0 ? -1 : 1) * args.GetNotches();
 		direction *= args.IsVertical ? m_module.m_scrollBarVert->GetStepValue() : m_module.m_scrollBarHoriz->GetStepValue();
 		auto min = args.IsVertical ? m_module.m_scrollBarVert->GetMin() : m_module.m_scrollBarHoriz->GetMin();
 		auto max = args.IsVertical ? m_module.m_scrollBarVert->GetMax() : m_module.m_scrollBarHoriz->GetMax();
@@ -314,10 +300,15 @@ namespace Berta
 		{
 			int pageAmount = static_cast<int>(m_module.m_viewport.m_backgroundRect.Height / nodeHeightInt);
 			int direction = (args.Key == KeyboardKey::ArrowUp || args.Key == KeyboardKey::PageUp) ? -1 : 1;
-			int amount = direction * ((args.Key == KeyboardKey::PageDown || args.Key == KeyboardKey::PageUp) ? pageAmount : 1);
+			int amount = direction * ((args.Key == KeyboardKey::PageDown || args.Key == KeyboardKey::PageUp) ? pageAmount : 1) * static_cast<int>(args.RepeatCount);
 			
 			auto selectedIndex = (m_module.m_mouseSelection.m_selectedNode == nullptr? (direction == -1 ? (int)m_module.m_viewport.m_treeSize : -1) : m_module.LocateNodeIndexInTree(m_module.m_mouseSelection.m_selectedNode));
 			auto newItemIndex = selectedIndex + amount;
+			if (args.RepeatCount > 1 && m_module.m_viewport.m_treeSize > 0)
+			{
+				// Folded auto-repeat: stop at the first/last node instead of dropping the whole batch.
+				newItemIndex = std::clamp(newItemIndex, 0, static_cast<int>(m_module.m_viewport.m_treeSize) - 1);
+			}
 			if (newItemIndex >= 0 && newItemIndex < static_cast<int>(m_module.m_viewport.m_treeSize))
 			{
 				if (!m_module.m_ctrlPressed)
@@ -807,7 +798,7 @@ namespace Berta
 		GUI::UpdateWindow(m_window);
 	}
 
-	void TreeBoxReactor::Module::DrawTreeNodes(Graphics& graphics)
+	void TreeBoxReactor::Module::DrawTreeNodes(Graphics& graphics, const Rectangle& damage)
 	{
 		bool enabled = true;
 		auto nodeHeight = m_window->ToScale(m_appearance->TreeItemHeight);
@@ -827,6 +818,13 @@ namespace Berta
 		int i = m_viewport.m_startingVisibleIndex;
 		for (auto& node : m_visibleNodes)
 		{
+			auto rowY = offset.Y + nodeHeightInt * i;
+			if (rowY + nodeHeightInt <= damage.Y || rowY >= damage.Y + (int)damage.Height)
+			{
+				++i;
+				continue; // Outside the damaged band, left as it is.
+			}
+
 			auto depth = CalculateNodeDepth(node);
 			int depthOffsetX = static_cast<int>((depth - 1) * depthWidthMultiplier);
 
@@ -1355,6 +1353,32 @@ namespace Berta
 		return false;
 	}
 
+	Rectangle TreeBoxReactor::Module::GetNodeRowRect(TreeNodeType* node) const
+	{
+		int visibleIndex = -1;
+		if (node == nullptr || !IsVisibleNode(node, visibleIndex))
+		{
+			return {};
+		}
+
+		auto nodeHeight = m_window->ToScale(m_appearance->TreeItemHeight);
+		auto rowY = m_viewport.m_backgroundRect.Y - m_scrollOffset.Y + static_cast<int>(nodeHeight) * (m_viewport.m_startingVisibleIndex + visibleIndex);
+		return { m_viewport.m_backgroundRect.X, rowY, m_viewport.m_backgroundRect.Width, nodeHeight };
+	}
+
+	void TreeBoxReactor::Module::SetHoveredNode(TreeNodeType* node)
+	{
+		if (m_mouseSelection.m_hoveredNode == node)
+		{
+			return;
+		}
+
+		// Only the rows losing and gaining the highlight change.
+		GUI::MarkAsNeedUpdate(m_window, GetNodeRowRect(m_mouseSelection.m_hoveredNode));
+		m_mouseSelection.m_hoveredNode = node;
+		GUI::MarkAsNeedUpdate(m_window, GetNodeRowRect(node));
+	}
+
 	bool TreeBoxReactor::Module::IsAnySiblingVisible(TreeNodeType* node) const
 	{
 		auto current = node;
@@ -1381,14 +1405,20 @@ namespace Berta
 		{
 			argTreeBox.Items[i] = { m_mouseSelection.m_selections[i], this };
 		}
-		reinterpret_cast<TreeBoxEvents*>(m_window->Events.get())->Selected.Emit(argTreeBox);
+		if (auto events = reinterpret_cast<TreeBoxEvents*>(m_window->Events.get()))
+		{
+			events->Selected.Emit(argTreeBox);
+		}
 	}
 
 	void TreeBoxReactor::Module::EmitExpansionEvent(TreeNodeType* node)
 	{
 		auto item = TreeBoxItem{ node, this };
 		ArgTreeBox argTreeBox(item, node->isExpanded);
-		reinterpret_cast<TreeBoxEvents*>(m_window->Events.get())->Expanded.Emit(argTreeBox);
+		if (auto events = reinterpret_cast<TreeBoxEvents*>(m_window->Events.get()))
+		{
+			events->Expanded.Emit(argTreeBox);
+		}
 	}
 
 	bool TreeBoxReactor::Module::Collapse(TreeBoxItem item)
@@ -59,7 +59,8 @@ namespace Berta
 	{
 	public:
 		void Init(ControlBase& control) override;
-		void Update(Graphics& graphics) override;
+		void Update(Graphics& graphics, const Rectangle& damage) override;
+		bool IsOpaque() const override { return true; }
 		void Resize(Graphics& graphics, const ArgResize& args) override;
 		void MouseLeave(Graphics& graphics, const ArgMouse& args) override;
 		void MouseDown(Graphics& graphics, const ArgMouse& args) override;
@@ -117,7 +118,7 @@ namespace Berta
 			InteractionArea DetermineHoverArea(const Point& mousePosition);
 			void Update();
 			void Draw();
-			void DrawTreeNodes(Graphics& graphics);
+			void DrawTreeNodes(Graphics& graphics, const Rectangle& damage);
 			void DrawNavigationLines(Graphics& graphics);
 			void Init();
 
@@ -141,6 +142,8 @@ namespace Berta
 			bool IsVisibleNode(TreeNodeType* node) const;
 			bool IsVisibleNode(TreeNodeType* node, int& visibleIndex) const;
 			bool IsAnySiblingVisible(TreeNodeType* node) const;
+			Rectangle GetNodeRowRect(TreeNodeType* node) const;
+			void SetHoveredNode(TreeNodeType* node);
 			void EmitSelectionEvent();
 			void EmitExpansionEvent(TreeNodeType* node);
 
@@ -251,6 +254,13 @@ namespace Berta
 	{
 		Event<ArgTreeBox> Expanded;
 		Event<ArgTreeBoxSelection> Selected;
+
+		void DisconnectAll(EventOwner owner) override
+		{
+			ControlEvents::DisconnectAll(owner);
+			Expanded.DisconnectAll(owner);
+			Selected.DisconnectAll(owner);
+		}
 	};
 
 	class TreeBox : public Control<TreeBoxReactor, TreeBoxEvents, TreeBoxAppearance>
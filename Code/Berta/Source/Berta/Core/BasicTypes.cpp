@@ -66,6 +66,24 @@ namespace Berta
 			other.Y >= this->Y && other.Y + (int)other.Height <= (int)this->Height;
 	}
 
+	Rectangle Rectangle::Union(const Rectangle& other) const
+	{
+		if (IsEmpty())
+		{
+			return other;
+		}
+		if (other.IsEmpty())
+		{
+			return *this;
+		}
+
+		auto left = (std::min)(X, other.X);
+		auto top = (std::min)(Y, other.Y);
+		auto right = (std::max)(X + (int)Width, other.X + (int)other.Width);
+		auto bottom = (std::max)(Y + (int)Height, other.Y + (int)other.Height);
+		return { left, top, static_cast<uint32_t>(right - left), static_cast<uint32_t>(bottom - top) };
+	}
+
 	Rectangle::operator Size() const
 	{
 		return Size{ Width, Height };
@@ -145,12 +163,10 @@ namespace Berta
 
 	Color::operator uint32_t() const
 	{
-#if BT_PLATFORM_WINDOWS
 		return BT_WINDOWS_ABGR(R, G, B, A);
-#endif
-		return 0;
 	}
 
+#ifdef BT_PLATFORM_WINDOWS
 	Color::operator D2D1_COLOR_F() const
 	{
 		D2D1_COLOR_F color;
@@ -160,6 +176,7 @@ namespace Berta
 		color.b = B / 255.0f;
 		return color;
 	}
+#endif
 
 	FormStyle FormStyle::Float()
 	{
@@ -167,6 +167,7 @@ namespace Berta
 		}
 		bool Intersect(const Rectangle& other) const;
 		bool Contains(const Rectangle& other) const;
+		Rectangle Union(const Rectangle& other) const;
 
 		bool operator==(const Rectangle& other) const noexcept
 		{
@@ -0,0 +1,91 @@
+/*
+* MIT License
+*
+* Copyright (c) 2024 Edgar Bernal (edgar.bernal@gmail.com)
+*/
+
+#ifndef BT_CANCELLATION_TOKEN_HEADER
+#define BT_CANCELLATION_TOKEN_HEADER
+
+#include <atomic>
+#include <memory>
+
+namespace Berta
+{
+	namespace Detail
+	{
+		struct CancellationState
+		{
+			std::atomic_bool Cancelled{ false };
+			std::shared_ptr<CancellationState> Parent; // Cancelling the parent cancels this one too.
+
+			bool IsCancelled() const
+			{
+				for (auto state = this; state; state = state->Parent.get())
+				{
+					if (state->Cancelled.load(std::memory_order_acquire))
+					{
+						return true;
+					}
+				}
+				return false;
+			}
+		};
+	}
+
+	/*
+	* Read side of a CancellationSource. Cheap to copy and safe to poll from any thread.
+	* A default constructed token is never cancelled.
+	*/
+	class CancellationToken
+	{
+	public:
+		CancellationToken() = default;
+		explicit CancellationToken(std::shared_ptr<Detail::CancellationState> state) : m_state(std::move(state)) {}
+
+		bool IsCancelled() const { return m_state && m_state->IsCancelled(); }
+		bool CanBeCancelled() const { return m_state != nullptr; }
+
+	private:
+		friend class CancellationSource;
+		std::shared_ptr<Detail::CancellationState> m_state;
+	};
+
+	class CancellationSource
+	{
+	public:
+		CancellationSource() = default;
+
+		// The new source is cancelled with the parent token, or on its own Cancel.
+		explicit CancellationSource(const CancellationToken& parent)
+		{
+			m_state = std::make_shared<Detail::CancellationState>();
+			m_state->Parent = parent.m_state;
+		}
+
+		void Cancel()
+		{
+			if (m_state)
+			{
+				m_state->Cancelled.store(true, std::memory_order_release);
+			}
+		}
+
+		bool IsCancelled() const { return m_state && m_state->IsCancelled(); }
+
+		// The shared state is only allocated when somebody asks for a token.
+		CancellationToken GetToken()
+		{
+			if (!m_state)
+			{
+				m_state = std::make_shared<Detail::CancellationState>();
+			}
+			return CancellationToken(m_state);
+		}
+
+	private:
+		std::shared_ptr<Detail::CancellationState> m_state;
+	};
+}
+
+#endif
\ No newline at end of file
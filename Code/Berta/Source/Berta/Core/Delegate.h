@@ -0,0 +1,186 @@
+/*
+* MIT License
+*
+* Copyright (c) 2024 Edgar Bernal (edgar.bernal@gmail.com)
+*/
+
+#ifndef BT_DELEGATE_HEADER
+#define BT_DELEGATE_HEADER
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace Berta
+{
+	template <typename Signature>
+	class Delegate;
+
+	/*
+	* Move-only replacement for std::function. Callables up to InlineSize bytes (a lambda capturing
+	* a few pointers/values) are stored in place, bigger ones fall back to the heap.
+	*/
+	template <typename Result, typename... Args>
+	class Delegate<Result(Args...)>
+	{
+	public:
+		static constexpr std::size_t InlineSize = 4 * sizeof(void*);
+
+		Delegate() = default;
+		Delegate(std::nullptr_t) {}
+
+		template <typename Callable,
+			typename = std::enable_if_t<
+				!std::is_same_v<std::decay_t<Callable>, Delegate> &&
+				std::is_invocable_r_v<Result, std::decay_t<Callable>&, Args...>>>
+		Delegate(Callable&& callable)
+		{
+			using Stored = std::decay_t<Callable>;
+			if constexpr (std::is_pointer_v<Stored> || std::is_member_pointer_v<Stored>)
+			{
+				if (callable == nullptr)
+				{
+					return;
+				}
+			}
+
+			if constexpr (IsInline<Stored>())
+			{
+				new (m_storage) Stored(std::forward<Callable>(callable));
+			}
+			else
+			{
+				*reinterpret_cast<Stored**>(m_storage) = new Stored(std::forward<Callable>(callable));
+			}
+			m_operations = &OperationsFor<Stored>::Table;
+		}
+
+		Delegate(Delegate&& other) noexcept
+		{
+			MoveFrom(other);
+		}
+
+		Delegate& operator=(Delegate&& other) noexcept
+		{
+			if (this != &other)
+			{
+				Reset();
+				MoveFrom(other);
+			}
+			return *this;
+		}
+
+		Delegate& operator=(std::nullptr_t)
+		{
+			Reset();
+			return *this;
+		}
+
+		Delegate(const Delegate&) = delete;
+		Delegate& operator=(const Delegate&) = delete;
+
+		~Delegate()
+		{
+			Reset();
+		}
+
+		Result operator()(Args... args) const
+		{
+			return m_operations->Invoke(m_storage, std::forward<Args>(args)...);
+		}
+
+		explicit operator bool() const { return m_operations != nullptr; }
+
+		void Reset()
+		{
+			if (m_operations)
+			{
+				m_operations->Destroy(m_storage);
+				m_operations = nullptr;
+			}
+		}
+
+	private:
+		struct Operations
+		{
+			Result(*Invoke)(void* storage, Args&&... args);
+			void(*Move)(void* destination, void* source);
+			void(*Destroy)(void* storage);
+		};
+
+		template <typename Stored>
+		static constexpr bool IsInline()
+		{
+			return sizeof(Stored) <= InlineSize &&
+				alignof(Stored) <= alignof(std::max_align_t) &&
+				std::is_nothrow_move_constructible_v<Stored>;
+		}
+
+		template <typename Stored>
+		static Stored* Get(void* storage)
+		{
+			if constexpr (IsInline<Stored>())
+			{
+				return std::launder(reinterpret_cast<Stored*>(storage));
+			}
+			else
+			{
+				return *reinterpret_cast<Stored**>(storage);
+			}
+		}
+
+		template <typename Stored>
+		struct OperationsFor
+		{
+			static Result Invoke(void* storage, Args&&... args)
+			{
+				return (*Get<Stored>(storage))(std::forward<Args>(args)...);
+			}
+
+			static void Move(void* destination, void* source)
+			{
+				if constexpr (IsInline<Stored>())
+				{
+					auto sourceObject = Get<Stored>(source);
+					new (destination) Stored(std::move(*sourceObject));
+					sourceObject->~Stored();
+				}
+				else
+				{
+					*reinterpret_cast<Stored**>(destination) = *reinterpret_cast<Stored**>(source);
+				}
+			}
+
+			static void Destroy(void* storage)
+			{
+				if constexpr (IsInline<Stored>())
+				{
+					Get<Stored>(storage)->~Stored();
+				}
+				else
+				{
+					delete Get<Stored>(storage);
+				}
+			}
+
+			static constexpr Operations Table{ &Invoke, &Move, &Destroy };
+		};
+
+		void MoveFrom(Delegate& other)
+		{
+			if (other.m_operations)
+			{
+				other.m_operations->Move(m_storage, other.m_storage);
+				m_operations = other.m_operations;
+				other.m_operations = nullptr;
+			}
+		}
+
+		// Mutable, like std::function: a const delegate can still call a stateful callable.
+		alignas(std::max_align_t) mutable unsigned char m_storage[InlineSize];
+		const Operations* m_operations{ nullptr };
+	};
+}
+
+#endif
\ No newline at end of file
@@ -9,5 +9,227 @@
 
 namespace Berta
 {
+	void EventStorage::AddReference()
+	{
+		m_referenceCount.fetch_add(1, std::memory_order_relaxed);
+	}
 
+	void EventStorage::Release()
+	{
+		if (m_referenceCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+		{
+			Reset();
+			ReleaseWeak();
+		}
+	}
+
+	void EventStorage::AddWeakReference()
+	{
+		m_weakReferenceCount.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	void EventStorage::ReleaseWeak()
+	{
+		if (m_weakReferenceCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+		{
+			delete this;
+		}
+	}
+
+	void EventStorage::Disconnect(EventHandlerId id)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		auto node = Find(id);
+		if (node == nullptr)
+		{
+			return;
+		}
+
+		Unregister(*node);
+		CompactIfNeeded();
+	}
+
+	void EventStorage::DisconnectAll(EventOwner owner)
+	{
+		if (owner == NoEventOwner)
+		{
+			return;
+		}
+
+		std::lock_guard<std::mutex> lock(m_mutex);
+		for (auto& slot : m_slots)
+		{
+			if (slot.Node && slot.Node->Owner == owner)
+			{
+				Unregister(*slot.Node);
+			}
+		}
+		CompactIfNeeded();
+	}
+
+	void EventStorage::Reset()
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		for (auto& slot : m_slots)
+		{
+			if (slot.Node)
+			{
+				Unregister(*slot.Node);
+			}
+		}
+		Compact();
+	}
+
+	bool EventStorage::IsConnected(EventHandlerId id)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		return Find(id) != nullptr;
+	}
+
+	EventHandlerId EventStorage::Register(HandlerNode& node)
+	{
+		uint32_t index = m_freeSlot;
+		if (index != InvalidSlot)
+		{
+			m_freeSlot = m_slots[index].NextFree;
+		}
+		else
+		{
+			index = static_cast<uint32_t>(m_slots.size());
+			m_slots.emplace_back();
+		}
+
+		auto& slot = m_slots[index];
+		slot.Node = &node;
+		slot.NextFree = InvalidSlot;
+
+		node.Id = (static_cast<EventHandlerId>(slot.Generation) << 32) | index;
+		m_connectedCount.fetch_add(1, std::memory_order_release);
+		return node.Id;
+	}
+
+	void EventStorage::Published(size_t size)
+	{
+		m_publishedCount = size;
+		m_disconnectedCount = 0;
+	}
+
+	EventStorage::HandlerNode* EventStorage::Find(EventHandlerId id) const
+	{
+		auto index = static_cast<uint32_t>(id & UINT32_MAX);
+		auto generation = static_cast<uint32_t>(id >> 32);
+		if (index >= m_slots.size() || m_slots[index].Generation != generation)
+		{
+			return nullptr;
+		}
+
+		return m_slots[index].Node;
+	}
+
+	void EventStorage::Unregister(HandlerNode& node)
+	{
+		// An emit already iterating the published list must skip it.
+		node.Connected.store(false);
+
+		auto index = static_cast<uint32_t>(node.Id & UINT32_MAX);
+		auto& slot = m_slots[index];
+		slot.Node = nullptr;
+		if (++slot.Generation == 0)
+		{
+			slot.Generation = 1;
+		}
+		slot.NextFree = m_freeSlot;
+		m_freeSlot = index;
+
+		m_connectedCount.fetch_sub(1, std::memory_order_release);
+		++m_disconnectedCount;
+	}
+
+	void EventStorage::CompactIfNeeded()
+	{
+		// The list is rebuilt once half of it is dead, so Disconnect stays O(1) amortized.
+		if (m_disconnectedCount > 0 && m_disconnectedCount * 2 >= m_publishedCount)
+		{
+			Compact();
+		}
+	}
+
+	EventStorage::EmitScope::EmitScope(EventStorage* storage) :
+		m_storage(storage)
+	{
+		// The weak reference keeps the storage if a handler destroys the last Event. The increment is
+		// sequentially consistent so it is ordered before loading the list (see Event::Data::Publish).
+		m_storage->AddWeakReference();
+		m_storage->m_emitting.fetch_add(1);
+	}
+
+	EventStorage::EmitScope::~EmitScope()
+	{
+		m_storage->m_emitting.fetch_sub(1, std::memory_order_release);
+		m_storage->ReleaseWeak();
+	}
+
+	ScopedConnection::ScopedConnection(EventStorage* storage, EventHandlerId id) :
+		m_storage(storage),
+		m_id(id)
+	{
+		if (m_storage)
+		{
+			m_storage->AddWeakReference();
+		}
+	}
+
+	ScopedConnection::~ScopedConnection()
+	{
+		Disconnect();
+	}
+
+	ScopedConnection::ScopedConnection(ScopedConnection&& other) noexcept :
+		m_storage(other.m_storage),
+		m_id(other.m_id)
+	{
+		other.m_storage = nullptr;
+		other.m_id = InvalidEventHandlerId;
+	}
+
+	ScopedConnection& ScopedConnection::operator=(ScopedConnection&& other) noexcept
+	{
+		if (this != &other)
+		{
+			Disconnect();
+			m_storage = other.m_storage;
+			m_id = other.m_id;
+			other.m_storage = nullptr;
+			other.m_id = InvalidEventHandlerId;
+		}
+		return *this;
+	}
+
+	void ScopedConnection::Disconnect()
+	{
+		if (m_storage)
+		{
+			m_storage->Disconnect(m_id);
+			m_storage->ReleaseWeak();
+			m_storage = nullptr;
+		}
+		m_id = InvalidEventHandlerId;
+	}
+
+	EventHandlerId ScopedConnection::Release()
+	{
+		auto id = m_id;
+		if (m_storage)
+		{
+			m_storage->ReleaseWeak();
+			m_storage = nullptr;
+		}
+		m_id = InvalidEventHandlerId;
+		return id;
+	}
+
+	bool ScopedConnection::IsConnected() const
+	{
+		return m_storage && m_storage->IsConnected(m_id);
+	}
 }
\ No newline at end of file
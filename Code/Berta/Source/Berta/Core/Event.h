@@ -7,129 +7,407 @@
 #ifndef BT_EVENT_HEADER
 #define BT_EVENT_HEADER
 
-#include <functional>
+#include <atomic>
+#include <cstdint>
 #include <memory>
 #include <vector>
-#include <algorithm>
 #include <mutex>
 
+#include "Berta/Core/Delegate.h"
+
 namespace Berta
 {
-    using EventHandlerId = size_t;
+    // Slot index in the low 32 bits, slot generation in the high ones. A stale id never matches a reused slot.
+    using EventHandlerId = uint64_t;
+    constexpr EventHandlerId InvalidEventHandlerId = 0;
+
+    // Key for Event::DisconnectAll. GUI uses the WindowHandle of the window the handler belongs to.
+    using EventOwner = uint64_t;
+    constexpr EventOwner NoEventOwner = 0;
+
+    /*
+    * Type independent part of an Event's handler storage: reference count and the slot map that
+    * resolves EventHandlerIds, so Disconnect doesn't have to search the handler list.
+    */
+    class EventStorage
+    {
+    public:
+        virtual ~EventStorage() = default;
+
+        // Events hold strong references, ScopedConnections weak ones: handlers go away with the last Event.
+        void AddReference();
+        void Release();
+        void AddWeakReference();
+        void ReleaseWeak();
+
+        void Disconnect(EventHandlerId id);
+        void DisconnectAll(EventOwner owner);
+        void Reset();
+
+        bool IsConnected(EventHandlerId id);
+        size_t Length() const { return m_connectedCount.load(std::memory_order_acquire); }
+
+        /*
+        * Keeps the storage and the published handler list alive while an Emit walks it. Two atomic
+        * increments, no lock: writers only free a replaced list when no emit is running.
+        */
+        class EmitScope
+        {
+        public:
+            explicit EmitScope(EventStorage* storage);
+            ~EmitScope();
+
+            EmitScope(const EmitScope&) = delete;
+            EmitScope& operator=(const EmitScope&) = delete;
+
+        private:
+            EventStorage* m_storage;
+        };
+
+        struct HandlerNode
+        {
+            EventHandlerId Id{ InvalidEventHandlerId };
+            EventOwner Owner{ NoEventOwner };
+            std::atomic_bool Connected{ true };
+            struct
+            {
+                bool Once : 1;
+                bool Triggered : 1;
+            }Flags{};
+        };
+
+    protected:
+        EventHandlerId Register(HandlerNode& node);
+        void Published(size_t size);
+        // Call after swapping the published list, a running emit may still hold the previous one.
+        bool IsEmitting() const { return m_emitting.load() != 0; }
+
+        // Publishes a new list without the disconnected handlers.
+        virtual void Compact() = 0;
+
+        std::mutex m_mutex;
+
+    private:
+        static constexpr uint32_t InvalidSlot = UINT32_MAX;
+
+        struct Slot
+        {
+            HandlerNode* Node{ nullptr };
+            uint32_t Generation{ 1 };
+            uint32_t NextFree{ InvalidSlot };
+        };
+
+        HandlerNode* Find(EventHandlerId id) const;
+        void Unregister(HandlerNode& node);
+        void CompactIfNeeded();
+
+        std::vector<Slot> m_slots;
+        uint32_t m_freeSlot{ InvalidSlot };
+        size_t m_publishedCount{ 0 };
+        size_t m_disconnectedCount{ 0 }; // Dead entries still in the published list.
+
+        std::atomic<size_t> m_referenceCount{ 1 }; // Copies of an Event share the same handlers.
+        std::atomic<size_t> m_weakReferenceCount{ 1 }; // One for all the strong references.
+        std::atomic<size_t> m_connectedCount{ 0 }; // Lets Emit bail out without touching the list.
+        std::atomic<size_t> m_emitting{ 0 }; // Emits walking a published list, see EmitScope.
+
+        static_assert(std::atomic<size_t>::is_always_lock_free && std::atomic<const void*>::is_always_lock_free,
+            "Event::Emit relies on lock-free atomics.");
+    };
+
+    /*
+    * Move-only connection handle, it disconnects the handler when it goes out of scope.
+    */
+    class ScopedConnection
+    {
+    public:
+        ScopedConnection() = default;
+        ScopedConnection(EventStorage* storage, EventHandlerId id);
+        ~ScopedConnection();
+
+        ScopedConnection(ScopedConnection&& other) noexcept;
+        ScopedConnection& operator=(ScopedConnection&& other) noexcept;
+
+        ScopedConnection(const ScopedConnection&) = delete;
+        ScopedConnection& operator=(const ScopedConnection&) = delete;
+
+        void Disconnect();
+        EventHandlerId Release(); // Keeps the handler connected and forgets about it.
+
+        bool IsConnected() const;
+        EventHandlerId GetId() const { return m_id; }
+
+    private:
+        EventStorage* m_storage{ nullptr };
+        EventHandlerId m_id{ InvalidEventHandlerId };
+    };
 
     template <typename Argument>
     class Event
     {
     public:
-        using Handler = std::function<void(const Argument&)>;
+        using Handler = Delegate<void(const Argument&)>;
 
     public:
-        Event() : m_data(std::make_shared<Data>()) {}
-        Event(Event&& other) : Event() { *this = std::move(other); }
-        Event(const Event&) = default;
+        // The handler storage is only allocated on the first Connect, most events never get one.
+        Event() = default;
+        Event(Event&& other) noexcept : m_data(other.m_data.exchange(nullptr)) {}
+        Event(const Event& other) : m_data(other.AcquireData()) {}
+
+        Event& operator=(const Event& other)
+        {
+            if (this != &other)
+            {
+                ReleaseData(m_data.exchange(other.AcquireData()));
+            }
+            return *this;
+        }
 
-        Event& operator=(const Event&) = default;
-        Event& operator=(Event&& other)
+        Event& operator=(Event&& other) noexcept
         {
-            std::swap(m_data, other.m_data);
+            auto data = m_data.load();
+            m_data.store(other.m_data.load());
+            other.m_data.store(data);
             return *this;
         }
 
+        ~Event()
+        {
+            ReleaseData(m_data.load());
+        }
+
     private:
-        struct StoredHandler
+        struct StoredHandler : public EventStorage::HandlerNode
         {
-            EventHandlerId Id;
-            std::shared_ptr<Handler> Callback;
-            struct
-            {
-                bool Once : 1;
-                bool Triggered : 1;
-            }Flags;
+            Handler Callback;
         };
 
-        using HandlerList = std::vector<StoredHandler>;
+        // Immutable once published. Connect/Disconnect build a new list under the mutex and swap the
+        // pointer, Emit walks the current one inside an EmitScope (no lock, no allocation).
+        // std::atomic<std::shared_ptr> is not lock-free in MSVC's STL nor in libstdc++.
+        using HandlerList = std::vector<std::shared_ptr<StoredHandler>>;
 
-        struct Data
+        class Data : public EventStorage
         {
-            EventHandlerId IdCounter = 0;
-            HandlerList Observers;
-            std::mutex ObserverMutex;
+        public:
+            ~Data() override
+            {
+                // Emits pin the storage, none is running anymore.
+                delete m_observers.load(std::memory_order_relaxed);
+                FreeRetired();
+            }
+
+            EventHandlerId Add(Handler&& handler, EventOwner owner, bool once, bool front)
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+
+                auto stored = std::make_shared<StoredHandler>();
+                stored->Callback = std::move(handler);
+                stored->Owner = owner;
+                stored->Flags.Once = once;
+                auto id = Register(*stored);
+
+                auto current = m_observers.load(std::memory_order_relaxed);
+                auto observers = std::make_unique<HandlerList>();
+                observers->reserve((current ? current->size() : 0) + 1);
+                if (front)
+                {
+                    observers->emplace_back(std::move(stored));
+                }
+                CopyConnected(current, *observers);
+                if (!front)
+                {
+                    observers->emplace_back(std::move(stored));
+                }
+
+                Publish(std::move(observers));
+                return id;
+            }
+
+            const HandlerList* GetObservers() const
+            {
+                return m_observers.load(); // Sequentially consistent with the EmitScope increment.
+            }
+
+        protected:
+            void Compact() override
+            {
+                auto current = m_observers.load(std::memory_order_relaxed);
+                if (!current)
+                {
+                    return;
+                }
+
+                auto observers = std::make_unique<HandlerList>();
+                CopyConnected(current, *observers);
+                Publish(std::move(observers));
+            }
+
+        private:
+            static void CopyConnected(const HandlerList* source, HandlerList& target)
+            {
+                if (!source)
+                {
+                    return;
+                }
+
+                for (auto& observer : *source)
+                {
+                    if (observer->Connected.load(std::memory_order_relaxed))
+                    {
+                        target.emplace_back(observer);
+                    }
+                }
+            }
+
+            void Publish(std::unique_ptr<HandlerList> observers)
+            {
+                Published(observers->size());
+                if (observers->empty())
+                {
+                    observers.reset();
+                }
+
+                if (auto previous = m_observers.exchange(observers.release()))
+                {
+                    m_retired.push_back(previous);
+                }
+
+                // An emit that starts after the exchange sees the new list. If none is running now,
+                // nobody can be walking the replaced ones.
+                if (!IsEmitting())
+                {
+                    FreeRetired();
+                }
+            }
+
+            void FreeRetired()
+            {
+                for (auto observers : m_retired)
+                {
+                    delete observers;
+                }
+                m_retired.clear();
+            }
+
+            std::atomic<const HandlerList*> m_observers{ nullptr };
+            std::vector<const HandlerList*> m_retired; // Replaced lists, freed by the next write with no emit running.
         };
 
-        std::shared_ptr<Data> m_data;
+        mutable std::atomic<Data*> m_data{ nullptr };
+
+        Data* GetOrCreateData() const
+        {
+            auto data = m_data.load(std::memory_order_acquire);
+            if (data)
+            {
+                return data;
+            }
+
+            auto newData = new Data();
+            if (m_data.compare_exchange_strong(data, newData, std::memory_order_acq_rel))
+            {
+                return newData;
+            }
+
+            delete newData;
+            return data;
+        }
 
-        EventHandlerId AddHandler(Handler handler, bool once = false) const
+        Data* AcquireData() const
         {
-            std::lock_guard<std::mutex> lock(m_data->ObserverMutex);
-            m_data->Observers.emplace_back(StoredHandler{ m_data->IdCounter, std::make_shared<Handler>(handler), {once, false} });
-            return m_data->IdCounter++;
+            auto data = GetOrCreateData();
+            data->AddReference();
+            return data;
         }
 
-        EventHandlerId AddFrontHandler(Handler handler, bool once = false) const
+        static void ReleaseData(Data* data)
         {
-            std::lock_guard<std::mutex> lock(m_data->ObserverMutex);
-            m_data->Observers.emplace(m_data->Observers.begin(), StoredHandler{ m_data->IdCounter, std::make_shared<Handler>(handler), {once, false} });
-            return m_data->IdCounter++;
+            if (data)
+            {
+                data->Release();
+            }
         }
 
     public:
-        EventHandlerId Connect(const Handler& handler) const
+        // The owner is only used as a key for DisconnectAll.
+        EventHandlerId Connect(Handler handler, EventOwner owner = NoEventOwner) const
         {
-            return AddHandler(handler);
+            return GetOrCreateData()->Add(std::move(handler), owner, false, false);
         }
 
-        EventHandlerId ConnectFront(const Handler& handler) const
+        EventHandlerId ConnectFront(Handler handler, EventOwner owner = NoEventOwner) const
         {
-            return AddFrontHandler(handler);
+            return GetOrCreateData()->Add(std::move(handler), owner, false, true);
         }
 
-        EventHandlerId ConnectOnce(const Handler& handler) const
+        EventHandlerId ConnectOnce(Handler handler, EventOwner owner = NoEventOwner) const
         {
-            return AddHandler(handler, true);
+            return GetOrCreateData()->Add(std::move(handler), owner, true, false);
+        }
+
+        [[nodiscard]] ScopedConnection ConnectScoped(Handler handler) const
+        {
+            auto data = GetOrCreateData();
+            return ScopedConnection(data, data->Add(std::move(handler), NoEventOwner, false, false));
         }
 
         void Disconnect(EventHandlerId id) const
         {
-            std::lock_guard<std::mutex> lock(m_data->ObserverMutex);
-            auto it = std::find_if(m_data->Observers.begin(), m_data->Observers.end(),
-                [&](auto& observer)
-                {
-                    return observer.Id == id;
-                });
+            if (auto data = m_data.load(std::memory_order_acquire))
+            {
+                data->Disconnect(id);
+            }
+        }
 
-            if (it != m_data->Observers.end())
+        void DisconnectAll(EventOwner owner) const
+        {
+            if (auto data = m_data.load(std::memory_order_acquire))
             {
-                m_data->Observers.erase(it);
+                data->DisconnectAll(owner);
             }
         }
 
         size_t Length() const
         {
-            std::lock_guard<std::mutex> lock(m_data->ObserverMutex);
-            return m_data->Observers.size();
+            auto data = m_data.load(std::memory_order_acquire);
+            return data ? data->Length() : 0;
+        }
+
+        bool HasHandlers() const
+        {
+            return Length() != 0;
         }
 
         void Reset() const
         {
-            std::lock_guard<std::mutex> lock(m_data->ObserverMutex);
-            m_data->Observers.clear();
+            if (auto data = m_data.load(std::memory_order_acquire))
+            {
+                data->Reset();
+            }
         }
 
         void Emit(Argument& args) const
         {
-            std::vector<std::weak_ptr<Handler>> handlers;
+            auto data = m_data.load(std::memory_order_acquire);
+            if (!data || data->Length() == 0)
+            {
+                return;
+            }
+
+            // Handlers connected during this emit are not called, disconnected ones are skipped.
+            EventStorage::EmitScope scope(data);
+            auto observers = data->GetObservers();
+            if (!observers)
             {
-                std::lock_guard<std::mutex> lock(m_data->ObserverMutex);
-                handlers.resize(m_data->Observers.size());
-                std::transform(m_data->Observers.begin(), m_data->Observers.end(), handlers.begin(),
-                    [](auto& h) { return h.Callback; });
+                return;
             }
 
-            for (auto& weakCallback : handlers)
+            for (auto& observer : *observers)
             {
-                if (auto callback = weakCallback.lock())
+                if (observer->Connected.load(std::memory_order_acquire))
                 {
-                    (*callback)(args);
+                    observer->Callback(args);
                 }
             }
         }
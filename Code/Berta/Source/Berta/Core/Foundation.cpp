@@ -14,6 +14,18 @@ namespace Berta
 		return g_foundation;
 	}
 
+	void Foundation::QueueInput(const InputEvent& inputEvent)
+	{
+		// One flush per batch of native messages: the task runs once the native queue is drained.
+		if (m_inputQueue.Push(inputEvent))
+		{
+			m_messageLoop.PostTask([this]()
+			{
+				m_inputQueue.Flush();
+			});
+		}
+	}
+
 	Foundation::RootGuard::RootGuard(Window* window) : m_window(window)
 	{
 		++m_window->Flags.IsDeferredCount;
@@ -10,8 +10,14 @@
 #include "Berta/GUI/WindowManager.h"
 #include "Berta/GUI/Renderer.h"
 #include "Berta/Core/Event.h"
+#include "Berta/Core/IdleScheduler.h"
+#include "Berta/Core/MessageLoop.h"
+#include "Berta/Core/ThreadPool.h"
+#include "Berta/Core/TimerWheel.h"
 #include "Berta/GUI/Window.h"
 #include "Berta/GUI/ControlEvents.h"
+#include "Berta/GUI/FrameScheduler.h"
+#include "Berta/GUI/InputQueue.h"
 
 #include <functional>
 
@@ -36,6 +42,13 @@ namespace Berta
 		Foundation& operator=(const Foundation&) = delete;
 
 		WindowManager& GetWindowManager() { return m_windowManager; }
+		MessageLoop& GetMessageLoop() { return m_messageLoop; }
+		TimerWheel& GetTimerWheel() { return m_timerWheel; }
+		IdleScheduler& GetIdleScheduler() { return m_idleScheduler; }
+		InputQueue& GetInputQueue() { return m_inputQueue; }
+		FrameScheduler& GetFrameScheduler() { return m_frameScheduler; }
+		ThreadPool& GetThreadPool() { return m_threadPool; }
+		void QueueInput(const InputEvent& inputEvent);
 		void ProcessMessages();
 
 		template <typename TArgument>
@@ -53,7 +66,13 @@ namespace Berta
 		};
 	private:
 		static Foundation g_foundation;
+		TimerWheel m_timerWheel;
+		MessageLoop m_messageLoop;
+		IdleScheduler m_idleScheduler{ m_messageLoop, m_timerWheel };
+		InputQueue m_inputQueue;
 		WindowManager m_windowManager;
+		FrameScheduler m_frameScheduler{ m_windowManager, m_timerWheel };
+		ThreadPool m_threadPool; // Last: workers are joined before anything they may post to goes away.
 	};
 
 	template<typename TArgument>
@@ -70,9 +89,13 @@ namespace Berta
 			(window->Renderer.*rendererEventPtr)(args);
 		}
 		
-		if (eventPtr)
+		if (eventPtr && window->Events)
 		{
-			(*window->Events.*eventPtr).Emit(args);
+			auto& event = (*window->Events.*eventPtr);
+			if (event.HasHandlers())
+			{
+				event.Emit(args);
+			}
 		}
 
 		if (!m_windowManager.Exists(window))
@@ -81,6 +104,10 @@ namespace Berta
 		}
 
 		bool isResizing = std::is_same_v<TArgument, ArgResize>;
+		if (isResizing)
+		{
+			window->DamageArea = window->ClientSize.ToRectangle();
+		}
 		if (window->IsVisible() && (window->DrawStatus == DrawWindowStatus::NeedUpdate || isResizing))
 		{
 			if (window->Type != WindowType::Panel && window->IsBatchActive())
@@ -0,0 +1,206 @@
+/*
+* MIT License
+*
+* Copyright (c) 2024 Edgar Bernal (edgar.bernal@gmail.com)
+*/
+
+#include "btpch.h"
+#include "IdleScheduler.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace Berta
+{
+	IdleScheduler::IdleScheduler(MessageLoop& messageLoop, TimerWheel& timerWheel) :
+		m_messageLoop(messageLoop),
+		m_timerWheel(timerWheel)
+	{
+		m_deadlineTimer.Callback = [this]()
+		{
+			RunOverdue();
+		};
+	}
+
+	IdleScheduler::~IdleScheduler()
+	{
+		m_timerWheel.Cancel(m_deadlineTimer);
+		if (m_isIdleHandlerRegistered)
+		{
+			m_messageLoop.RemoveIdleHandler(m_idleHandlerId);
+		}
+	}
+
+	IdleTaskId IdleScheduler::Schedule(Task task, std::chrono::milliseconds deadline)
+	{
+		if (!task)
+		{
+			return InvalidIdleTaskId;
+		}
+
+		if (!m_isIdleHandlerRegistered)
+		{
+			m_idleHandlerId = m_messageLoop.AddIdleHandler([this]()
+			{
+				return RunIdle();
+			});
+			m_isIdleHandlerRegistered = true;
+		}
+
+		Entry entry;
+		entry.Id = m_nextId++;
+		entry.Callback = std::move(task);
+		if (deadline.count() >= 0)
+		{
+			entry.Deadline = Clock::now() + deadline;
+		}
+
+		auto id = entry.Id;
+		m_tasks.emplace_back(std::move(entry));
+		++m_statistics.Scheduled;
+
+		UpdateDeadlineTimer();
+		return id;
+	}
+
+	void IdleScheduler::Cancel(IdleTaskId id)
+	{
+		if (id == InvalidIdleTaskId)
+		{
+			return;
+		}
+
+		if (id == m_runningId)
+		{
+			m_runningCancelled = true;
+			return;
+		}
+
+		auto it = std::find_if(m_tasks.begin(), m_tasks.end(), [id](const Entry& entry)
+		{
+			return entry.Id == id;
+		});
+
+		if (it != m_tasks.end())
+		{
+			m_tasks.erase(it);
+			UpdateDeadlineTimer();
+		}
+	}
+
+	bool IdleScheduler::RunIdle()
+	{
+		if (m_tasks.empty())
+		{
+			return false;
+		}
+
+		++m_statistics.Slices;
+
+		IdleDeadline deadline;
+		deadline.SliceEnd = Clock::now() + IdleSlice;
+
+		// Round robin: a task that wants more time goes to the back of the queue.
+		size_t budget = m_tasks.size();
+		while (budget-- > 0 && !m_tasks.empty())
+		{
+			if (Clock::now() >= deadline.SliceEnd || m_messageLoop.HasPendingWork())
+			{
+				++m_statistics.Yields;
+				break;
+			}
+
+			auto entry = std::move(m_tasks.front());
+			m_tasks.pop_front();
+
+			m_runningId = entry.Id;
+			m_runningCancelled = false;
+			bool hasMoreWork = entry.Callback(deadline);
+			++m_statistics.Runs;
+			m_runningId = InvalidIdleTaskId;
+
+			if (hasMoreWork && !m_runningCancelled)
+			{
+				m_tasks.emplace_back(std::move(entry));
+			}
+		}
+
+		UpdateDeadlineTimer();
+		return !m_tasks.empty();
+	}
+
+	void IdleScheduler::RunOverdue()
+	{
+		IdleDeadline deadline;
+		deadline.SliceEnd = Clock::now();
+		deadline.DidTimeout = true;
+
+		// Only the tasks overdue now, and each one once: one that still returns true goes back to the queue
+		// (still overdue) and gets its next forced call from the next timer expiry, after the pending input.
+		std::vector<IdleTaskId> overdue;
+		for (auto& entry : m_tasks)
+		{
+			if (entry.Deadline <= deadline.SliceEnd)
+			{
+				overdue.push_back(entry.Id);
+			}
+		}
+
+		for (auto id : overdue)
+		{
+			auto it = std::find_if(m_tasks.begin(), m_tasks.end(), [id](const Entry& entry)
+			{
+				return entry.Id == id;
+			});
+
+			if (it == m_tasks.end())
+			{
+				continue; // Cancelled by a task that ran before.
+			}
+
+			auto entry = std::move(*it);
+			m_tasks.erase(it);
+
+			m_runningId = entry.Id;
+			m_runningCancelled = false;
+			bool hasMoreWork = entry.Callback(deadline);
+			++m_statistics.Runs;
+			++m_statistics.ForcedRuns;
+			m_runningId = InvalidIdleTaskId;
+
+			if (hasMoreWork && !m_runningCancelled)
+			{
+				m_tasks.emplace_back(std::move(entry));
+			}
+		}
+
+		UpdateDeadlineTimer();
+	}
+
+	void IdleScheduler::UpdateDeadlineTimer()
+	{
+		auto earliest = Clock::time_point::max();
+		for (auto& entry : m_tasks)
+		{
+			earliest = (std::min)(earliest, entry.Deadline);
+		}
+
+		if (earliest == Clock::time_point::max())
+		{
+			m_timerWheel.Cancel(m_deadlineTimer);
+			return;
+		}
+
+		// The wheel rounds expiries up to the next millisecond.
+		if (m_deadlineTimer.IsScheduled())
+		{
+			auto expiry = m_timerWheel.GetExpiry(m_deadlineTimer);
+			if (expiry >= earliest && expiry - earliest < std::chrono::milliseconds(1))
+			{
+				return;
+			}
+		}
+
+		m_timerWheel.ScheduleAt(m_deadlineTimer, earliest);
+	}
+}
\ No newline at end of file
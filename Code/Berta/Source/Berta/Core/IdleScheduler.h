@@ -0,0 +1,116 @@
+/*
+* MIT License
+*
+* Copyright (c) 2024 Edgar Bernal (edgar.bernal@gmail.com)
+*/
+
+#ifndef BT_IDLE_SCHEDULER_HEADER
+#define BT_IDLE_SCHEDULER_HEADER
+
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include "Berta/Core/Delegate.h"
+#include "Berta/Core/MessageLoop.h"
+#include "Berta/Core/TimerWheel.h"
+
+namespace Berta
+{
+	/*
+	* Given to idle tasks so they can split their work in chunks.
+	*/
+	struct IdleDeadline
+	{
+		using Clock = std::chrono::steady_clock;
+
+		Clock::time_point SliceEnd;
+		bool DidTimeout{ false };	// Forced run: the task's deadline passed, finish the work now.
+
+		std::chrono::microseconds TimeRemaining() const
+		{
+			if (DidTimeout)
+			{
+				return std::chrono::microseconds::max();
+			}
+
+			auto now = Clock::now();
+			return now < SliceEnd ? std::chrono::duration_cast<std::chrono::microseconds>(SliceEnd - now) : std::chrono::microseconds{ 0 };
+		}
+
+		bool ShouldYield() const
+		{
+			return !DidTimeout && Clock::now() >= SliceEnd;
+		}
+	};
+
+	using IdleTaskId = uint64_t;
+	constexpr IdleTaskId InvalidIdleTaskId = 0;
+
+	/*
+	* Runs queued tasks while the message loop has nothing else to do (no input, paint, posted tasks or timers),
+	* in slices of at most IdleSlice. A task whose deadline passes is called from a timer with
+	* IdleDeadline::DidTimeout set.
+	*
+	* Task contract: do a chunk of work, check IdleDeadline::ShouldYield between chunks and return true while
+	* work is left. On a forced call (DidTimeout) the task should finish; if it still returns true it is called
+	* once per timer expiry (about once a millisecond), never in a loop, so the message loop keeps running.
+	* UI thread only.
+	*/
+	class IdleScheduler
+	{
+	public:
+		using Clock = std::chrono::steady_clock;
+		using Task = Delegate<bool(const IdleDeadline&)>; // Returns true to be called again with the next slice.
+
+		static constexpr std::chrono::milliseconds IdleSlice{ 8 };
+		static constexpr std::chrono::milliseconds NoDeadline{ -1 };
+
+		struct Statistics
+		{
+			uint64_t Scheduled{ 0 };
+			uint64_t Slices{ 0 };
+			uint64_t Runs{ 0 };
+			uint64_t ForcedRuns{ 0 };
+			uint64_t Yields{ 0 };
+		};
+
+		IdleScheduler(MessageLoop& messageLoop, TimerWheel& timerWheel);
+		~IdleScheduler();
+
+		IdleScheduler(const IdleScheduler&) = delete;
+		IdleScheduler& operator=(const IdleScheduler&) = delete;
+
+		IdleTaskId Schedule(Task task, std::chrono::milliseconds deadline = NoDeadline);
+		void Cancel(IdleTaskId id);
+
+		size_t GetPendingCount() const { return m_tasks.size(); }
+		const Statistics& GetStatistics() const { return m_statistics; }
+
+	private:
+		struct Entry
+		{
+			IdleTaskId Id{ InvalidIdleTaskId };
+			Task Callback;
+			Clock::time_point Deadline{ Clock::time_point::max() };
+		};
+
+		bool RunIdle();
+		void RunOverdue();
+		void UpdateDeadlineTimer();
+
+		MessageLoop& m_messageLoop;
+		TimerWheel& m_timerWheel;
+		TimerWheel::Entry m_deadlineTimer;
+		MessageLoop::IdleHandlerId m_idleHandlerId{ 0 };
+		bool m_isIdleHandlerRegistered{ false };
+
+		std::deque<Entry> m_tasks;
+		IdleTaskId m_nextId{ 1 };
+		IdleTaskId m_runningId{ InvalidIdleTaskId };
+		bool m_runningCancelled{ false };
+
+		Statistics m_statistics;
+	};
+}
+
+#endif
\ No newline at end of file
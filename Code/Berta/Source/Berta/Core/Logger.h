@@ -171,7 +171,11 @@ namespace Berta
 			std::time_t currentTime = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
 			
 			struct tm timeinfo;
+#ifdef BT_PLATFORM_WINDOWS
 			localtime_s(&timeinfo, &currentTime);
+#else
+			localtime_r(&currentTime, &timeinfo);
+#endif
 
 			strftime(timeBuffer, sizeof(timeBuffer), "%H-%M-%S", &timeinfo);
 			//strftime(timeBuffer, sizeof(timeBuffer), "%Y-%m-%d %H-%M-%S", &timeinfo);
@@ -0,0 +1,113 @@
+/*
+* MIT License
+*
+* Copyright (c) 2024 Edgar Bernal (edgar.bernal@gmail.com)
+*/
+
+#ifndef BT_LRU_CACHE_HEADER
+#define BT_LRU_CACHE_HEADER
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <unordered_map>
+#include <utility>
+
+namespace Berta
+{
+	struct LruCacheStatistics
+	{
+		uint64_t Hits{ 0 };
+		uint64_t Misses{ 0 };
+		uint64_t Evictions{ 0 };
+	};
+
+	/*
+	* Bounded map that evicts the least recently used entry when it is full. Find and Insert move the
+	* entry to the front. Pointers returned stay valid until that entry is evicted, erased or cleared.
+	* With a transparent Hash and KeyEqual, Find takes any comparable key (e.g. a string view).
+	*/
+	template <typename Key, typename Value, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+	class LruCache
+	{
+	public:
+		explicit LruCache(size_t capacity) :
+			m_capacity(capacity > 0 ? capacity : 1)
+		{
+		}
+
+		LruCache(const LruCache&) = delete;
+		LruCache& operator=(const LruCache&) = delete;
+
+		// Counts a hit or a miss.
+		template <typename LookupKey>
+		Value* Find(const LookupKey& key)
+		{
+			auto it = m_index.find(key);
+			if (it == m_index.end())
+			{
+				++m_statistics.Misses;
+				return nullptr;
+			}
+
+			++m_statistics.Hits;
+			m_entries.splice(m_entries.begin(), m_entries, it->second);
+			return &it->second->second;
+		}
+
+		Value& Insert(const Key& key, Value value)
+		{
+			auto it = m_index.find(key);
+			if (it != m_index.end())
+			{
+				it->second->second = std::move(value);
+				m_entries.splice(m_entries.begin(), m_entries, it->second);
+				return it->second->second;
+			}
+
+			if (m_entries.size() >= m_capacity)
+			{
+				m_index.erase(m_entries.back().first);
+				m_entries.pop_back();
+				++m_statistics.Evictions;
+			}
+
+			m_entries.emplace_front(key, std::move(value));
+			m_index.emplace(key, m_entries.begin());
+			return m_entries.front().second;
+		}
+
+		void Erase(const Key& key)
+		{
+			auto it = m_index.find(key);
+			if (it != m_index.end())
+			{
+				m_entries.erase(it->second);
+				m_index.erase(it);
+			}
+		}
+
+		void Clear()
+		{
+			m_index.clear();
+			m_entries.clear();
+		}
+
+		size_t Size() const { return m_entries.size(); }
+		size_t Capacity() const { return m_capacity; }
+
+		const LruCacheStatistics& GetStatistics() const { return m_statistics; }
+		void ResetStatistics() { m_statistics = {}; }
+
+	private:
+		using Entries = std::list<std::pair<Key, Value>>;
+
+		size_t m_capacity;
+		Entries m_entries;	// Most recently used first.
+		std::unordered_map<Key, typename Entries::iterator, Hash, KeyEqual> m_index;
+		LruCacheStatistics m_statistics;
+	};
+}
+
+#endif
\ No newline at end of file
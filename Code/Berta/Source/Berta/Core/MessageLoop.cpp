@@ -0,0 +1,227 @@
+/*
+* MIT License
+*
+* Copyright (c) 2024 Edgar Bernal (edgar.bernal@gmail.com)
+*/
+
+#include "btpch.h"
+#include "MessageLoop.h"
+
+#include <algorithm>
+
+namespace Berta
+{
+	MessageLoop::MessageLoop() :
+		m_threadId(std::this_thread::get_id())
+	{
+		InitializeNative();
+	}
+
+	MessageLoop::~MessageLoop()
+	{
+		ShutdownNative();
+	}
+
+	int MessageLoop::Run()
+	{
+		m_threadId = std::this_thread::get_id();
+		m_quitRequested = false;
+		m_isRunning = true;
+
+		while (RunOnce(true))
+		{
+		}
+
+		m_isRunning = false;
+		return m_exitCode;
+	}
+
+	bool MessageLoop::RunOnce(bool mayBlock)
+	{
+		++m_statistics.Iterations;
+
+		bool didWork = PumpNativeMessages();
+		if (m_quitRequested)
+		{
+			return false;
+		}
+
+		didWork |= RunPostedTasks();
+		if (m_quitRequested)
+		{
+			return false;
+		}
+
+		didWork |= RunTimers();
+		if (m_quitRequested)
+		{
+			return false;
+		}
+
+		if (didWork)
+		{
+			return true; // Drain everything pending before giving time to idle handlers.
+		}
+
+		bool hasMoreIdleWork = RunIdleHandlers();
+		if (m_quitRequested)
+		{
+			return false;
+		}
+
+		if (!mayBlock || hasMoreIdleWork)
+		{
+			return true;
+		}
+
+		if (m_preWaitHandler && m_preWaitHandler())
+		{
+			return !m_quitRequested;
+		}
+
+		WaitForWork(GetWaitTimeout());
+		++m_statistics.Wakeups;
+
+		return !m_quitRequested;
+	}
+
+	void MessageLoop::Quit(int exitCode)
+	{
+		m_exitCode = exitCode;
+		m_quitRequested = true;
+
+		if (!IsLoopThread())
+		{
+			Wakeup();
+		}
+	}
+
+	void MessageLoop::PostTask(Task task)
+	{
+		m_tasks.Push(std::move(task));
+		Wakeup();
+	}
+
+	void MessageLoop::Wakeup()
+	{
+		if (!m_wakeupPending.exchange(true))
+		{
+			WakeupNative();
+		}
+	}
+
+	bool MessageLoop::HasPendingWork() const
+	{
+		return m_wakeupPending.load(std::memory_order_relaxed) || !m_tasks.IsEmpty() || HasPendingNativeMessages();
+	}
+
+	MessageLoop::IdleHandlerId MessageLoop::AddIdleHandler(IdleHandler handler)
+	{
+		m_idleHandlers.emplace_back(StoredIdleHandler{ m_idleIdCounter, std::move(handler) });
+		return m_idleIdCounter++;
+	}
+
+	void MessageLoop::RemoveIdleHandler(IdleHandlerId id)
+	{
+		auto it = std::find_if(m_idleHandlers.begin(), m_idleHandlers.end(),
+			[id](const StoredIdleHandler& handler)
+			{
+				return handler.Id == id;
+			});
+
+		if (it != m_idleHandlers.end())
+		{
+			m_idleHandlers.erase(it);
+		}
+	}
+
+	bool MessageLoop::RunPostedTasks()
+	{
+		m_wakeupPending.store(false);
+
+		Task task;
+		if (!m_tasks.Pop(task))
+		{
+			return false;
+		}
+
+		// Producers can keep pushing while we drain, don't let them starve the native queue.
+		auto sliceEnd = Clock::now() + TaskTimeSlice;
+		do
+		{
+			if (task)
+			{
+				task();
+			}
+			++m_statistics.Tasks;
+
+			if (m_quitRequested)
+			{
+				break;
+			}
+
+			if (Clock::now() >= sliceEnd)
+			{
+				++m_statistics.TaskSlicesExceeded;
+				break;
+			}
+		} while (m_tasks.Pop(task));
+
+		return true;
+	}
+
+	bool MessageLoop::RunTimers()
+	{
+		if (!m_timerSource)
+		{
+			return false;
+		}
+
+		if (m_timerSource->Advance(Clock::now()))
+		{
+			++m_statistics.TimerRuns;
+			return true;
+		}
+		return false;
+	}
+
+	bool MessageLoop::RunIdleHandlers()
+	{
+		if (m_idleHandlers.empty())
+		{
+			return false;
+		}
+
+		++m_statistics.IdleRuns;
+
+		// Handlers may add or remove other idle handlers while they run.
+		auto handlers = m_idleHandlers;
+		bool hasMoreIdleWork = false;
+		for (auto& handler : handlers)
+		{
+			if (handler.Callback())
+			{
+				hasMoreIdleWork = true;
+			}
+		}
+		return hasMoreIdleWork;
+	}
+
+	std::chrono::milliseconds MessageLoop::GetWaitTimeout() const
+	{
+		Clock::time_point deadline;
+		if (!m_timerSource || !m_timerSource->GetNextDeadline(deadline))
+		{
+			return InfiniteTimeout;
+		}
+
+		auto now = Clock::now();
+		if (deadline <= now)
+		{
+			return std::chrono::milliseconds{ 0 };
+		}
+
+		// Round up, otherwise we wake up right before the deadline and spin until it passes.
+		return std::chrono::ceil<std::chrono::milliseconds>(deadline - now);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,165 @@
+/*
+* MIT License
+*
+* Copyright (c) 2024 Edgar Bernal (edgar.bernal@gmail.com)
+*/
+
+#ifndef BT_MESSAGE_LOOP_HEADER
+#define BT_MESSAGE_LOOP_HEADER
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <thread>
+#include <vector>
+#include "Berta/Core/TaskQueue.h"
+
+#ifdef BT_PLATFORM_LINUX
+#include <unordered_map>
+#endif
+
+namespace Berta
+{
+	/*
+	* Anything that needs the loop to wake up at a given time (timers) implements this.
+	* The loop asks for the next deadline before blocking and advances the source once it wakes up.
+	*/
+	class MessageLoopTimerSource
+	{
+	public:
+		using Clock = std::chrono::steady_clock;
+
+		virtual ~MessageLoopTimerSource() = default;
+
+		virtual bool GetNextDeadline(Clock::time_point& deadline) const = 0;
+		virtual bool Advance(Clock::time_point now) = 0; // Returns true if at least one timer was fired.
+	};
+
+	/*
+	* Blocking message loop. It sleeps until native input, a posted task or the next timer deadline arrives.
+	* Idle handlers are only called when there is nothing else to do.
+	*/
+	class MessageLoop
+	{
+	public:
+		using Clock = std::chrono::steady_clock;
+		using Task = TaskQueue::Task;
+		using IdleHandler = std::function<bool()>; // Returns true if it has more idle work pending.
+		using IdleHandlerId = size_t;
+		using PreWaitHandler = std::function<bool()>; // Returns true if it did work, the loop then iterates again instead of blocking.
+
+		struct Statistics
+		{
+			uint64_t Iterations{ 0 };
+			uint64_t Wakeups{ 0 };
+			uint64_t NativeMessages{ 0 };
+			uint64_t Tasks{ 0 };
+			uint64_t TaskSlicesExceeded{ 0 };
+			uint64_t TimerRuns{ 0 };
+			uint64_t IdleRuns{ 0 };
+		};
+
+		MessageLoop();
+		~MessageLoop();
+
+		MessageLoop(const MessageLoop&) = delete;
+		MessageLoop& operator=(const MessageLoop&) = delete;
+
+		int Run();
+		bool RunOnce(bool mayBlock = true);
+		void Quit(int exitCode = 0);
+
+		bool IsRunning() const { return m_isRunning; }
+		bool IsLoopThread() const { return m_threadId == std::this_thread::get_id(); }
+
+		void PostTask(Task task); // Thread-safe and lock-free.
+		void Wakeup();
+
+		// True if native input/paint or posted tasks are waiting. Long idle work checks it to yield early.
+		bool HasPendingWork() const;
+
+		IdleHandlerId AddIdleHandler(IdleHandler handler);
+		void RemoveIdleHandler(IdleHandlerId id);
+
+		void SetTimerSource(MessageLoopTimerSource* timerSource) { m_timerSource = timerSource; }
+
+		// Called right before blocking. Backends with a client side event queue (Xlib) drain it here,
+		// events already read off the connection don't make its descriptor readable.
+		void SetPreWaitHandler(PreWaitHandler handler) { m_preWaitHandler = std::move(handler); }
+
+		const Statistics& GetStatistics() const { return m_statistics; }
+		void ResetStatistics() { m_statistics = {}; }
+
+#ifdef BT_PLATFORM_WINDOWS
+		// Identifies the WM_TIMER of NativeModalTimerTick on the window given to EnterNativeModalLoop.
+		static constexpr UINT_PTR NativeModalTimerId = 0xBE27A;
+
+		/*
+		* DefWindowProc's size/move loop pumps messages instead of Run. Between these calls a native
+		* timer armed for the next deadline runs the timers, and Wakeup posts CustomMessageId::
+		* ModalLoopWakeup to that window so posted tasks (Post, Invoke, input flushes) run right away.
+		*/
+		void EnterNativeModalLoop(HWND window);
+		void ExitNativeModalLoop();
+		void NativeModalTimerTick();
+#endif
+
+#ifdef BT_PLATFORM_LINUX
+		using FileDescriptorHandler = std::function<void(uint32_t events)>;
+
+		bool WatchFileDescriptor(int fileDescriptor, FileDescriptorHandler handler);
+		void UnwatchFileDescriptor(int fileDescriptor);
+#endif
+
+	private:
+		static constexpr std::chrono::milliseconds InfiniteTimeout{ -1 };
+		// Posted tasks get at most this much time per iteration, then native input gets its turn.
+		static constexpr std::chrono::milliseconds TaskTimeSlice{ 8 };
+
+		bool RunPostedTasks();
+		bool RunTimers();
+		bool RunIdleHandlers();
+		std::chrono::milliseconds GetWaitTimeout() const;
+
+		// Platform backend. See Platform/<OS>/MessageLoop_<OS>.cpp
+		void InitializeNative();
+		void ShutdownNative();
+		bool PumpNativeMessages();
+		bool HasPendingNativeMessages() const;
+		void WaitForWork(std::chrono::milliseconds timeout);
+		void WakeupNative();
+
+		struct StoredIdleHandler
+		{
+			IdleHandlerId Id;
+			IdleHandler Callback;
+		};
+
+		bool m_isRunning{ false };
+		bool m_quitRequested{ false };
+		int m_exitCode{ 0 };
+		std::thread::id m_threadId;
+
+		TaskQueue m_tasks;
+		std::atomic_bool m_wakeupPending{ false };
+
+		IdleHandlerId m_idleIdCounter{ 0 };
+		std::vector<StoredIdleHandler> m_idleHandlers;
+
+		MessageLoopTimerSource* m_timerSource{ nullptr };
+		PreWaitHandler m_preWaitHandler;
+		Statistics m_statistics;
+
+#ifdef BT_PLATFORM_WINDOWS
+		HANDLE m_wakeupEvent{ nullptr };
+		std::atomic<HWND> m_modalWindow{ nullptr }; // Read by WakeupNative from any thread.
+#elif defined(BT_PLATFORM_LINUX)
+		int m_epollFd{ -1 };
+		int m_wakeupFd{ -1 };
+		std::unordered_map<int, FileDescriptorHandler> m_fileDescriptorHandlers;
+#endif
+	};
+}
+
+#endif
\ No newline at end of file
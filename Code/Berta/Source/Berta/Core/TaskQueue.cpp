@@ -0,0 +1,96 @@
+/*
+* MIT License
+*
+* Copyright (c) 2024 Edgar Bernal (edgar.bernal@gmail.com)
+*/
+
+#include "btpch.h"
+#include "TaskQueue.h"
+
+namespace Berta
+{
+	TaskQueue::TaskQueue() :
+		m_head(&m_stub),
+		m_tail(&m_stub)
+	{
+	}
+
+	TaskQueue::~TaskQueue()
+	{
+		while (auto node = PopNode())
+		{
+			delete node;
+		}
+	}
+
+	void TaskQueue::Push(Task task)
+	{
+		auto node = new Node();
+		node->Body = std::move(task);
+		PushNode(node);
+		m_pushedCount.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	bool TaskQueue::Pop(Task& task)
+	{
+		auto node = PopNode();
+		if (!node)
+		{
+			return false;
+		}
+
+		task = std::move(node->Body);
+		delete node;
+		return true;
+	}
+
+	bool TaskQueue::IsEmpty() const
+	{
+		return m_tail == &m_stub && m_stub.Next.load(std::memory_order_acquire) == nullptr && m_head.load(std::memory_order_acquire) == &m_stub;
+	}
+
+	void TaskQueue::PushNode(Node* node)
+	{
+		node->Next.store(nullptr, std::memory_order_relaxed);
+		auto previous = m_head.exchange(node, std::memory_order_acq_rel);
+		previous->Next.store(node, std::memory_order_release);
+	}
+
+	TaskQueue::Node* TaskQueue::PopNode()
+	{
+		auto tail = m_tail;
+		auto next = tail->Next.load(std::memory_order_acquire);
+		if (tail == &m_stub)
+		{
+			if (next == nullptr)
+			{
+				return nullptr;
+			}
+
+			m_tail = next;
+			tail = next;
+			next = next->Next.load(std::memory_order_acquire);
+		}
+
+		if (next)
+		{
+			m_tail = next;
+			return tail;
+		}
+
+		if (tail != m_head.load(std::memory_order_acquire))
+		{
+			return nullptr; // A producer swapped the head but didn't link it yet.
+		}
+
+		// Last node: put the stub behind it so the node can be handed out.
+		PushNode(&m_stub);
+		next = tail->Next.load(std::memory_order_acquire);
+		if (next)
+		{
+			m_tail = next;
+			return tail;
+		}
+		return nullptr;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,57 @@
+/*
+* MIT License
+*
+* Copyright (c) 2024 Edgar Bernal (edgar.bernal@gmail.com)
+*/
+
+#ifndef BT_TASK_QUEUE_HEADER
+#define BT_TASK_QUEUE_HEADER
+
+#include <atomic>
+#include <cstdint>
+#include "Berta/Core/Delegate.h"
+
+namespace Berta
+{
+	/*
+	* Intrusive lock-free multiple producer / single consumer queue (Vyukov's algorithm).
+	* Push is wait-free and can be called from any thread, Pop only from the consumer (UI) thread.
+	*/
+	class TaskQueue
+	{
+	public:
+		using Task = Delegate<void()>;
+
+		TaskQueue();
+		~TaskQueue();
+
+		TaskQueue(const TaskQueue&) = delete;
+		TaskQueue& operator=(const TaskQueue&) = delete;
+
+		void Push(Task task);
+
+		// Returns false if the queue is empty, or if a producer is halfway through a Push
+		// (that producer wakes the consumer up once it's done).
+		bool Pop(Task& task);
+
+		bool IsEmpty() const;
+		uint64_t GetPushedCount() const { return m_pushedCount.load(std::memory_order_relaxed); }
+
+	private:
+		struct Node
+		{
+			std::atomic<Node*> Next{ nullptr };
+			Task Body;
+		};
+
+		void PushNode(Node* node);
+		Node* PopNode();
+
+		alignas(64) std::atomic<Node*> m_head;	// Producers side.
+		alignas(64) Node* m_tail;				// Consumer side.
+		Node m_stub;
+		std::atomic<uint64_t> m_pushedCount{ 0 };
+	};
+}
+
+#endif
\ No newline at end of file
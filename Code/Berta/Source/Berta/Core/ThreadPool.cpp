@@ -0,0 +1,188 @@
+/*
+* MIT License
+*
+* Copyright (c) 2024 Edgar Bernal (edgar.bernal@gmail.com)
+*/
+
+#include "btpch.h"
+#include "ThreadPool.h"
+
+namespace Berta
+{
+	namespace
+	{
+		thread_local const ThreadPool* g_currentPool{ nullptr };
+		thread_local uint32_t g_currentWorker{ 0 };
+	}
+
+	ThreadPool::ThreadPool(uint32_t threadCount)
+	{
+		if (threadCount == 0)
+		{
+			auto hardwareThreads = std::thread::hardware_concurrency();
+			threadCount = hardwareThreads > 1 ? hardwareThreads - 1 : 1;
+		}
+
+		m_threadCount = threadCount;
+		m_workers.reserve(threadCount);
+		for (uint32_t i = 0; i < threadCount; ++i)
+		{
+			m_workers.emplace_back(std::make_unique<Worker>());
+		}
+	}
+
+	ThreadPool::~ThreadPool()
+	{
+		Shutdown();
+	}
+
+	void ThreadPool::Submit(Work work, WorkPriority priority)
+	{
+		if (!work || m_stopRequested.load(std::memory_order_acquire))
+		{
+			return;
+		}
+
+		std::call_once(m_startFlag, [this]() { Start(); });
+
+		// Work spawned by a worker stays local, others will steal it if it's idle long enough.
+		uint32_t index = g_currentPool == this ? g_currentWorker : m_nextWorker.fetch_add(1, std::memory_order_relaxed) % m_threadCount;
+		{
+			auto& worker = *m_workers[index];
+			std::lock_guard<std::mutex> lock(worker.Mutex);
+			worker.Lanes[static_cast<size_t>(priority)].emplace_back(std::move(work));
+		}
+		m_submittedCount.fetch_add(1, std::memory_order_relaxed);
+
+		{
+			// Taken so a worker can't miss the notification between its check and its wait.
+			std::lock_guard<std::mutex> lock(m_sleepMutex);
+			m_pendingCount.fetch_add(1, std::memory_order_release);
+		}
+		m_sleepCondition.notify_one();
+	}
+
+	void ThreadPool::Shutdown()
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_sleepMutex);
+			if (m_stopRequested.exchange(true))
+			{
+				return;
+			}
+		}
+		m_sleepCondition.notify_all();
+
+		for (auto& thread : m_threads)
+		{
+			if (thread.joinable())
+			{
+				thread.join();
+			}
+		}
+		m_threads.clear();
+
+		for (auto& worker : m_workers)
+		{
+			for (auto& lane : worker->Lanes)
+			{
+				lane.clear();
+			}
+		}
+	}
+
+	bool ThreadPool::IsWorkerThread() const
+	{
+		return g_currentPool == this;
+	}
+
+	ThreadPool::Statistics ThreadPool::GetStatistics() const
+	{
+		Statistics statistics;
+		statistics.Submitted = m_submittedCount.load(std::memory_order_relaxed);
+		statistics.Executed = m_executedCount.load(std::memory_order_relaxed);
+		statistics.Stolen = m_stolenCount.load(std::memory_order_relaxed);
+		return statistics;
+	}
+
+	void ThreadPool::Start()
+	{
+		m_threads.reserve(m_threadCount);
+		for (uint32_t i = 0; i < m_threadCount; ++i)
+		{
+			m_threads.emplace_back([this, i]() { WorkerLoop(i); });
+		}
+	}
+
+	void ThreadPool::WorkerLoop(uint32_t index)
+	{
+		g_currentPool = this;
+		g_currentWorker = index;
+
+		Work work;
+		while (true)
+		{
+			if (TryGetWork(index, work))
+			{
+				work();
+				work.Reset();
+				m_executedCount.fetch_add(1, std::memory_order_relaxed);
+				continue;
+			}
+
+			std::unique_lock<std::mutex> lock(m_sleepMutex);
+			m_sleepCondition.wait(lock, [this]()
+			{
+				return m_stopRequested.load(std::memory_order_acquire) || m_pendingCount.load(std::memory_order_acquire) != 0;
+			});
+
+			if (m_stopRequested.load(std::memory_order_acquire))
+			{
+				break;
+			}
+		}
+
+		g_currentPool = nullptr;
+	}
+
+	bool ThreadPool::TryGetWork(uint32_t index, Work& work)
+	{
+		// Every Visible item, local or stolen, goes before any Prefetch one.
+		for (size_t lane = 0; lane < PriorityCount; ++lane)
+		{
+			{
+				auto& worker = *m_workers[index];
+				std::lock_guard<std::mutex> lock(worker.Mutex);
+				auto& queue = worker.Lanes[lane];
+				if (!queue.empty())
+				{
+					work = std::move(queue.back());
+					queue.pop_back();
+					m_pendingCount.fetch_sub(1, std::memory_order_acq_rel);
+					return true;
+				}
+			}
+
+			for (uint32_t offset = 1; offset < m_threadCount; ++offset)
+			{
+				auto& victim = *m_workers[(index + offset) % m_threadCount];
+				std::unique_lock<std::mutex> lock(victim.Mutex, std::try_to_lock);
+				if (!lock.owns_lock())
+				{
+					continue;
+				}
+
+				auto& queue = victim.Lanes[lane];
+				if (!queue.empty())
+				{
+					work = std::move(queue.front());
+					queue.pop_front();
+					m_pendingCount.fetch_sub(1, std::memory_order_acq_rel);
+					m_stolenCount.fetch_add(1, std::memory_order_relaxed);
+					return true;
+				}
+			}
+		}
+		return false;
+	}
+}
\ No newline at end of file
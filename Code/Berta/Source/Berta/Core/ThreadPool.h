@@ -0,0 +1,90 @@
+/*
+* MIT License
+*
+* Copyright (c) 2024 Edgar Bernal (edgar.bernal@gmail.com)
+*/
+
+#ifndef BT_THREAD_POOL_HEADER
+#define BT_THREAD_POOL_HEADER
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "Berta/Core/Delegate.h"
+
+namespace Berta
+{
+	enum class WorkPriority
+	{
+		Visible = 0,	// Something on screen is waiting for it.
+		Prefetch,		// Only runs when there is no Visible work left.
+		Count
+	};
+
+	/*
+	* Work-stealing thread pool. Every worker owns one deque per priority: it pops its own work LIFO
+	* (cache friendly) and steals from the other workers FIFO (oldest first). Work submitted from
+	* outside the pool is spread round-robin. Threads are started on the first Submit.
+	*/
+	class ThreadPool
+	{
+	public:
+		using Work = Delegate<void()>;
+
+		struct Statistics
+		{
+			uint64_t Submitted{ 0 };
+			uint64_t Executed{ 0 };
+			uint64_t Stolen{ 0 };
+		};
+
+		explicit ThreadPool(uint32_t threadCount = 0); // 0: one less than the hardware threads.
+		~ThreadPool();
+
+		ThreadPool(const ThreadPool&) = delete;
+		ThreadPool& operator=(const ThreadPool&) = delete;
+
+		void Submit(Work work, WorkPriority priority = WorkPriority::Visible);
+		void Shutdown(); // Drops the work that didn't start yet and joins the workers.
+
+		uint32_t GetThreadCount() const { return m_threadCount; }
+		bool IsWorkerThread() const;
+		Statistics GetStatistics() const;
+
+	private:
+		static constexpr size_t PriorityCount = static_cast<size_t>(WorkPriority::Count);
+
+		struct Worker
+		{
+			std::mutex Mutex;
+			std::array<std::deque<Work>, PriorityCount> Lanes;
+		};
+
+		void Start();
+		void WorkerLoop(uint32_t index);
+		bool TryGetWork(uint32_t index, Work& work);
+
+		uint32_t m_threadCount{ 0 };
+		std::vector<std::unique_ptr<Worker>> m_workers;
+		std::vector<std::thread> m_threads;
+
+		std::once_flag m_startFlag;
+		std::mutex m_sleepMutex;
+		std::condition_variable m_sleepCondition;
+		std::atomic<size_t> m_pendingCount{ 0 };
+		std::atomic<uint32_t> m_nextWorker{ 0 };
+		std::atomic_bool m_stopRequested{ false };
+
+		std::atomic<uint64_t> m_submittedCount{ 0 };
+		std::atomic<uint64_t> m_executedCount{ 0 };
+		std::atomic<uint64_t> m_stolenCount{ 0 };
+	};
+}
+
+#endif
\ No newline at end of file
@@ -7,20 +7,21 @@
 #include "btpch.h"
 #include "Timer.h"
 
-#include "Berta/API/WindowAPI.h"
+#include "Berta/Core/Foundation.h"
 #include "Berta/GUI/Window.h"
+#include "Berta/Paint/DrawBatch.h"
 
 namespace Berta
 {
-	Timer::Timer(Window* owner) : 
-		m_owner(owner)
+	Timer::Timer(Window* owner)
 	{
-		m_isRunning.store(false);
+		m_entry.Callback = [this]() { OnExpired(); };
+		SetOwner(owner);
 	}
 
 	Timer::Timer()
 	{
-		m_isRunning.store(false);
+		m_entry.Callback = [this]() { OnExpired(); };
 	}
 
 	Timer::~Timer()
@@ -28,84 +29,79 @@ namespace Berta
 		Stop();
 	}
 
+	void Timer::SetOwner(Window* owner)
+	{
+		m_owner = owner;
+		m_ownerHandle = owner ? owner->Handle : InvalidWindowHandle;
+	}
+
 	void Timer::Start()
 	{
-		if (m_isRunning.load())
+		if (m_isRunning)
 		{
 			return;
 		}
 
-		m_isRunning.store(true);
-		m_timerThread = std::thread(&Timer::Run, this);
+		m_isRunning = true;
+		Foundation::GetInstance().GetTimerWheel().Schedule(m_entry, m_interval);
 	}
 
 	void Timer::Stop()
 	{
-		{
-			std::lock_guard<std::mutex> lock(m_conditionMutex);
-			m_isRunning.store(false);
-		}
-		m_conditionVariable.notify_all();
-		if (m_timerThread.joinable())
-		{
-			m_timerThread.join();
-		}
+		m_isRunning = false;
+		Foundation::GetInstance().GetTimerWheel().Cancel(m_entry);
 	}
 
 	void Timer::SetInterval(std::chrono::milliseconds milliseconds)
 	{
-		if (m_interval.load() == milliseconds)
-			return;
-
-		if (!m_isRunning.load())
+		if (m_interval == milliseconds)
 		{
-			m_interval.store(milliseconds);
 			return;
 		}
 
-		Stop();
-		m_interval.store(milliseconds);
-
-		Start();
+		m_interval = milliseconds;
+		if (m_isRunning)
+		{
+			Foundation::GetInstance().GetTimerWheel().Schedule(m_entry, m_interval);
+		}
 	}
 
 	void Timer::SetInterval(uint32_t milliseconds)
 	{
-		if (m_interval.load() == std::chrono::milliseconds(milliseconds))
+		SetInterval(std::chrono::milliseconds(milliseconds));
+	}
+
+	void Timer::OnExpired()
+	{
+		auto& foundation = Foundation::GetInstance();
+		auto& timerWheel = foundation.GetTimerWheel();
+
+		// Schedule from the previous deadline so the period doesn't drift, unless we are already late.
+		auto now = TimerWheel::Clock::now();
+		auto nextExpiry = timerWheel.GetExpiry(m_entry) + m_interval;
+		if (nextExpiry <= now)
 		{
-			return;
+			nextExpiry = now + m_interval;
 		}
+		timerWheel.ScheduleAt(m_entry, nextExpiry);
 
-		if (!m_isRunning.load())
+		ArgTimer argTimer;
+		if (m_owner == nullptr)
 		{
-			m_interval.store(std::chrono::milliseconds(milliseconds));
+			m_tick.Emit(argTimer);
 			return;
 		}
 
-		Stop();
-		m_interval.store(std::chrono::milliseconds(milliseconds));
-		
-		Start();
-	}
-
-	void Timer::Run()
-	{
-		std::unique_lock<std::mutex> lock(m_conditionMutex);
-		while (m_isRunning.load())
+		auto& windowManager = foundation.GetWindowManager();
+		if (windowManager.Get(m_ownerHandle) != m_owner || m_owner->Flags.IsDisposed)
 		{
-			// Wait for a signal to wake up or continue checking periodically
-			m_conditionVariable.wait_for(lock, std::chrono::milliseconds(m_interval), [this] { return !m_isRunning.load(); });
-			
-			if (!m_isRunning.load())
-			{
-				break;
-			}
-
-			API::SendCustomMessage(m_owner->RootHandle, [this]()
-			{
-				ArgTimer argTimer;
-				m_tick.Emit(argTimer);
-			});
+			return;
 		}
+
+		// Same context as a native message: everything drawn by the handlers is flushed in one batch.
+		DrawBatch drawBatch(m_owner->RootWindow);
+		Foundation::RootGuard rootGuard(m_owner->RootWindow);
+
+		m_tick.Emit(argTimer);
 	}
 }
\ No newline at end of file
@@ -8,12 +8,9 @@
 #define BT_TIMER_HEADER
 
 #include <chrono>
-#include <thread>
-#include <functional>
-#include <atomic>
-#include <condition_variable>
-#include <mutex>
 #include "Berta/Core/Event.h"
+#include "Berta/Core/TimerWheel.h"
+#include "Berta/GUI/WindowRegistry.h"
 
 namespace Berta
 {
@@ -23,6 +20,10 @@ namespace Berta
 	{
 	};
 
+	/*
+	* Periodic timer. It doesn't own a thread: it is scheduled in the Foundation's timer wheel
+	* and ticks on the UI thread from the message loop.
+	*/
 	class Timer
 	{
 	public:
@@ -30,29 +31,31 @@ namespace Berta
 		Timer();
 		~Timer();
 
+		Timer(const Timer&) = delete;
+		Timer& operator=(const Timer&) = delete;
+
 		void Start();
 		void Stop();
 
-		void SetOwner(Window* owner) { m_owner = owner; }
+		void SetOwner(Window* owner);
 		void SetInterval(std::chrono::milliseconds milliseconds);
 		void SetInterval(uint32_t milliseconds);
-		void Connect(std::function<void(const ArgTimer&)> callback)
+		void Connect(Event<ArgTimer>::Handler callback)
 		{
-			m_tick.Connect(callback);
+			m_tick.Connect(std::move(callback));
 		}
 
-		bool IsRunning() const { return m_isRunning.load(); }
+		bool IsRunning() const { return m_isRunning; }
 	private:
-		void Run();
-
-		std::mutex m_conditionMutex;
-		std::condition_variable m_conditionVariable;
-		std::atomic_bool m_isRunning{ false };
-		std::atomic<std::chrono::milliseconds> m_interval{ std::chrono::milliseconds{ 1000 } };
-		
-		std::thread m_timerThread;
+		void OnExpired();
+
+		bool m_isRunning{ false };
+		std::chrono::milliseconds m_interval{ 1000 };
+
+		TimerWheel::Entry m_entry;
 		Event<ArgTimer> m_tick;
 		Window* m_owner{ nullptr };
+		WindowHandle m_ownerHandle{ InvalidWindowHandle };
 	};
 }
 
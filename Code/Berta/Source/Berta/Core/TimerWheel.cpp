@@ -0,0 +1,328 @@
+/*
+* MIT License
+*
+* Copyright (c) 2024 Edgar Bernal (edgar.bernal@gmail.com)
+*/
+
+#include "btpch.h"
+#include "TimerWheel.h"
+
+#include <algorithm>
+
+namespace Berta
+{
+	TimerWheel::TimerWheel() :
+		m_startTime(Clock::now())
+	{
+		for (auto& level : m_slots)
+		{
+			for (auto& slot : level)
+			{
+				slot.Head.Prev = &slot.Head;
+				slot.Head.Next = &slot.Head;
+			}
+		}
+	}
+
+	TimerWheel::~TimerWheel()
+	{
+		for (auto& level : m_slots)
+		{
+			for (auto& slot : level)
+			{
+				auto current = slot.Head.Next;
+				while (current != &slot.Head)
+				{
+					auto next = current->Next;
+					current->Prev = nullptr;
+					current->Next = nullptr;
+					current->Level = -1;
+					current = next;
+				}
+				slot.Head.Prev = &slot.Head;
+				slot.Head.Next = &slot.Head;
+			}
+		}
+	}
+
+	void TimerWheel::Schedule(Entry& entry, std::chrono::milliseconds delay)
+	{
+		ScheduleAt(entry, Clock::now() + delay);
+	}
+
+	void TimerWheel::ScheduleAt(Entry& entry, Clock::time_point expiry)
+	{
+		if (entry.IsScheduled())
+		{
+			Cancel(entry);
+		}
+
+		uint64_t expiryTick = 0;
+		if (expiry > m_startTime)
+		{
+			expiryTick = static_cast<uint64_t>(std::chrono::ceil<std::chrono::milliseconds>(expiry - m_startTime).count());
+		}
+		entry.ExpiryTick = (std::max)(expiryTick, m_currentTick + 1);
+
+		Place(entry, m_currentTick + 1);
+
+		++m_activeCount;
+		++m_statistics.Scheduled;
+
+		if (m_activeCount == 1)
+		{
+			m_nextExpiryTick = entry.ExpiryTick;
+			m_nextExpiryDirty = false;
+		}
+		else if (!m_nextExpiryDirty && entry.ExpiryTick < m_nextExpiryTick)
+		{
+			m_nextExpiryTick = entry.ExpiryTick;
+		}
+	}
+
+	void TimerWheel::Cancel(Entry& entry)
+	{
+		if (!entry.IsScheduled())
+		{
+			return;
+		}
+
+		Unlink(entry);
+
+		--m_activeCount;
+		++m_statistics.Cancelled;
+
+		if (entry.ExpiryTick == m_nextExpiryTick)
+		{
+			m_nextExpiryDirty = true;
+		}
+	}
+
+	TimerWheel::Clock::time_point TimerWheel::GetExpiry(const Entry& entry) const
+	{
+		return ToTimePoint(entry.ExpiryTick);
+	}
+
+	bool TimerWheel::GetNextDeadline(Clock::time_point& deadline) const
+	{
+		if (m_activeCount == 0)
+		{
+			return false;
+		}
+
+		if (m_nextExpiryDirty)
+		{
+			UpdateNextExpiry();
+		}
+
+		deadline = ToTimePoint(m_nextExpiryTick);
+		return true;
+	}
+
+	bool TimerWheel::Advance(Clock::time_point now)
+	{
+		uint64_t targetTick = ToTick(now);
+		if (targetTick <= m_currentTick)
+		{
+			return false;
+		}
+
+		auto firedBefore = m_statistics.Fired;
+		while (m_currentTick < targetTick)
+		{
+			if (m_activeCount == 0)
+			{
+				m_currentTick = targetTick;
+				break;
+			}
+
+			if (m_occupancy[0] == 0)
+			{
+				// Nothing to fire in level 0, jump to the last tick before the next cascade.
+				uint64_t lastTickOfPeriod = m_currentTick | SlotMask;
+				if (lastTickOfPeriod > m_currentTick)
+				{
+					m_currentTick = (std::min)(lastTickOfPeriod, targetTick);
+					continue;
+				}
+			}
+
+			uint64_t tick = m_currentTick + 1;
+			if ((tick & SlotMask) == 0)
+			{
+				uint32_t topLevel = 1;
+				while (topLevel + 1 < LevelCount && (tick & ((1ull << (SlotBits * (topLevel + 1))) - 1)) == 0)
+				{
+					++topLevel;
+				}
+
+				for (uint32_t level = topLevel; level > 0; --level)
+				{
+					Cascade(level, tick);
+				}
+			}
+
+			FireSlot(tick);
+		}
+
+		return m_statistics.Fired != firedBefore;
+	}
+
+	uint64_t TimerWheel::ToTick(Clock::time_point timePoint) const
+	{
+		if (timePoint <= m_startTime)
+		{
+			return 0;
+		}
+
+		return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(timePoint - m_startTime).count());
+	}
+
+	TimerWheel::Clock::time_point TimerWheel::ToTimePoint(uint64_t tick) const
+	{
+		return m_startTime + std::chrono::milliseconds(tick);
+	}
+
+	void TimerWheel::Place(Entry& entry, uint64_t baseTick)
+	{
+		uint64_t delta = entry.ExpiryTick - baseTick;
+		uint64_t targetTick = delta > MaxDelta ? baseTick + MaxDelta : entry.ExpiryTick;
+		delta = targetTick - baseTick;
+
+		uint32_t level = 0;
+		while (level + 1 < LevelCount && (delta >> (SlotBits * (level + 1))) != 0)
+		{
+			++level;
+		}
+
+		auto slotIndex = static_cast<uint32_t>((targetTick >> (SlotBits * level)) & SlotMask);
+		auto& head = m_slots[level][slotIndex].Head;
+
+		entry.Prev = head.Prev;
+		entry.Next = &head;
+		head.Prev->Next = &entry;
+		head.Prev = &entry;
+		entry.Level = static_cast<int>(level);
+		entry.SlotIndex = slotIndex;
+
+		m_occupancy[level] |= (1ull << slotIndex);
+	}
+
+	void TimerWheel::Unlink(Entry& entry)
+	{
+		entry.Prev->Next = entry.Next;
+		entry.Next->Prev = entry.Prev;
+
+		if (entry.Level >= 0)
+		{
+			auto& head = m_slots[entry.Level][entry.SlotIndex].Head;
+			if (head.Next == &head)
+			{
+				m_occupancy[entry.Level] &= ~(1ull << entry.SlotIndex);
+			}
+		}
+
+		entry.Prev = nullptr;
+		entry.Next = nullptr;
+		entry.Level = -1;
+	}
+
+	void TimerWheel::Cascade(uint32_t level, uint64_t tick)
+	{
+		auto slotIndex = static_cast<uint32_t>((tick >> (SlotBits * level)) & SlotMask);
+		auto& head = m_slots[level][slotIndex].Head;
+		if (head.Next == &head)
+		{
+			return;
+		}
+
+		auto current = head.Next;
+		head.Prev = &head;
+		head.Next = &head;
+		m_occupancy[level] &= ~(1ull << slotIndex);
+
+		while (current != &head)
+		{
+			auto next = current->Next;
+			Place(*current, tick);
+			++m_statistics.Cascaded;
+			current = next;
+		}
+	}
+
+	void TimerWheel::FireSlot(uint64_t tick)
+	{
+		m_currentTick = tick;
+
+		auto slotIndex = static_cast<uint32_t>(tick & SlotMask);
+		auto& head = m_slots[0][slotIndex].Head;
+		if (head.Next == &head)
+		{
+			return;
+		}
+
+		// Move the slot into a local list, callbacks are free to schedule or cancel any entry.
+		Entry expired;
+		expired.Next = head.Next;
+		expired.Prev = head.Prev;
+		expired.Next->Prev = &expired;
+		expired.Prev->Next = &expired;
+		head.Prev = &head;
+		head.Next = &head;
+		m_occupancy[0] &= ~(1ull << slotIndex);
+
+		for (auto current = expired.Next; current != &expired; current = current->Next)
+		{
+			current->Level = -1;
+		}
+
+		while (expired.Next != &expired)
+		{
+			auto& entry = *expired.Next;
+			Unlink(entry);
+
+			if (entry.ExpiryTick > tick)
+			{
+				Place(entry, tick + 1);
+				continue;
+			}
+
+			--m_activeCount;
+			++m_statistics.Fired;
+			if (entry.ExpiryTick == m_nextExpiryTick)
+			{
+				m_nextExpiryDirty = true;
+			}
+
+			if (entry.Callback)
+			{
+				entry.Callback();
+			}
+		}
+	}
+
+	void TimerWheel::UpdateNextExpiry() const
+	{
+		uint64_t nextExpiry = UINT64_MAX;
+		for (uint32_t level = 0; level < LevelCount; ++level)
+		{
+			auto occupancy = m_occupancy[level];
+			for (uint32_t slotIndex = 0; occupancy != 0; ++slotIndex, occupancy >>= 1)
+			{
+				if ((occupancy & 1ull) == 0)
+				{
+					continue;
+				}
+
+				auto& head = m_slots[level][slotIndex].Head;
+				for (auto current = head.Next; current != &head; current = current->Next)
+				{
+					nextExpiry = (std::min)(nextExpiry, current->ExpiryTick);
+				}
+			}
+		}
+
+		m_nextExpiryTick = nextExpiry;
+		m_nextExpiryDirty = false;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,105 @@
+/*
+* MIT License
+*
+* Copyright (c) 2024 Edgar Bernal (edgar.bernal@gmail.com)
+*/
+
+#ifndef BT_TIMER_WHEEL_HEADER
+#define BT_TIMER_WHEEL_HEADER
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include "Berta/Core/Delegate.h"
+#include "Berta/Core/MessageLoop.h"
+
+namespace Berta
+{
+	/*
+	* Hierarchical timer wheel (1 ms resolution, 4 levels of 64 slots ~ 4.6 hours).
+	* Schedule and Cancel are O(1). Entries are intrusive, so timers don't allocate.
+	* Not thread-safe: it is serviced by the message loop and must be used from the UI thread.
+	*/
+	class TimerWheel : public MessageLoopTimerSource
+	{
+	public:
+		struct Entry
+		{
+			Entry() = default;
+			Entry(const Entry&) = delete;
+			Entry& operator=(const Entry&) = delete;
+
+			bool IsScheduled() const { return Prev != nullptr; }
+
+			Delegate<void()> Callback;
+
+		private:
+			friend class TimerWheel;
+
+			Entry* Prev{ nullptr };
+			Entry* Next{ nullptr };
+			uint64_t ExpiryTick{ 0 };
+			int Level{ -1 };
+			uint32_t SlotIndex{ 0 };
+		};
+
+		struct Statistics
+		{
+			uint64_t Scheduled{ 0 };
+			uint64_t Cancelled{ 0 };
+			uint64_t Fired{ 0 };
+			uint64_t Cascaded{ 0 };
+		};
+
+		TimerWheel();
+		~TimerWheel();
+
+		TimerWheel(const TimerWheel&) = delete;
+		TimerWheel& operator=(const TimerWheel&) = delete;
+
+		void Schedule(Entry& entry, std::chrono::milliseconds delay);
+		void ScheduleAt(Entry& entry, Clock::time_point expiry);
+		void Cancel(Entry& entry);
+
+		Clock::time_point GetExpiry(const Entry& entry) const;
+		size_t ActiveCount() const { return m_activeCount; }
+		const Statistics& GetStatistics() const { return m_statistics; }
+
+		bool GetNextDeadline(Clock::time_point& deadline) const override;
+		bool Advance(Clock::time_point now) override;
+
+	private:
+		static constexpr uint32_t LevelCount = 4;
+		static constexpr uint32_t SlotBits = 6;
+		static constexpr uint32_t SlotCount = 1u << SlotBits;
+		static constexpr uint64_t SlotMask = SlotCount - 1;
+		static constexpr uint64_t MaxDelta = (1ull << (SlotBits * LevelCount)) - 1;
+
+		uint64_t ToTick(Clock::time_point timePoint) const;
+		Clock::time_point ToTimePoint(uint64_t tick) const;
+
+		void Place(Entry& entry, uint64_t baseTick);
+		void Unlink(Entry& entry);
+		void Cascade(uint32_t level, uint64_t tick);
+		void FireSlot(uint64_t tick);
+		void UpdateNextExpiry() const;
+
+		struct Slot
+		{
+			Entry Head;
+		};
+
+		Clock::time_point m_startTime;
+		uint64_t m_currentTick{ 0 };	// Every entry with an expiry <= m_currentTick was already fired.
+		size_t m_activeCount{ 0 };
+		std::array<uint64_t, LevelCount> m_occupancy{};
+		std::array<std::array<Slot, SlotCount>, LevelCount> m_slots;
+
+		mutable uint64_t m_nextExpiryTick{ 0 };
+		mutable bool m_nextExpiryDirty{ false };
+
+		Statistics m_statistics;
+	};
+}
+
+#endif
\ No newline at end of file
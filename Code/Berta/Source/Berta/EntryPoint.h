@@ -16,9 +16,9 @@ namespace Berta
 {
 }
 
-#else
+#elif !defined(BT_PLATFORM_LINUX)
 
-#error Berta only supports Windows!
+#error Berta only supports Windows and Linux (headless or X11, see Platform/Headless and Platform/X11)!
 
 #endif
 
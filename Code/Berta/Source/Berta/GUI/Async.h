@@ -0,0 +1,222 @@
+/*
+* MIT License
+*
+* Copyright (c) 2024 Edgar Bernal (edgar.bernal@gmail.com)
+*/
+
+#ifndef BT_ASYNC_HEADER
+#define BT_ASYNC_HEADER
+
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include "Berta/Core/CancellationToken.h"
+#include "Berta/Core/Delegate.h"
+#include "Berta/Core/ThreadPool.h"
+#include "Berta/GUI/Interface.h"
+
+namespace Berta
+{
+	struct Window;
+
+	namespace GUI
+	{
+		ThreadPool& GetThreadPool();
+		CancellationToken GetWindowLifetimeToken(Window* window);
+		void LogAsyncException(std::exception_ptr exception);
+	}
+
+	namespace Detail
+	{
+		// Work may or may not take the token.
+		template <typename Work>
+		decltype(auto) InvokeAsyncWork(Work& work, const CancellationToken& token)
+		{
+			if constexpr (std::is_invocable_v<Work&, const CancellationToken&>)
+			{
+				return work(token);
+			}
+			else
+			{
+				return work();
+			}
+		}
+
+		template <typename Work>
+		using AsyncWorkResult = std::decay_t<decltype(InvokeAsyncWork(std::declval<Work&>(), std::declval<const CancellationToken&>()))>;
+
+		template <typename Result>
+		struct AsyncResult
+		{
+			using Continuation = Delegate<void(Result)>;
+
+			std::optional<Result> Value;
+
+			template <typename Work>
+			void Run(Work& work, const CancellationToken& token) { Value.emplace(InvokeAsyncWork(work, token)); }
+			void Call(Continuation& continuation) { continuation(std::move(*Value)); }
+		};
+
+		template <>
+		struct AsyncResult<void>
+		{
+			using Continuation = Delegate<void()>;
+
+			template <typename Work>
+			void Run(Work& work, const CancellationToken& token) { InvokeAsyncWork(work, token); }
+			void Call(Continuation& continuation) { continuation(); }
+		};
+
+		template <typename Result>
+		struct AsyncState
+		{
+			using Continuation = typename AsyncResult<Result>::Continuation;
+
+			std::mutex Mutex;
+			WindowHandle Owner{ InvalidWindowHandle };	// Captured on the UI thread, InvalidWindowHandle if unbound.
+			CancellationSource Cancellation;
+			AsyncResult<Result> Storage;
+			Continuation OnCompleted;
+			bool IsCompleted{ false };
+			bool HasFailed{ false };
+
+			// Both sides call this, whoever comes last (work done / continuation attached) posts it.
+			// It may run on a worker, so the owner is posted by handle (the Window may be reclaimed already).
+			static void TryContinue(const std::shared_ptr<AsyncState>& state)
+			{
+				auto task = [state]()
+				{
+					if (state->Cancellation.IsCancelled())
+					{
+						return;
+					}
+
+					auto continuation = std::move(state->OnCompleted);
+					state->Storage.Call(continuation);
+				};
+
+				if (state->Owner == InvalidWindowHandle)
+				{
+					GUI::Post(nullptr, std::move(task));
+				}
+				else
+				{
+					GUI::Post(state->Owner, std::move(task));
+				}
+			}
+		};
+	}
+
+	/*
+	* Handle to work running in the Foundation's thread pool. The continuation given to Then runs on the
+	* UI thread, it's skipped if the operation was cancelled or the owner window was destroyed.
+	*/
+	template <typename Result>
+	class AsyncOperation
+	{
+	public:
+		using Continuation = typename Detail::AsyncResult<Result>::Continuation;
+
+		AsyncOperation() = default;
+		explicit AsyncOperation(std::shared_ptr<Detail::AsyncState<Result>> state) : m_state(std::move(state)) {}
+
+		AsyncOperation& Then(Continuation continuation)
+		{
+			if (!m_state)
+			{
+				return *this;
+			}
+
+			std::lock_guard<std::mutex> lock(m_state->Mutex);
+			m_state->OnCompleted = std::move(continuation);
+			if (m_state->IsCompleted && !m_state->HasFailed && m_state->OnCompleted)
+			{
+				Detail::AsyncState<Result>::TryContinue(m_state);
+			}
+			return *this;
+		}
+
+		void Cancel()
+		{
+			if (m_state)
+			{
+				m_state->Cancellation.Cancel();
+			}
+		}
+
+		bool IsCancelled() const { return m_state && m_state->Cancellation.IsCancelled(); }
+
+		bool IsCompleted() const
+		{
+			if (!m_state)
+			{
+				return false;
+			}
+
+			std::lock_guard<std::mutex> lock(m_state->Mutex);
+			return m_state->IsCompleted;
+		}
+
+	private:
+		std::shared_ptr<Detail::AsyncState<Result>> m_state;
+	};
+
+	namespace GUI
+	{
+		/*
+		* Runs work in a worker thread. The work may take a `const CancellationToken&` to poll, it's cancelled
+		* together with the operation and with the window (if any). Call it from the UI thread.
+		*/
+		template <typename Work>
+		auto RunAsync(Window* window, Work&& work, WorkPriority priority = WorkPriority::Visible)
+		{
+			using StoredWork = std::decay_t<Work>;
+			using Result = Detail::AsyncWorkResult<StoredWork>;
+			using State = Detail::AsyncState<Result>;
+
+			auto state = std::make_shared<State>();
+			state->Owner = window ? window->Handle : InvalidWindowHandle;
+			state->Cancellation = CancellationSource(GetWindowLifetimeToken(window));
+
+			GetThreadPool().Submit([state, work = StoredWork(std::forward<Work>(work))]() mutable
+			{
+				auto token = state->Cancellation.GetToken();
+				if (token.IsCancelled())
+				{
+					return;
+				}
+
+				bool hasFailed = false;
+				try
+				{
+					state->Storage.Run(work, token);
+				}
+				catch (...)
+				{
+					hasFailed = true;
+					LogAsyncException(std::current_exception());
+				}
+
+				std::lock_guard<std::mutex> lock(state->Mutex);
+				state->IsCompleted = true;
+				state->HasFailed = hasFailed;
+				if (!hasFailed && state->OnCompleted)
+				{
+					State::TryContinue(state);
+				}
+			}, priority);
+
+			return AsyncOperation<Result>(std::move(state));
+		}
+
+		template <typename Work>
+		auto RunAsync(Work&& work, WorkPriority priority = WorkPriority::Visible)
+		{
+			return RunAsync(nullptr, std::forward<Work>(work), priority);
+		}
+	}
+}
+
+#endif
\ No newline at end of file
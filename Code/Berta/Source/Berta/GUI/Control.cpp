@@ -110,6 +110,16 @@ namespace Berta
 		m_handle->Flags.AutoDraw = autoDraw;
 	}
 
+	bool ControlBase::IsInputCoalesced() const
+	{
+		return m_handle->Flags.CoalesceInput;
+	}
+
+	void ControlBase::SetInputCoalescing(bool enabled)
+	{
+		m_handle->Flags.CoalesceInput = enabled;
+	}
+
 	void ControlBase::DoOnCaption(const std::wstring& caption)
 	{
 		GUI::CaptionWindow(m_handle, caption);
@@ -57,6 +57,10 @@ namespace Berta
 		bool IsAutoDraw() const;
 		void SetAutoDraw(bool autoDraw);
 
+		// Mouse moves, wheel and key auto-repeat are merged before dispatch unless the control opts out.
+		bool IsInputCoalesced() const;
+		void SetInputCoalescing(bool enabled);
+
 #if BT_DEBUG
 		void SetDebugName(const std::string& name)
 		{
@@ -89,6 +93,11 @@ namespace Berta
 				m_control.NotifyDestroy();
 			}
 
+			virtual void CreateEvents() override
+			{
+				m_control.DoOnCreateEvents();
+			}
+
 		private:
 			ControlBase& m_control;
 			bool m_isDestroyed{ false };
@@ -111,6 +120,7 @@ namespace Berta
 			DoOnNotifyDestroy();
 		}
 		virtual void DoOnNotifyDestroy(){}
+		virtual void DoOnCreateEvents() const {}
 
 		Window* m_handle{ nullptr };
 	};
@@ -143,14 +153,25 @@ namespace Berta
 		Control& operator=(Control&&) = delete;
 
 		AppearanceType& GetAppearance() const { return *m_appearance; }
-		EventsType& GetEvents() const { return *m_events; }
+		// Most controls are never connected to, their events are allocated on first access.
+		EventsType& GetEvents() const
+		{
+			if (!m_events)
+			{
+				m_events = std::make_shared<EventsType>();
+				GUI::SetEvents(m_handle, m_events);
+			}
+			return *m_events;
+		}
 
 		void Create(Window* parent, bool isUnscaleRect, const Rectangle& rectangle, const FormStyle& formStyle, bool isNested, bool isRenderForm = false)
 		{
 			m_handle = GUI::CreateForm(parent, isUnscaleRect, rectangle, formStyle, isNested, this, isRenderForm);
 			m_appearance = std::make_shared<AppearanceType>();
-			m_events = std::make_shared<EventsType>();
-			GUI::SetEvents(m_handle, m_events);
+			if (m_events)
+			{
+				GUI::SetEvents(m_handle, m_events);
+			}
 			GUI::SetAppearance(m_handle, m_appearance);
 
 			if (!isRenderForm)
@@ -163,8 +184,10 @@ namespace Berta
 		{
 			m_handle = GUI::CreateControl(parent, isUnscaleRect, rectangle, this, isPanel);
 			m_appearance = std::make_shared<AppearanceType>();
-			m_events = std::make_shared<EventsType>();
-			GUI::SetEvents(m_handle, m_events);
+			if (m_events)
+			{
+				GUI::SetEvents(m_handle, m_events);
+			}
 			GUI::SetAppearance(m_handle, m_appearance);
 
 			if (!isPanel)
@@ -181,11 +204,16 @@ namespace Berta
 	protected:
 		virtual void DoOnNotifyDestroy() override
 		{
-			m_events = std::make_shared<EventsType>();
+			m_events.reset();
+		}
+
+		virtual void DoOnCreateEvents() const override
+		{
+			GetEvents();
 		}
 
 		ReactorType m_reactor;
-		std::shared_ptr<EventsType> m_events;
+		mutable std::shared_ptr<EventsType> m_events;
 		std::shared_ptr<AppearanceType> m_appearance;
 	};
 }
@@ -56,6 +56,7 @@ namespace Berta
             bool Ctrl : 1;
             bool Shift : 1;
         }ButtonState;
+        uint32_t RepeatCount{ 1 }; // Auto-repeated key presses folded into one event.
     };
 
 	struct ArgDestroy
@@ -64,8 +65,17 @@ namespace Berta
 
 	struct ArgWheel
 	{
+		static constexpr int DeltaPerNotch = 120;
+
 		int WheelDelta;
 		bool IsVertical;
+
+		// Wheel deltas can be accumulated, this is the number of steps to scroll (at least one).
+		int GetNotches() const
+		{
+			int notches = ((WheelDelta < 0 ? -WheelDelta : WheelDelta) + DeltaPerNotch / 2) / DeltaPerNotch;
+			return notches > 0 ? notches : 1;
+		}
 	};
 
 	struct ArgVisibility
@@ -93,6 +103,27 @@ namespace Berta
 		Event<ArgKeyboard>		KeyReleased;
 		Event<ArgDestroy>		Destroy;
 		Event<ArgVisibility>	Visibility;
+
+		// Drops every handler connected with the given owner key.
+		virtual void DisconnectAll(EventOwner owner)
+		{
+			MouseEnter.DisconnectAll(owner);
+			MouseLeave.DisconnectAll(owner);
+			MouseDown.DisconnectAll(owner);
+			MouseMove.DisconnectAll(owner);
+			MouseWheel.DisconnectAll(owner);
+			MouseUp.DisconnectAll(owner);
+			Click.DisconnectAll(owner);
+			DblClick.DisconnectAll(owner);
+			Resize.DisconnectAll(owner);
+			Move.DisconnectAll(owner);
+			Focus.DisconnectAll(owner);
+			KeyChar.DisconnectAll(owner);
+			KeyPressed.DisconnectAll(owner);
+			KeyReleased.DisconnectAll(owner);
+			Destroy.DisconnectAll(owner);
+			Visibility.DisconnectAll(owner);
+		}
 	};
 
 	struct ArgSizeMove
@@ -115,6 +146,15 @@ namespace Berta
 		Event<ArgSizeMove>	EnterSizeMove;
 		Event<ArgSizeMove>	ExitSizeMove;
 		Event<ArgDisposing>	Disposing;
+
+		void DisconnectAll(EventOwner owner) override
+		{
+			ControlEvents::DisconnectAll(owner);
+			Activated.DisconnectAll(owner);
+			EnterSizeMove.DisconnectAll(owner);
+			ExitSizeMove.DisconnectAll(owner);
+			Disposing.DisconnectAll(owner);
+		}
 	};
 }
 
@@ -24,6 +24,11 @@ namespace Berta
 	{
 	}
 
+	void ControlReactor::Update(Graphics& graphics, const Rectangle& damage)
+	{
+		Update(graphics);
+	}
+
 	void ControlReactor::MouseEnter(Graphics& graphics, const ArgMouse& args)
 	{
 	}
@@ -24,6 +24,10 @@ namespace Berta
 		virtual void Init(ControlBase& control);
 		virtual void Shutdown();
 		virtual void Update(Graphics& graphics);
+		// Drawing is clipped to the damaged area, reactors can skip what lies outside. Defaults to Update(graphics).
+		virtual void Update(Graphics& graphics, const Rectangle& damage);
+		// True when Update paints every pixel of the client area with opaque colors, so whatever lies below can be culled.
+		virtual bool IsOpaque() const { return false; }
 		virtual void MouseEnter(Graphics& graphics, const ArgMouse& args);
 		virtual void MouseLeave(Graphics& graphics, const ArgMouse& args);
 		virtual void MouseDown(Graphics& graphics, const ArgMouse& args);
@@ -0,0 +1,77 @@
+/*
+* MIT License
+*
+* Copyright (c) 2024 Edgar Bernal (edgar.bernal@gmail.com)
+*/
+
+#include "btpch.h"
+#include "Coroutine.h"
+
+#include "Berta/Core/Foundation.h"
+#include "Berta/GUI/Async.h"
+#include "Berta/Paint/DrawBatch.h"
+
+namespace Berta::Detail
+{
+	void ResumeOnUiThread(WindowHandle ownerHandle, std::coroutine_handle<> handle)
+	{
+		// Always resumed, even if the owner is gone: the coroutine has to unwind (await_resume throws).
+		Foundation::GetInstance().GetMessageLoop().PostTask([ownerHandle, handle]()
+		{
+			auto owner = Foundation::GetInstance().GetWindowManager().Get(ownerHandle);
+			if (owner == nullptr)
+			{
+				handle.resume();
+				return;
+			}
+
+			auto rootWindow = owner->RootWindow;
+			DrawBatch drawBatch(rootWindow);
+			Foundation::RootGuard rootGuard(rootWindow);
+			handle.resume();
+		});
+	}
+
+	void ResumeOnThreadPool(std::coroutine_handle<> handle, WorkPriority priority)
+	{
+		SubmitToThreadPool([handle]()
+		{
+			handle.resume();
+		}, priority);
+	}
+
+	void SubmitToThreadPool(ThreadPool::Work work, WorkPriority priority)
+	{
+		Foundation::GetInstance().GetThreadPool().Submit(std::move(work), priority);
+	}
+
+	CancellationToken GetCoroutineOwnerToken(Window* owner)
+	{
+		return GUI::GetWindowLifetimeToken(owner);
+	}
+
+	bool IsCoroutineUiThread()
+	{
+		return GUI::IsUIThread();
+	}
+
+	void LogUnhandledCoroutineException(std::exception_ptr exception)
+	{
+		try
+		{
+			std::rethrow_exception(exception);
+		}
+		catch (const OperationCancelled&)
+		{
+			// The owner window went away, nothing to report.
+		}
+		catch (const std::exception& e)
+		{
+			BT_CORE_ERROR << "Unhandled exception in a detached Task: " << e.what() << std::endl;
+		}
+		catch (...)
+		{
+			BT_CORE_ERROR << "Unhandled unknown exception in a detached Task." << std::endl;
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,419 @@
+/*
+* MIT License
+*
+* Copyright (c) 2024 Edgar Bernal (edgar.bernal@gmail.com)
+*/
+
+#ifndef BT_COROUTINE_HEADER
+#define BT_COROUTINE_HEADER
+
+#include <atomic>
+#include <coroutine>
+#include <cstdint>
+#include <exception>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include "Berta/Core/CancellationToken.h"
+#include "Berta/Core/ThreadPool.h"
+#include "Berta/GUI/Control.h"
+#include "Berta/GUI/WindowRegistry.h"
+
+namespace Berta
+{
+	struct Window;
+
+	/*
+	* Thrown from a co_await when the coroutine's owner window was destroyed while it was suspended.
+	* A detached Task swallows it, so the frame just unwinds.
+	*/
+	class OperationCancelled : public std::exception
+	{
+	public:
+		const char* what() const noexcept override { return "Operation cancelled"; }
+	};
+
+	namespace Detail
+	{
+		void ResumeOnUiThread(WindowHandle owner, std::coroutine_handle<> handle);
+		void ResumeOnThreadPool(std::coroutine_handle<> handle, WorkPriority priority);
+		void SubmitToThreadPool(ThreadPool::Work work, WorkPriority priority);
+		CancellationToken GetCoroutineOwnerToken(Window* owner);
+		bool IsCoroutineUiThread();
+		void LogUnhandledCoroutineException(std::exception_ptr exception);
+
+		class TaskPromiseBase
+		{
+		public:
+			TaskPromiseBase() = default;
+
+			// Member coroutines of a control (or coroutines taking a Window* first) are owned by its window.
+			template <typename First, typename... Rest>
+			TaskPromiseBase(First& first, Rest&...)
+			{
+				if constexpr (std::is_base_of_v<ControlBase, std::remove_cv_t<First>>)
+				{
+					Bind(first.Handle());
+				}
+				else if constexpr (std::is_convertible_v<First&, Window*>)
+				{
+					Bind(static_cast<Window*>(first));
+				}
+			}
+
+			std::suspend_never initial_suspend() noexcept { return {}; }
+
+			struct FinalAwaiter
+			{
+				bool await_ready() noexcept { return false; }
+
+				template <typename Promise>
+				std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) noexcept
+				{
+					return handle.promise().Complete(handle);
+				}
+
+				void await_resume() noexcept {}
+			};
+
+			FinalAwaiter final_suspend() noexcept { return {}; }
+
+			void unhandled_exception() { m_exception = std::current_exception(); }
+
+			WindowHandle GetOwnerHandle() const { return m_ownerHandle; }
+			const CancellationToken& GetToken() const { return m_token; }
+
+			// State shared with the Task object. Whoever gets there last destroys the frame.
+			static constexpr uintptr_t Running = 0;
+			static constexpr uintptr_t Detached = 1;
+			static constexpr uintptr_t Completed = 2;
+
+			bool TryAwait(std::coroutine_handle<> continuation)
+			{
+				auto expected = Running;
+				return m_state.compare_exchange_strong(expected, reinterpret_cast<uintptr_t>(continuation.address()), std::memory_order_acq_rel);
+			}
+
+			bool TryDetach()
+			{
+				auto expected = Running;
+				return m_state.compare_exchange_strong(expected, Detached, std::memory_order_acq_rel);
+			}
+
+			bool IsCompleted() const { return m_state.load(std::memory_order_acquire) == Completed; }
+
+		protected:
+			// Runs on the UI thread, the handle is what other threads get to see of the owner.
+			void Bind(Window* owner)
+			{
+				m_ownerHandle = owner ? owner->Handle : InvalidWindowHandle;
+				m_token = GetCoroutineOwnerToken(owner);
+			}
+
+			void RethrowIfFailed()
+			{
+				if (m_exception)
+				{
+					std::rethrow_exception(m_exception);
+				}
+			}
+
+			std::coroutine_handle<> Complete(std::coroutine_handle<> handle) noexcept
+			{
+				auto previous = m_state.exchange(Completed, std::memory_order_acq_rel);
+				if (previous == Detached)
+				{
+					// Nobody will ever look at the result.
+					if (m_exception)
+					{
+						LogUnhandledCoroutineException(m_exception);
+					}
+					handle.destroy();
+					return std::noop_coroutine();
+				}
+
+				if (previous == Running)
+				{
+					return std::noop_coroutine(); // The Task object still owns the frame.
+				}
+				return std::coroutine_handle<>::from_address(reinterpret_cast<void*>(previous));
+			}
+
+			std::exception_ptr m_exception;
+
+		private:
+			WindowHandle m_ownerHandle{ InvalidWindowHandle };
+			CancellationToken m_token;
+			std::atomic<uintptr_t> m_state{ Running };
+		};
+
+		template <typename Result>
+		class TaskPromise : public TaskPromiseBase
+		{
+		public:
+			using TaskPromiseBase::TaskPromiseBase;
+
+			template <typename Value>
+			void return_value(Value&& value) { m_value.emplace(std::forward<Value>(value)); }
+
+			Result TakeResult()
+			{
+				RethrowIfFailed();
+				return std::move(*m_value);
+			}
+
+		private:
+			std::optional<Result> m_value;
+		};
+
+		template <>
+		class TaskPromise<void> : public TaskPromiseBase
+		{
+		public:
+			using TaskPromiseBase::TaskPromiseBase;
+
+			void return_void() {}
+			void TakeResult() { RethrowIfFailed(); }
+		};
+
+		// Awaiters need the promise of the awaiting coroutine to know whether it was cancelled.
+		template <typename Promise>
+		TaskPromiseBase* GetTaskPromise(std::coroutine_handle<Promise> handle)
+		{
+			if constexpr (std::is_base_of_v<TaskPromiseBase, Promise>)
+			{
+				return &handle.promise();
+			}
+			else
+			{
+				return nullptr;
+			}
+		}
+
+		inline void ThrowIfCancelled(TaskPromiseBase* promise)
+		{
+			if (promise && promise->GetToken().IsCancelled())
+			{
+				throw OperationCancelled();
+			}
+		}
+	}
+
+	/*
+	* Eager coroutine: it runs right away until its first suspension. Dropping the Task detaches it, the
+	* frame destroys itself when it finishes. co_await-ing it resumes the caller once it completes.
+	*/
+	template <typename Result = void>
+	class Task
+	{
+	public:
+		class promise_type : public Detail::TaskPromise<Result>
+		{
+		public:
+			using Detail::TaskPromise<Result>::TaskPromise;
+
+			Task get_return_object() { return Task(std::coroutine_handle<promise_type>::from_promise(*this)); }
+		};
+
+		Task() = default;
+		Task(Task&& other) noexcept : m_handle(std::exchange(other.m_handle, nullptr)) {}
+
+		Task& operator=(Task&& other) noexcept
+		{
+			if (this != &other)
+			{
+				Release();
+				m_handle = std::exchange(other.m_handle, nullptr);
+			}
+			return *this;
+		}
+
+		Task(const Task&) = delete;
+		Task& operator=(const Task&) = delete;
+
+		~Task()
+		{
+			Release();
+		}
+
+		bool IsCompleted() const { return m_handle && m_handle.promise().IsCompleted(); }
+
+		auto operator co_await() && noexcept
+		{
+			struct Awaiter
+			{
+				std::coroutine_handle<promise_type> Handle;
+
+				bool await_ready() const noexcept { return Handle.promise().IsCompleted(); }
+
+				bool await_suspend(std::coroutine_handle<> continuation) noexcept
+				{
+					return Handle.promise().TryAwait(continuation); // False: it completed meanwhile, go on.
+				}
+
+				Result await_resume()
+				{
+					return Handle.promise().TakeResult();
+				}
+			};
+			return Awaiter{ m_handle };
+		}
+
+	private:
+		explicit Task(std::coroutine_handle<promise_type> handle) : m_handle(handle) {}
+
+		void Release()
+		{
+			if (!m_handle)
+			{
+				return;
+			}
+
+			auto handle = std::exchange(m_handle, nullptr);
+			if (!handle.promise().TryDetach())
+			{
+				handle.destroy(); // Already finished (or awaited and finished), the frame is ours.
+			}
+		}
+
+		std::coroutine_handle<promise_type> m_handle;
+	};
+
+	/*
+	* co_await UiThread(): continues on the UI thread, inside a draw batch of the owner window.
+	*/
+	class UiThread
+	{
+	public:
+		bool await_ready() const { return false; }
+
+		// Already on the UI thread: continues inline, but still through await_resume so cancellation is checked.
+		template <typename Promise>
+		bool await_suspend(std::coroutine_handle<Promise> handle)
+		{
+			m_promise = Detail::GetTaskPromise(handle);
+			if (Detail::IsCoroutineUiThread())
+			{
+				return false;
+			}
+
+			Detail::ResumeOnUiThread(m_promise ? m_promise->GetOwnerHandle() : InvalidWindowHandle, handle);
+			return true;
+		}
+
+		void await_resume() const
+		{
+			Detail::ThrowIfCancelled(m_promise);
+		}
+
+	private:
+		Detail::TaskPromiseBase* m_promise{ nullptr };
+	};
+
+	/*
+	* co_await Background(): continues on a thread pool worker.
+	* co_await Background(work): runs work in the pool and returns its result, the coroutine continues
+	* on that worker. Switch back with co_await UiThread() before touching any control.
+	*/
+	template <typename Work = void>
+	class Background
+	{
+	public:
+		using Result = std::invoke_result_t<Work&>;
+
+		explicit Background(Work work, WorkPriority priority = WorkPriority::Visible) :
+			m_work(std::move(work)),
+			m_priority(priority)
+		{
+		}
+
+		bool await_ready() const { return false; }
+
+		template <typename Promise>
+		void await_suspend(std::coroutine_handle<Promise> handle)
+		{
+			m_promise = Detail::GetTaskPromise(handle);
+			Detail::SubmitToThreadPool([this, handle]()
+			{
+				if (!m_promise || !m_promise->GetToken().IsCancelled())
+				{
+					try
+					{
+						if constexpr (std::is_void_v<Result>)
+						{
+							m_work();
+						}
+						else
+						{
+							m_result.emplace(m_work());
+						}
+					}
+					catch (...)
+					{
+						m_exception = std::current_exception();
+					}
+				}
+				handle.resume();
+			}, m_priority);
+		}
+
+		Result await_resume()
+		{
+			Detail::ThrowIfCancelled(m_promise);
+			if (m_exception)
+			{
+				std::rethrow_exception(m_exception);
+			}
+
+			if constexpr (!std::is_void_v<Result>)
+			{
+				return std::move(*m_result);
+			}
+		}
+
+	private:
+		using Storage = std::conditional_t<std::is_void_v<Result>, bool, Result>;
+
+		Work m_work;
+		WorkPriority m_priority;
+		Detail::TaskPromiseBase* m_promise{ nullptr };
+		std::optional<Storage> m_result;
+		std::exception_ptr m_exception;
+	};
+
+	template <>
+	class Background<void>
+	{
+	public:
+		explicit Background(WorkPriority priority = WorkPriority::Visible) : m_priority(priority) {}
+
+		bool await_ready() const { return false; }
+
+		template <typename Promise>
+		void await_suspend(std::coroutine_handle<Promise> handle)
+		{
+			m_promise = Detail::GetTaskPromise(handle);
+			Detail::ResumeOnThreadPool(handle, m_priority);
+		}
+
+		void await_resume() const
+		{
+			Detail::ThrowIfCancelled(m_promise);
+		}
+
+	private:
+		WorkPriority m_priority;
+		Detail::TaskPromiseBase* m_promise{ nullptr };
+	};
+
+	template <typename Work>
+	Background(Work, WorkPriority) -> Background<Work>;
+
+	template <typename Work>
+	Background(Work) -> Background<Work>;
+
+	Background()->Background<void>;
+	Background(WorkPriority)->Background<void>;
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,114 @@
+/*
+* MIT License
+*
+* Copyright (c) 2024 Edgar Bernal (edgar.bernal@gmail.com)
+*/
+
+#include "btpch.h"
+#include "FrameScheduler.h"
+
+#include "Berta/GUI/Window.h"
+#include "Berta/GUI/WindowManager.h"
+#include "Berta/Paint/DrawBatch.h"
+
+#include <algorithm>
+
+namespace Berta
+{
+	FrameScheduler::FrameScheduler(WindowManager& windowManager, TimerWheel& timerWheel) :
+		m_windowManager(windowManager),
+		m_timerWheel(timerWheel)
+	{
+		m_frameTimer.Callback = [this]()
+		{
+			RunFrame();
+		};
+	}
+
+	FrameScheduler::~FrameScheduler()
+	{
+		m_timerWheel.Cancel(m_frameTimer);
+	}
+
+	void FrameScheduler::Invalidate(Window* window)
+	{
+		++m_statistics.Invalidations;
+		if (window->Flags.isUpdating)
+		{
+			++m_statistics.Coalesced; // Being drawn right now.
+			return;
+		}
+
+		if (!m_pendingSet.emplace(window->Handle).second)
+		{
+			++m_statistics.Coalesced;
+			return;
+		}
+
+		m_pending.emplace_back(window->Handle);
+		ScheduleFrame();
+	}
+
+	void FrameScheduler::FlushNow()
+	{
+		m_timerWheel.Cancel(m_frameTimer);
+		RunFrame();
+	}
+
+	void FrameScheduler::SetTargetFrameRate(uint32_t framesPerSecond)
+	{
+		m_frameInterval = std::chrono::milliseconds{ 1000 / (std::max)(framesPerSecond, 1u) };
+	}
+
+	void FrameScheduler::ScheduleFrame()
+	{
+		if (m_frameTimer.IsScheduled())
+		{
+			return;
+		}
+
+		// Right away after an idle period, otherwise one interval after the previous frame.
+		m_timerWheel.ScheduleAt(m_frameTimer, (std::max)(Clock::now(), m_lastFrame + m_frameInterval));
+	}
+
+	void FrameScheduler::RunFrame()
+	{
+		if (m_pending.empty())
+		{
+			return;
+		}
+
+		m_lastFrame = Clock::now();
+		++m_statistics.Frames;
+
+		auto pending = std::move(m_pending);
+		m_pending.clear();
+		m_pendingSet.clear();
+
+		std::vector<Window*> windows;
+		windows.reserve(pending.size());
+		for (auto handle : pending)
+		{
+			auto window = m_windowManager.Get(handle);
+			if (window && !window->Flags.IsDisposed)
+			{
+				windows.emplace_back(window);
+			}
+		}
+
+		// One batch per form: every window of it is updated, then composed and presented once.
+		std::stable_sort(windows.begin(), windows.end(), [](Window* a, Window* b) { return a->RootWindow < b->RootWindow; });
+		for (size_t i = 0; i < windows.size();)
+		{
+			auto rootWindow = windows[i]->RootWindow;
+			{
+				DrawBatch drawBatch(rootWindow);
+				for (; i < windows.size() && windows[i]->RootWindow == rootWindow; ++i)
+				{
+					m_windowManager.Update(windows[i]);
+				}
+			}
+			++m_statistics.Presents;
+		}
+	}
+}
\ No newline at end of file
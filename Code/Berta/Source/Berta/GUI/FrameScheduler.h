@@ -0,0 +1,75 @@
+/*
+* MIT License
+*
+* Copyright (c) 2024 Edgar Bernal (edgar.bernal@gmail.com)
+*/
+
+#ifndef BT_FRAME_SCHEDULER_HEADER
+#define BT_FRAME_SCHEDULER_HEADER
+
+#include <chrono>
+#include <cstdint>
+#include <unordered_set>
+#include <vector>
+#include "Berta/Core/TimerWheel.h"
+#include "Berta/GUI/WindowRegistry.h"
+
+namespace Berta
+{
+	struct Window;
+	class WindowManager;
+
+	/*
+	* Windows invalidated outside of a draw batch (GUI::UpdateWindow from module code, setup code, etc.) are only
+	* marked here. One frame per display interval updates all of them, composes and presents each form once.
+	* UI thread only.
+	*/
+	class FrameScheduler
+	{
+	public:
+		using Clock = std::chrono::steady_clock;
+
+		static constexpr uint32_t DefaultFrameRate = 60;
+
+		struct Statistics
+		{
+			uint64_t Invalidations{ 0 };
+			uint64_t Coalesced{ 0 };	// Invalidations of a window already waiting for the frame.
+			uint64_t Frames{ 0 };
+			uint64_t Presents{ 0 };		// One per form drawn in a frame.
+		};
+
+		FrameScheduler(WindowManager& windowManager, TimerWheel& timerWheel);
+		~FrameScheduler();
+
+		FrameScheduler(const FrameScheduler&) = delete;
+		FrameScheduler& operator=(const FrameScheduler&) = delete;
+
+		void Invalidate(Window* window);
+		// Runs the pending frame right away instead of waiting for the timer.
+		void FlushNow();
+
+		void SetTargetFrameRate(uint32_t framesPerSecond);
+		bool HasPendingFrame() const { return !m_pending.empty(); }
+
+		const Statistics& GetStatistics() const { return m_statistics; }
+
+	private:
+		void ScheduleFrame();
+		void RunFrame();
+
+		WindowManager& m_windowManager;
+		TimerWheel& m_timerWheel;
+		TimerWheel::Entry m_frameTimer;
+
+		std::vector<WindowHandle> m_pending;
+		std::unordered_set<WindowHandle> m_pendingSet;
+
+		std::chrono::milliseconds m_frameInterval{ 1000 / DefaultFrameRate };
+		Clock::time_point m_lastFrame{};
+
+		Statistics m_statistics;
+	};
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,268 @@
+/*
+* MIT License
+*
+* Copyright (c) 2024 Edgar Bernal (edgar.bernal@gmail.com)
+*/
+
+#include "btpch.h"
+#include "HitTestIndex.h"
+
+#include "Berta/GUI/Window.h"
+
+#include <algorithm>
+
+namespace Berta
+{
+	void HitTestIndex::Move(Window* window)
+	{
+		if (m_dirty)
+		{
+			return;
+		}
+
+		auto it = m_items.find(window);
+		if (it != m_items.end())
+		{
+			++m_statistics.Updates;
+			UpdateSubtree(it->second, true);
+		}
+	}
+
+	void HitTestIndex::Resize(Window* window)
+	{
+		if (m_dirty)
+		{
+			return;
+		}
+
+		auto it = m_items.find(window);
+		if (it != m_items.end())
+		{
+			++m_statistics.Updates;
+			UpdateSubtree(it->second, false);
+		}
+	}
+
+	Window* HitTestIndex::Find(Window* root, const Point& point)
+	{
+		if (m_dirty)
+		{
+			Rebuild(root);
+		}
+		++m_statistics.Queries;
+
+		if (point.X < 0 || point.Y < 0)
+		{
+			return root;
+		}
+
+		auto column = point.X / CellSize;
+		auto row = point.Y / CellSize;
+		if (column >= m_columns || row >= m_rows)
+		{
+			return root;
+		}
+
+		auto& cell = m_cells[static_cast<size_t>(row) * m_columns + column];
+		for (auto it = cell.rbegin(); it != cell.rend(); ++it)
+		{
+			++m_statistics.Candidates;
+			if (IsHit(**it, point))
+			{
+				return (*it)->WindowPtr;
+			}
+		}
+
+		return root;
+	}
+
+	bool HitTestIndex::IsOccluded(Window* root, Window* window, const Rectangle& area)
+	{
+		if (m_dirty)
+		{
+			Rebuild(root);
+		}
+		++m_statistics.OcclusionQueries;
+
+		const Item* windowItem = nullptr;
+		if (window != root)
+		{
+			auto it = m_items.find(window);
+			if (it == m_items.end())
+			{
+				return false;
+			}
+			windowItem = &it->second;
+		}
+
+		// Any rectangle covering the area covers its top left corner too.
+		auto column = (std::max)(area.X, 0) / CellSize;
+		auto row = (std::max)(area.Y, 0) / CellSize;
+		if (area.Width == 0 || area.Height == 0 || column >= m_columns || row >= m_rows)
+		{
+			return false;
+		}
+
+		auto& cell = m_cells[static_cast<size_t>(row) * m_columns + column];
+		for (auto it = cell.rbegin(); it != cell.rend(); ++it)
+		{
+			if (windowItem && (*it)->Rank <= windowItem->Rank)
+			{
+				break; // Painted before the window.
+			}
+
+			if ((*it)->WindowPtr->Renderer.IsOpaque() && Covers(**it, area))
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	void HitTestIndex::Rebuild(Window* root)
+	{
+		++m_statistics.Rebuilds;
+
+		m_items.clear();
+
+		// IsInside includes the right and bottom edges, so does the grid.
+		m_columns = static_cast<int>(root->ClientSize.Width) / CellSize + 1;
+		m_rows = static_cast<int>(root->ClientSize.Height) / CellSize + 1;
+		m_cells.assign(static_cast<size_t>(m_columns) * m_rows, {});
+
+		uint32_t rank = 0;
+		for (auto& child : root->Children)
+		{
+			AddSubtree(child, nullptr, rank);
+		}
+
+		m_dirty = false;
+	}
+
+	void HitTestIndex::AddSubtree(Window* window, Item* parentItem, uint32_t& rank)
+	{
+		if (window->IsNative())
+		{
+			return; // Nested forms have their own index.
+		}
+
+		auto& item = m_items[window];
+		item.WindowPtr = window;
+		item.ParentItem = parentItem;
+		item.Rank = rank++;
+		UpdateSubtree(item, false); // Pre-order, cells end up sorted by rank.
+
+		for (auto& child : window->Children)
+		{
+			AddSubtree(child, &item, rank);
+		}
+	}
+
+	void HitTestIndex::UpdateSubtree(Item& item, bool recursive)
+	{
+		Remove(item);
+
+		auto window = item.WindowPtr;
+		Point origin = item.ParentItem ? Point{ item.ParentItem->Bounds.X, item.ParentItem->Bounds.Y } : Point{};
+		item.Bounds = Rectangle{ origin.X + window->Position.X, origin.Y + window->Position.Y, window->ClientSize.Width, window->ClientSize.Height };
+
+		Insert(item);
+
+		if (!recursive)
+		{
+			return;
+		}
+
+		for (auto& child : window->Children)
+		{
+			auto it = m_items.find(child);
+			if (it != m_items.end())
+			{
+				UpdateSubtree(it->second, true);
+			}
+		}
+	}
+
+	void HitTestIndex::Insert(Item& item)
+	{
+		auto& bounds = item.Bounds;
+		auto right = bounds.X + static_cast<int>(bounds.Width);
+		auto bottom = bounds.Y + static_cast<int>(bounds.Height);
+		if (right < 0 || bottom < 0)
+		{
+			item.CellRight = item.CellBottom = -1;
+			return;
+		}
+
+		item.CellLeft = (std::max)(bounds.X, 0) / CellSize;
+		item.CellTop = (std::max)(bounds.Y, 0) / CellSize;
+		item.CellRight = (std::min)(right / CellSize, m_columns - 1);
+		item.CellBottom = (std::min)(bottom / CellSize, m_rows - 1);
+
+		for (int row = item.CellTop; row <= item.CellBottom; ++row)
+		{
+			for (int column = item.CellLeft; column <= item.CellRight; ++column)
+			{
+				auto& cell = m_cells[static_cast<size_t>(row) * m_columns + column];
+				if (cell.empty() || cell.back()->Rank < item.Rank)
+				{
+					cell.emplace_back(&item);
+				}
+				else
+				{
+					cell.insert(std::upper_bound(cell.begin(), cell.end(), &item, ByRank), &item);
+				}
+			}
+		}
+	}
+
+	void HitTestIndex::Remove(Item& item)
+	{
+		for (int row = item.CellTop; row <= item.CellBottom; ++row)
+		{
+			for (int column = item.CellLeft; column <= item.CellRight; ++column)
+			{
+				auto& cell = m_cells[static_cast<size_t>(row) * m_columns + column];
+				auto it = std::lower_bound(cell.begin(), cell.end(), &item, ByRank);
+				if (it != cell.end() && *it == &item)
+				{
+					cell.erase(it);
+				}
+			}
+		}
+		item.CellRight = item.CellBottom = -1;
+	}
+
+	bool HitTestIndex::ByRank(const Item* lhs, const Item* rhs)
+	{
+		return lhs->Rank < rhs->Rank;
+	}
+
+	bool HitTestIndex::Covers(const Item& item, const Rectangle& area) const
+	{
+		// Like IsHit, the window is only seen inside its ancestors, which must be visible as well.
+		for (auto current = &item; current; current = current->ParentItem)
+		{
+			auto& bounds = current->Bounds;
+			if (!current->WindowPtr->Visible || area.X < bounds.X || area.Y < bounds.Y ||
+				area.X + (int)area.Width > bounds.X + (int)bounds.Width || area.Y + (int)area.Height > bounds.Y + (int)bounds.Height)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	bool HitTestIndex::IsHit(const Item& item, const Point& point) const
+	{
+		// Same conditions as FindInTree: the window and all its ancestors visible and under the point.
+		for (auto current = &item; current; current = current->ParentItem)
+		{
+			if (!current->WindowPtr->Visible || !current->Bounds.IsInside(point))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,89 @@
+/*
+* MIT License
+*
+* Copyright (c) 2024 Edgar Bernal (edgar.bernal@gmail.com)
+*/
+
+#ifndef BT_HIT_TEST_INDEX_HEADER
+#define BT_HIT_TEST_INDEX_HEADER
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+#include "Berta/Core/BasicTypes.h"
+
+namespace Berta
+{
+	struct Window;
+
+	/*
+	* Uniform grid over the root-relative rectangles of a form's (non native) windows, so a hit test only
+	* looks at the windows overlapping the point's cell instead of walking the whole tree.
+	* Each window has its pre-order rank in the hierarchy, the winner is the valid candidate with the highest one,
+	* which is the same window FindInTree returns (topmost child, then deepest).
+	* Visibility is not cached, it is checked on the candidates, so Show doesn't need to touch the index.
+	*/
+	class HitTestIndex
+	{
+	public:
+		static constexpr int CellSize = 64;
+
+		struct Statistics
+		{
+			uint64_t Queries{ 0 };
+			uint64_t Candidates{ 0 };
+			uint64_t Rebuilds{ 0 };
+			uint64_t Updates{ 0 };
+			uint64_t OcclusionQueries{ 0 };
+		};
+
+		// The hierarchy changed (create, destroy, reparent, DPI or root size), rebuilt on the next query.
+		void Invalidate() { m_dirty = true; }
+
+		// Position of the window changed: updates its rectangle and its children's.
+		void Move(Window* window);
+		// Size of the window changed: updates its own rectangle only.
+		void Resize(Window* window);
+
+		// The root must be visible and contain the point, see WindowManager::Find.
+		Window* Find(Window* root, const Point& point);
+		// True when an opaque window painted after this one (root included) covers the whole area, root relative.
+		bool IsOccluded(Window* root, Window* window, const Rectangle& area);
+
+		const Statistics& GetStatistics() const { return m_statistics; }
+
+	private:
+		struct Item
+		{
+			Window* WindowPtr{ nullptr };
+			Item* ParentItem{ nullptr };	// Null for children of the root.
+			Rectangle Bounds;				// Root relative.
+			uint32_t Rank{ 0 };				// Pre-order position.
+
+			int CellLeft{ 0 };
+			int CellTop{ 0 };
+			int CellRight{ -1 };			// Inclusive, empty when right < left.
+			int CellBottom{ -1 };
+		};
+
+		void Rebuild(Window* root);
+		void AddSubtree(Window* window, Item* parentItem, uint32_t& rank);
+		void UpdateSubtree(Item& item, bool recursive);
+
+		void Insert(Item& item);
+		void Remove(Item& item);
+		bool IsHit(const Item& item, const Point& point) const;
+		bool Covers(const Item& item, const Rectangle& area) const;
+		static bool ByRank(const Item* lhs, const Item* rhs);
+
+		std::unordered_map<Window*, Item> m_items;	// Node based, Item pointers stay valid.
+		std::vector<std::vector<Item*>> m_cells;	// Sorted by rank.
+		int m_columns{ 0 };
+		int m_rows{ 0 };
+		bool m_dirty{ true };
+
+		Statistics m_statistics;
+	};
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,100 @@
+/*
+* MIT License
+*
+* Copyright (c) 2024 Edgar Bernal (edgar.bernal@gmail.com)
+*/
+
+#include "btpch.h"
+#include "InputQueue.h"
+
+namespace Berta
+{
+	bool InputQueue::Push(const InputEvent& inputEvent)
+	{
+		++m_statistics.Queued;
+
+		bool wasEmpty = m_pending.empty();
+		if (!wasEmpty && TryMerge(m_pending.back(), inputEvent))
+		{
+			++m_statistics.Coalesced;
+			return false;
+		}
+
+		m_pending.emplace_back(inputEvent);
+		return wasEmpty && !m_isFlushing;
+	}
+
+	void InputQueue::Flush()
+	{
+		// Handlers may pump messages and queue more input, the outermost Flush drains it.
+		if (m_isFlushing)
+		{
+			return;
+		}
+
+		m_isFlushing = true;
+		while (!m_pending.empty())
+		{
+			std::swap(m_pending, m_dispatching);
+			for (auto& inputEvent : m_dispatching)
+			{
+				++m_statistics.Dispatched;
+				if (m_dispatcher)
+				{
+					m_dispatcher(inputEvent);
+				}
+			}
+			m_dispatching.clear();
+		}
+		m_isFlushing = false;
+	}
+
+	bool InputQueue::TryMerge(InputEvent& target, const InputEvent& inputEvent)
+	{
+		if (target.EventType != inputEvent.EventType || target.NativeHandle != inputEvent.NativeHandle)
+		{
+			return false;
+		}
+
+		switch (inputEvent.EventType)
+		{
+		case InputEvent::Type::MouseMove:
+			// A button change in between must be seen by the handlers.
+			if (target.ButtonState.LeftButton != inputEvent.ButtonState.LeftButton ||
+				target.ButtonState.RightButton != inputEvent.ButtonState.RightButton ||
+				target.ButtonState.MiddleButton != inputEvent.ButtonState.MiddleButton)
+			{
+				return false;
+			}
+			target.Position = inputEvent.Position;
+			return true;
+
+		case InputEvent::Type::MouseWheel:
+			if (target.Wheel.IsVertical != inputEvent.Wheel.IsVertical ||
+				(target.Wheel.WheelDelta > 0) != (inputEvent.Wheel.WheelDelta > 0))
+			{
+				return false;
+			}
+			target.Position = inputEvent.Position;
+			target.Wheel.WheelDelta += inputEvent.Wheel.WheelDelta;
+			return true;
+
+		case InputEvent::Type::Resize:
+			target.NewSize = inputEvent.NewSize;
+			return true;
+
+		case InputEvent::Type::KeyPressed:
+			if (!inputEvent.IsAutoRepeat ||
+				target.Keyboard.Key != inputEvent.Keyboard.Key ||
+				target.Keyboard.ButtonState.Alt != inputEvent.Keyboard.ButtonState.Alt ||
+				target.Keyboard.ButtonState.Ctrl != inputEvent.Keyboard.ButtonState.Ctrl ||
+				target.Keyboard.ButtonState.Shift != inputEvent.Keyboard.ButtonState.Shift)
+			{
+				return false;
+			}
+			target.Keyboard.RepeatCount += inputEvent.Keyboard.RepeatCount;
+			return true;
+		}
+		return false;
+	}
+}
\ No newline at end of file
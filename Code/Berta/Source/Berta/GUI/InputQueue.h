@@ -0,0 +1,82 @@
+/*
+* MIT License
+*
+* Copyright (c) 2024 Edgar Bernal (edgar.bernal@gmail.com)
+*/
+
+#ifndef BT_INPUT_QUEUE_HEADER
+#define BT_INPUT_QUEUE_HEADER
+
+#include <cstdint>
+#include <vector>
+#include "Berta/API/WindowAPI.h"
+#include "Berta/Core/BasicTypes.h"
+#include "Berta/Core/Delegate.h"
+#include "Berta/GUI/ControlEvents.h"
+
+namespace Berta
+{
+	struct InputEvent
+	{
+		enum class Type
+		{
+			MouseMove,
+			MouseWheel,
+			Resize,
+			KeyPressed
+		};
+
+		Type EventType{ Type::MouseMove };
+		API::NativeWindowHandle NativeHandle;
+
+		Point Position;					// MouseMove / MouseWheel, in the coordinates the platform reported them.
+		MouseButtonState ButtonState{};	// MouseMove
+		ArgWheel Wheel{};				// MouseWheel
+		Size NewSize;					// Resize
+		ArgKeyboard Keyboard{};			// KeyPressed
+		bool IsAutoRepeat{ false };		// KeyPressed
+	};
+
+	/*
+	* Sits between the platform message handler and Foundation::ProcessEvents.
+	* High-frequency input is queued and merged with the previous queued event when it is the same kind
+	* and targets the same native window:
+	*   - mouse moves keep the last position,
+	*   - wheel deltas are added up,
+	*   - resizes keep the last size,
+	*   - key auto-repeats are folded into ArgKeyboard::RepeatCount, KeyPressed handlers apply the key that many times.
+	* Any other input must Flush first so the dispatch order is preserved.
+	*/
+	class InputQueue
+	{
+	public:
+		using Dispatcher = Delegate<void(const InputEvent&)>;
+
+		struct Statistics
+		{
+			uint64_t Queued{ 0 };
+			uint64_t Coalesced{ 0 };
+			uint64_t Dispatched{ 0 };
+		};
+
+		void SetDispatcher(Dispatcher dispatcher) { m_dispatcher = std::move(dispatcher); }
+
+		// Returns true if the queue was empty, the caller must make sure a Flush follows.
+		bool Push(const InputEvent& inputEvent);
+		void Flush();
+
+		bool IsEmpty() const { return m_pending.empty(); }
+		const Statistics& GetStatistics() const { return m_statistics; }
+
+	private:
+		static bool TryMerge(InputEvent& target, const InputEvent& inputEvent);
+
+		Dispatcher m_dispatcher;
+		std::vector<InputEvent> m_pending;
+		std::vector<InputEvent> m_dispatching;
+		bool m_isFlushing{ false };
+		Statistics m_statistics;
+	};
+}
+
+#endif
\ No newline at end of file
@@ -13,6 +13,8 @@
 #include "Berta/GUI/ControlAppearance.h"
 #include "Berta/GUI/Caret.h"
 #include "Berta/Controls/MenuBar.h"
+#include "Berta/Paint/DrawBatch.h"
+#include "Berta/GUI/Async.h"
 
 namespace Berta::GUI
 {
@@ -100,6 +102,11 @@ namespace Berta::GUI
 		windowManager.Update(window);
 	}
 
+	void FlushNow()
+	{
+		Foundation::GetInstance().GetFrameScheduler().FlushNow();
+	}
+
 	void EnableWindow(Window* window, bool isEnabled)
 	{
 		auto& windowManager = Foundation::GetInstance().GetWindowManager();
@@ -348,6 +355,7 @@ namespace Berta::GUI
 		}
 
 		window->Appearance = controlAppearance;
+		window->Renderer.Invalidate();
 	}
 
 	Point GetAbsolutePosition(Window* window)
@@ -431,6 +439,27 @@ namespace Berta::GUI
 		}
 
 		window->DrawStatus = DrawWindowStatus::NeedUpdate;
+		window->DamageArea = window->ClientSize.ToRectangle();
+		window->Renderer.Invalidate();
+	}
+
+	void MarkAsNeedUpdate(Window* window, const Rectangle& area)
+	{
+		auto& windowManager = Foundation::GetInstance().GetWindowManager();
+		if (!windowManager.Exists(window))
+		{
+			return;
+		}
+
+		Rectangle damage;
+		if (area.Width == 0 || area.Height == 0 || !LayoutUtils::GetIntersectionClipRect(window->ClientSize.ToRectangle(), area, damage))
+		{
+			return;
+		}
+
+		window->DrawStatus = DrawWindowStatus::NeedUpdate;
+		window->DamageArea = window->DamageArea.Union(damage);
+		window->Renderer.InvalidateArea();
 	}
 
 	void ChangeCursor(Window* window, Cursor newCursor)
@@ -515,14 +544,138 @@ namespace Berta::GUI
 	}
 
 	void SendCustomMessage(Window* window, std::function<void()> body)
+	{
+		if (body)
+		{
+			Post(window, std::move(body));
+		}
+	}
+
+	bool IsUIThread()
+	{
+		return Foundation::GetInstance().GetMessageLoop().IsLoopThread();
+	}
+
+	bool IsWindowAlive(Window* window)
+	{
+		return Foundation::GetInstance().GetWindowManager().Exists(window);
+	}
+
+	bool IsWindowAlive(WindowHandle handle)
+	{
+		return Foundation::GetInstance().GetWindowManager().Get(handle) != nullptr;
+	}
+
+	void Post(Window* window, Delegate<void()> task)
+	{
+		if (!task)
+		{
+			return;
+		}
+
+		if (window == nullptr)
+		{
+			Foundation::GetInstance().GetMessageLoop().PostTask(std::move(task));
+			return;
+		}
+
+		// A reclaimed window has an invalid handle, its task is dropped like that of any destroyed window.
+		Post(window->Handle, std::move(task));
+	}
+
+	void Post(WindowHandle handle, Delegate<void()> task)
+	{
+		if (!task || handle == InvalidWindowHandle)
+		{
+			return;
+		}
+
+		Foundation::GetInstance().GetMessageLoop().PostTask([handle, task = std::move(task)]()
+		{
+			auto window = Foundation::GetInstance().GetWindowManager().Get(handle);
+			if (window == nullptr)
+			{
+				return;
+			}
+
+			auto rootWindow = window->RootWindow;
+			DrawBatch drawBatch(rootWindow);
+			Foundation::RootGuard rootGuard(rootWindow);
+			task();
+		});
+	}
+
+	IdleTaskId ScheduleIdle(IdleScheduler::Task task, std::chrono::milliseconds deadline)
+	{
+		return Foundation::GetInstance().GetIdleScheduler().Schedule(std::move(task), deadline);
+	}
+
+	IdleTaskId ScheduleIdle(Window* window, IdleScheduler::Task task, std::chrono::milliseconds deadline)
+	{
+		if (!task)
+		{
+			return InvalidIdleTaskId;
+		}
+
+		auto handle = window ? window->Handle : InvalidWindowHandle;
+		return ScheduleIdle([handle, task = std::move(task)](const IdleDeadline& idleDeadline)
+		{
+			auto window = Foundation::GetInstance().GetWindowManager().Get(handle);
+			if (window == nullptr)
+			{
+				return false;
+			}
+
+			auto rootWindow = window->RootWindow;
+			DrawBatch drawBatch(rootWindow);
+			Foundation::RootGuard rootGuard(rootWindow);
+			return task(idleDeadline);
+		}, deadline);
+	}
+
+	void CancelIdle(IdleTaskId id)
+	{
+		Foundation::GetInstance().GetIdleScheduler().Cancel(id);
+	}
+
+	ThreadPool& GetThreadPool()
+	{
+		return Foundation::GetInstance().GetThreadPool();
+	}
+
+	CancellationToken GetWindowLifetimeToken(Window* window)
 	{
 		auto& windowManager = Foundation::GetInstance().GetWindowManager();
+		if (window == nullptr)
+		{
+			return {};
+		}
+
 		if (!windowManager.Exists(window))
 		{
-			return;
+			CancellationSource destroyed;
+			auto token = destroyed.GetToken();
+			destroyed.Cancel();
+			return token;
 		}
 
-		API::SendCustomMessage(window->RootWindow->RootHandle, body);
+		return window->Lifetime.GetToken();
+	}
+
+	void LogAsyncException(std::exception_ptr exception)
+	{
+		try
+		{
+			std::rethrow_exception(exception);
+		}
+		catch (const std::exception& e)
+		{
+			BT_CORE_ERROR << "RunAsync work threw an exception: " << e.what() << std::endl;
+		}
+		catch (...)
+		{
+			BT_CORE_ERROR << "RunAsync work threw an unknown exception." << std::endl;
+		}
 	}
 
 	void SetMenu(MenuItemReactor* rootMenuItemWindow)
@@ -8,8 +8,16 @@
 #define BT_INTERFACE_HEADER
 
 #include "Berta/Core/BasicTypes.h"
+#include "Berta/Core/Delegate.h"
+#include "Berta/Core/IdleScheduler.h"
 #include "Berta/GUI/Window.h"
+
+#ifdef BT_PLATFORM_WINDOWS
 #include "Berta/Platform/Windows/Messages.h"
+#endif
+
+#include <future>
+#include <type_traits>
 
 namespace Berta
 {
@@ -29,6 +37,8 @@ namespace Berta
 		void ShowWindow(Window* window, bool visible);
 		bool IsWindowVisible(Window* window);
 		void UpdateWindow(Window* window);
+		// Draws and presents everything invalidated since the last frame now, see FrameScheduler.
+		void FlushNow();
 		void EnableWindow(Window* window, bool isEnabled);
 		bool EnableWindow(Window* window);
 
@@ -61,6 +71,8 @@ namespace Berta
 
 		void UpdateTree(Window* window, bool now = false);
 		void MarkAsNeedUpdate(Window* window);
+		// Only the area (window relative) is redrawn, calls accumulate until the next update.
+		void MarkAsNeedUpdate(Window* window, const Rectangle& area);
 
 		void ChangeCursor(Window* window, Cursor newCursor);
 		Cursor GetCursor(Window* window);
@@ -73,12 +85,79 @@ namespace Berta
 
 		void SendCustomMessage(Window* window, std::function<void()> body);
 
+		bool IsUIThread();
+		bool IsWindowAlive(Window* window);
+		bool IsWindowAlive(WindowHandle handle);
+
+		// Queues the task to run on the UI thread. The task is dropped if the window is destroyed before it runs,
+		// a null window means no owner. It reads window->Handle, which WindowPool::Reclaim resets, so only call
+		// it on the UI thread: other threads must pass a handle captured on the UI thread instead of a Window*.
+		void Post(Window* window, Delegate<void()> task);
+		// Any thread. The task is dropped if no live window has the handle when it runs.
+		void Post(WindowHandle handle, Delegate<void()> task);
+
+		// Like Post, the future is fulfilled with the task's result once it runs on the UI thread.
+		// If the window is destroyed first the future throws std::future_error (broken_promise).
+		// Called from the UI thread it runs right away, waiting on the future would deadlock otherwise.
+		// Same thread rules as Post: other threads use the WindowHandle overload.
+		template <typename Callable>
+		auto Invoke(Window* window, Callable&& callable) -> std::future<std::invoke_result_t<std::decay_t<Callable>&>>;
+		template <typename Callable>
+		auto Invoke(WindowHandle handle, Callable&& callable) -> std::future<std::invoke_result_t<std::decay_t<Callable>&>>;
+
+		// Runs the task when the message loop is idle, or once the deadline passes (whatever comes first).
+		// The task returns true to get another slice, see IdleDeadline. UI thread only.
+		IdleTaskId ScheduleIdle(IdleScheduler::Task task, std::chrono::milliseconds deadline = IdleScheduler::NoDeadline);
+		// Same, but dropped if the window is destroyed first, and it runs inside the window's draw batch.
+		IdleTaskId ScheduleIdle(Window* window, IdleScheduler::Task task, std::chrono::milliseconds deadline = IdleScheduler::NoDeadline);
+		void CancelIdle(IdleTaskId id);
+
 		void SetMenu(MenuItemReactor* rootMenuItemWindow);
 
 		void DisposeMenu();
 		void DisposeMenu(MenuItemReactor* rootReactor);
 
 		void Exit();
+
+		template <typename Callable>
+		auto Invoke(Window* window, Callable&& callable) -> std::future<std::invoke_result_t<std::decay_t<Callable>&>>
+		{
+			using Result = std::invoke_result_t<std::decay_t<Callable>&>;
+
+			std::packaged_task<Result()> task(std::forward<Callable>(callable));
+			auto future = task.get_future();
+			if (IsUIThread())
+			{
+				if (window == nullptr || IsWindowAlive(window))
+				{
+					task();
+				}
+				return future;
+			}
+
+			Post(window, std::move(task));
+			return future;
+		}
+
+		template <typename Callable>
+		auto Invoke(WindowHandle handle, Callable&& callable) -> std::future<std::invoke_result_t<std::decay_t<Callable>&>>
+		{
+			using Result = std::invoke_result_t<std::decay_t<Callable>&>;
+
+			std::packaged_task<Result()> task(std::forward<Callable>(callable));
+			auto future = task.get_future();
+			if (IsUIThread())
+			{
+				if (IsWindowAlive(handle))
+				{
+					task();
+				}
+				return future;
+			}
+
+			Post(handle, std::move(task));
+			return future;
+		}
 	}
 }
 
@@ -185,14 +185,10 @@ namespace Berta
 		if (!window)
 		{
 			return;
-		}
-		if (m_parent)
-		{
-
 		}
 		m_parent = window;
 
-		m_parent->Events->Resize.Connect([this](const ArgResize& args)
+		m_parentResizeConnection = m_parent->GetEvents().Resize.ConnectScoped([this](const ArgResize& args)
 		{
 			//TODO: add this same logic to visibility event?!
 			if (m_rootNode)
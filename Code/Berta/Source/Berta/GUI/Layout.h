@@ -8,6 +8,7 @@
 #define BT_LAYOUT_HEADER
 
 #include "Berta/Core/BasicTypes.h"
+#include "Berta/Core/Event.h"
 #include "Berta/Controls/DockPanel.h"
 
 #include <memory>
@@ -208,6 +209,7 @@ namespace Berta
         void Print(LayoutNode* node, uint32_t level);
 
         Window* m_parent{ nullptr };
+        ScopedConnection m_parentResizeConnection;
         LayoutNode* m_lastTargetNode{ nullptr };
         std::unique_ptr<LayoutNode> m_rootNode;
         std::map<std::string, LayoutNode*> m_fields;
@@ -719,10 +719,11 @@ namespace Berta
 					GUI::SetParentWindow(dockAreaWindow, nativeWindow);
 					this->SetPosition({ 0, 0 });
 
+					// Owned by the dock area: it is dropped if the area is destroyed before its container.
 					m_nativeContainer->GetEvents().Resize.Connect([this](const ArgResize& args)
 					{
 						this->SetSize({ args.NewSize.Width, args.NewSize.Height });
-					});
+					}, dockAreaWindow->Handle);
 
 					m_mouseInteraction.m_dragStartLocalPos.X -= static_cast<int>(nativeWindow->BorderSize.Width / 2) - (screenMousePos.X - m_mouseInteraction.m_dragStartPos.X);
 					m_mouseInteraction.m_dragStartLocalPos.Y -= static_cast<int>(nativeWindow->BorderSize.Height / 2) - (screenMousePos.Y - m_mouseInteraction.m_dragStartPos.Y);
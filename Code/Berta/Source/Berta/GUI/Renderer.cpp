@@ -34,6 +34,11 @@ namespace Berta
 	}
 
 	void Renderer::Update()
+	{
+		Update(Rectangle{});
+	}
+
+	void Renderer::Update(const Rectangle& damage)
 	{
 		if (m_controlReactor && m_updating)
 		{
@@ -43,13 +48,33 @@ namespace Berta
 		if (m_controlReactor && !m_updating && m_graphics.IsValid())
 		{
 			m_updating = true;
+			auto fullArea = m_graphics.GetSize().ToRectangle();
+			// A full invalidation (resize, DPI change, new graphics) since the damage was marked wins over it.
+			bool isPartial = !m_fullDamage && !damage.IsEmpty() && damage != fullArea;
+			BT_ASSERT(!isPartial || fullArea.Contains(damage), "Sub-rectangle damage outside of the layer, it was marked before the layer changed.");
+
 			m_graphics.Begin();
-			m_controlReactor->Update(m_graphics);
+			if (isPartial)
+			{
+				m_graphics.PushClip(damage);
+			}
+			m_controlReactor->Update(m_graphics, isPartial ? damage : fullArea);
+			if (isPartial)
+			{
+				m_graphics.PopClip();
+			}
 			m_graphics.Flush();
+			m_dirty = false;
+			m_fullDamage = false;
 			m_updating = false;
 		}
 	}
 
+	bool Renderer::IsOpaque() const
+	{
+		return m_controlReactor && m_controlReactor->IsOpaque() && m_graphics.IsValid();
+	}
+
 	void Renderer::MouseEnter(const ArgMouse& args)
 	{
 		ProcessEvent(&ControlReactor::MouseEnter, args);
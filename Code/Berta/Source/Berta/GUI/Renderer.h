@@ -23,6 +23,18 @@ namespace Berta
 		void Shutdown();
 		void Map(Window* window, const Rectangle& areaToUpdate);
 		void Update();
+		// Only the damaged area (window relative) is redrawn, empty means the whole window. Ignored (whole window)
+		// after Invalidate.
+		void Update(const Rectangle& damage);
+
+		// The graphics are a retained layer, UpdateTree only renders them again after one of these was called.
+		// Invalidate marks the whole layer, whatever Window::DamageArea says (the draw batch widens it).
+		void Invalidate() { m_dirty = true; m_fullDamage = true; }
+		// Only Window::DamageArea is out of date, see GUI::MarkAsNeedUpdate.
+		void InvalidateArea() { m_dirty = true; }
+		bool IsDirty() const { return m_dirty; }
+		bool HasFullDamage() const { return m_fullDamage; }
+		bool IsOpaque() const;
 
 		void MouseEnter(const ArgMouse& args);
 		void MouseLeave(const ArgMouse& args);
@@ -46,6 +58,8 @@ namespace Berta
 		void ProcessEvent(void(ControlReactor::* reactorEventPtr)(Graphics&, const TArgument&), const TArgument& args);
 
 		bool m_updating{ false };
+		bool m_dirty{ true };
+		bool m_fullDamage{ true };
 		ControlReactor* m_controlReactor{ nullptr };
 		Graphics m_graphics;
 	};
@@ -21,6 +21,7 @@ namespace Berta
 		Flags.isUpdating = false;
 		Flags.IgnoreMouseFocus = false;
 		Flags.AutoDraw = true;
+		Flags.CoalesceInput = true;
 
 		BorderSize = { 0,0 };
 	}
@@ -37,6 +38,20 @@ namespace Berta
 		return RootWindow->Batcher != nullptr;
 	}
 
+	ControlEvents& Window::GetEvents()
+	{
+		if (!Events && ControlWindowPtr)
+		{
+			ControlWindowPtr->CreateEvents();
+		}
+
+		if (!Events)
+		{
+			Events = std::make_shared<ControlEvents>();
+		}
+		return *Events;
+	}
+
 	Window* Window::FindFirstNonPanelAncestor() const
 	{
 		if (!Parent)
@@ -101,40 +116,37 @@ namespace Berta
 		return false;
 	}
 
+	uint32_t Window::g_hierarchyVersion{ 1 };
+
 	int Window::GetHierarchyIndex() const
 	{
-		bool found = false;
-		auto root = RootWindow;
-		while (root && root->Parent != nullptr)
+		if (m_hierarchyVersion != g_hierarchyVersion)
 		{
-			root = root->Parent;
+			// One walk numbers the whole tree, the rest of the windows in it are up to date after this.
+			auto root = const_cast<Window*>(this);
+			while (root->Parent != nullptr)
+			{
+				root = root->Parent;
+			}
+
+			int index = 0;
+			UpdateHierarchyIndices(root, index);
+
+			// Destroyed windows are not in the tree anymore, don't walk it again for them.
+			m_hierarchyVersion = g_hierarchyVersion;
 		}
 
-		return GetHierarchyIndexInternal(root, const_cast<Window*>(this), found);
+		return m_hierarchyIndex;
 	}
 
-	int Window::GetHierarchyIndexInternal(Window* current, Window* target, bool& found) const
+	void Window::UpdateHierarchyIndices(Window* current, int& index)
 	{
-		if (!current)
-			return 0;
+		current->m_hierarchyIndex = index++;
+		current->m_hierarchyVersion = g_hierarchyVersion;
 
-		if (current == target)
+		for (auto child : current->Children)
 		{
-			found = true;
-			return 0;
+			UpdateHierarchyIndices(child, index);
 		}
-
-		int index = 0;
-		for (size_t i = 0; i < current->Children.size(); i++)
-		{
-			auto child = current->Children[i];
-
-			index += 1 + GetHierarchyIndexInternal(child, target, found);
-
-			if (found)
-				return index;
-		}
-
-		return index;
 	}
 }
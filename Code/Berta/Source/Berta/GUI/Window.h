@@ -10,8 +10,10 @@
 #include <string>
 #include <vector>
 #include "Berta/Core/BasicTypes.h"
+#include "Berta/Core/CancellationToken.h"
 #include "Berta/GUI/Renderer.h"
 #include "Berta/GUI/ControlWindow.h"
+#include "Berta/GUI/WindowRegistry.h"
 #include "Berta/API/WindowAPI.h"
 
 namespace Berta
@@ -43,6 +45,7 @@ namespace Berta
 		~Window();
 
 		WindowType Type;
+		WindowHandle Handle{ InvalidWindowHandle };	// See WindowManager::Get.
 		API::NativeWindowHandle RootHandle{};
 		API::RootPaintNativeHandle RootPaintHandle{};
 
@@ -61,11 +64,11 @@ namespace Berta
 		uint32_t DPI{ 0 };
 		float DPIScaleFactor{ 1.0f };
 
-		Renderer Renderer;
+		Berta::Renderer Renderer;
 		Graphics* RootGraphics{ nullptr };
 		DrawBatch* Batcher{ nullptr };
 		std::shared_ptr<ControlAppearance> Appearance{ nullptr };
-		std::shared_ptr<ControlEvents> Events{ nullptr };
+		std::shared_ptr<ControlEvents> Events{ nullptr };	// Null until something connects, see GetEvents.
 		std::unique_ptr<ControlWindowInterface> ControlWindowPtr{ nullptr }; //TODO: a lo mejor debemos usar un puntero a ControlBase y eliminamos esta interfaz
 
 		Window* Parent{ nullptr };		//A parent window is directly above a child window in the window hierarchy.
@@ -74,6 +77,8 @@ namespace Berta
 
 		Window* RootWindow{ nullptr };
 
+		CancellationSource Lifetime;	// Cancelled when the window is destroyed. See GUI::RunAsync.
+
 		struct Flags
 		{
 			bool IsEnabled : 1;
@@ -83,11 +88,13 @@ namespace Berta
 			bool isUpdating : 1;
 			bool IgnoreMouseFocus : 1;
 			bool AutoDraw : 1;
+			bool CoalesceInput : 1;
 		}Flags;
 
 		Window* MakeTargetWhenInactive{ nullptr };
 
 		DrawWindowStatus DrawStatus{ DrawWindowStatus::None };
+		Rectangle DamageArea{};		// Window relative area to redraw on the next batched update, see GUI::MarkAsNeedUpdate. Cleared by any update.
 
 		void Init(ControlBase* control);
 
@@ -130,16 +137,26 @@ namespace Berta
 
 		bool IsBatchActive() const;
 
+		// Events are allocated on first access (by the control, so they have its events type). Emitters check Events instead.
+		ControlEvents& GetEvents();
+
 		Window* FindFirstNonPanelAncestor() const;
 		Window* FindFirstPanelOrFormAncestor() const;
 		bool AreParentsVisible() const;
 		bool IsVisible() const;
 		bool IsAncestorOf(Window* window) const;
 
+		// Pre-order position in the whole tree (the top level form is 0). Cached, see InvalidateHierarchyIndices.
 		int GetHierarchyIndex() const;
+		// Called on every structural change (a window added, removed or reparented).
+		static void InvalidateHierarchyIndices() { ++g_hierarchyVersion; }
 
 	private:
-		int GetHierarchyIndexInternal(Window* current, Window* target, bool& found) const;
+		static void UpdateHierarchyIndices(Window* current, int& index);
+
+		mutable int m_hierarchyIndex{ 0 };
+		mutable uint32_t m_hierarchyVersion{ 0 };
+		static uint32_t g_hierarchyVersion;
 	};
 }
 
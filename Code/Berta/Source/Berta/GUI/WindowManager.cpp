@@ -22,7 +22,8 @@ namespace Berta
 {
 	WindowManager::FormData::FormData(FormData&& other) noexcept :
 		WindowPtr(other.WindowPtr),
-		RootGraphics(std::move(other.RootGraphics))
+		RootGraphics(std::move(other.RootGraphics)),
+		HitTest(std::move(other.HitTest))
 	{
 	}
 
@@ -34,7 +35,7 @@ namespace Berta
 
 	void WindowManager::Add(Window* window)
 	{
-		m_windowRegistry.emplace(window);
+		window->Handle = m_windowRegistry.Add(window);
 	}
 
 	void WindowManager::AddNative(API::NativeWindowHandle nativeWindowHandle, FormData&& append)
@@ -77,7 +78,7 @@ namespace Berta
 		auto windowResult = API::CreateNativeWindow(parentHandle, finalRect, formStyle, isNested);
 		if (windowResult.WindowHandle)
 		{
-			Window* window = new Window(isRenderForm ? WindowType::RenderForm : WindowType::Form);
+			Window* window = m_windowPool.Allocate(isRenderForm ? WindowType::RenderForm : WindowType::Form);
 			window->Init(control);
 
 			window->RootHandle = windowResult.WindowHandle;
@@ -112,6 +113,8 @@ namespace Berta
 				_com_error err(hr);
 				BT_CORE_ERROR << "Error creating render target hwnd. err.ErrorMessage() = " << StringUtils::Convert(err.ErrorMessage()) << std::endl;
 			}
+#else
+			window->RootPaintHandle.Target = windowResult.WindowHandle.Handle;
 #endif
 			if (isNested)
 			{
@@ -122,6 +125,7 @@ namespace Berta
 				if (parent)
 				{
 					parent->Children.emplace_back(window);
+					Window::InvalidateHierarchyIndices();
 				}
 			}
 			else
@@ -144,7 +148,7 @@ namespace Berta
 
 	Window* WindowManager::CreateControl(Window* parent, bool isUnscaleRect, const Rectangle& rectangle, ControlBase* control, bool isPanel)
 	{
-		Window* window = new Window(isPanel ? WindowType::Panel : WindowType::Control);
+		Window* window = m_windowPool.Allocate(isPanel ? WindowType::Panel : WindowType::Control);
 		window->Init(control);
 
 		Rectangle finalRect{ rectangle };
@@ -170,6 +174,12 @@ namespace Berta
 			window->RootGraphics = parent->RootGraphics;
 
 			parent->Children.emplace_back(window);
+			Window::InvalidateHierarchyIndices();
+
+			if (auto hitTest = GetHitTestIndex(window))
+			{
+				hitTest->Invalidate();
+			}
 		}
 
 		Add(window);
@@ -190,6 +200,7 @@ namespace Berta
 				if (window->Parent->Children[i] == window)
 				{
 					window->Parent->Children.erase(window->Parent->Children.begin() + i);
+					Window::InvalidateHierarchyIndices();
 					break;
 				}
 			}
@@ -204,7 +215,7 @@ namespace Berta
 #else
 			BT_CORE_DEBUG << "    - Destroy." << std::endl;
 #endif
-			//delete window;  //TODO: place this deallocation in a safe place!
+			Retire(window);
 		}
 	}
 
@@ -217,10 +228,32 @@ namespace Berta
 
 		auto& foundation = Foundation::GetInstance();
 		window->Flags.IsDisposed = true;
+		window->Lifetime.Cancel();
 
 		ArgDestroy argDestroy;
 		foundation.ProcessEvents(window, static_cast<void(Renderer::*)(const ArgDestroy&)>(nullptr), &ControlEvents::Destroy, argDestroy);
 
+		// The form keeps these pointers across messages, its slot will be reused by another window.
+		if (auto formData = GetFormData(window->RootHandle))
+		{
+			for (auto windowPtr : { &formData->Pressed, &formData->Hovered, &formData->Focused, &formData->Released })
+			{
+				if (*windowPtr == window)
+				{
+					*windowPtr = nullptr;
+				}
+			}
+		}
+
+		// Handlers this window connected to its ancestors' events (owner == its handle) must not outlive it.
+		for (auto ancestor = window->Parent; ancestor; ancestor = ancestor->Parent)
+		{
+			if (ancestor->Events)
+			{
+				ancestor->Events->DisconnectAll(window->Handle);
+			}
+		}
+
 		while (!window->Children.empty())
 		{
 			auto child = window->Children.back();
@@ -231,13 +264,14 @@ namespace Berta
 			}
 			DestroyInternal(child);
 			window->Children.pop_back();
+			Window::InvalidateHierarchyIndices();
 
 #if BT_DEBUG
 			//BT_CORE_DEBUG << "    - DestroyInternal. Child Window =" << child->Name << std::endl;
 #else
 			//BT_CORE_DEBUG << "    - DestroyInternal." << std::endl;
 #endif
-			//delete child; //TODO: place this deallocation in a safe place!
+			Retire(child);
 		}
 
 		//BT_CORE_TRACE << "DestroyInternal / Release Capture = " << m_capture.WindowPtr << ". window " << window << std::endl;
@@ -245,12 +279,18 @@ namespace Berta
 		{
 			ReleaseCapture(m_capture.WindowPtr);
 		}
+		std::erase_if(m_capture.PrevCaptured, [window](const CaptureHistoryData& data) { return data.WindowPtr == window; });
 		
 		window->Renderer.Shutdown();
 		window->ControlWindowPtr->Destroy();
 		if (!window->IsNative())
 		{
-			m_windowRegistry.erase(window);
+			m_windowRegistry.Remove(window->Handle);
+
+			if (auto hitTest = GetHitTestIndex(window))
+			{
+				hitTest->Invalidate();
+			}
 		}
 
 		window->Renderer.GetGraphics().Release();
@@ -260,7 +300,7 @@ namespace Berta
 		}
 	}
 
-	void WindowManager::UpdateTreeInternal(Window* window, Graphics& rootGraphics, bool now, const Point& parentPosition, const Rectangle& containerRectangle)
+	void WindowManager::UpdateTreeInternal(Window* window, Graphics& rootGraphics, bool now, uint32_t& culledWindows, const Point& parentPosition, const Rectangle& containerRectangle)
 	{
 		if (window == nullptr)
 		{
@@ -290,19 +330,31 @@ namespace Berta
 
 				if (now || !child->IsBatchActive())
 				{
-					child->Renderer.Update();
-					child->DrawStatus = DrawWindowStatus::Updated;
-
-					if (LayoutUtils::GetIntersectionClipRect(containerRectangle, childRectangle, childRectangle))
+					bool isInside = LayoutUtils::GetIntersectionClipRect(containerRectangle, childRectangle, childRectangle);
+					if (isInside && IsOccluded(child, childRectangle))
+					{
+						++culledWindows; // Left dirty, rendered once it shows up again.
+					}
+					else
 					{
-						rootGraphics.BitBlt(childRectangle, child->Renderer.GetGraphics(), { 0,0 });
+						if (child->Renderer.IsDirty())
+						{
+							child->Renderer.Update();
+							child->DamageArea = {}; // Rendered in full.
+						}
+						child->DrawStatus = DrawWindowStatus::Updated;
+
+						if (isInside)
+						{
+							rootGraphics.BitBlt(childRectangle, child->Renderer.GetGraphics(), { 0,0 });
+						}
 					}
 				}
 				else
 				{
 					if (LayoutUtils::GetIntersectionClipRect(containerRectangle, childRectangle, childRectangle))
 					{
-						AddWindowToBatch(child, childRectangle, DrawOperation::NeedUpdate | DrawOperation::NeedMap);
+						AddWindowToBatch(child, childRectangle, child->Renderer.IsDirty() ? DrawOperation::NeedUpdate | DrawOperation::NeedMap : DrawOperation::NeedMap);
 					}
 				}
 			}
@@ -311,7 +363,7 @@ namespace Berta
 				newContainerRectangle = childRectangle;
 			}
 
-			UpdateTreeInternal(child, rootGraphics, now, absolutePositionChild, newContainerRectangle);
+			UpdateTreeInternal(child, rootGraphics, now, culledWindows, absolutePositionChild, newContainerRectangle);
 		}
 	}
 
@@ -341,6 +393,7 @@ namespace Berta
 					child->Flags.isUpdating = true;
 					child->Renderer.Update();
 					child->Flags.isUpdating = false;
+					child->DamageArea = {}; // Rendered in full.
 				}
 
 				if (LayoutUtils::GetIntersectionClipRect(containerRectangle, childRectangle, childRectangle))
@@ -386,6 +439,7 @@ namespace Berta
 					auto& graphics = child->Renderer.GetGraphics();
 					graphics.Rebuild(child->ClientSize, window->RootPaintHandle);
 					graphics.BuildFont(child->DPI);
+					child->Renderer.Invalidate();
 				}
 			}
 
@@ -471,7 +525,7 @@ namespace Berta
 			{
 				if (HasFlag(operation, DrawOperation::NeedMap) && LayoutUtils::GetIntersectionClipRect(containerRectangle, childRectangle, childRectangle))
 				{
-					AddWindowToBatch(child, childRectangle, DrawOperation::NeedMap);
+					AddWindowToBatch(child, childRectangle, DrawOperation::MapOverDamage);
 				}
 			}
 			else
@@ -532,6 +586,7 @@ namespace Berta
 			window->Flags.isUpdating = true;
 			window->Renderer.Update();
 			window->Flags.isUpdating = false;
+			window->DamageArea = {}; // Rendered in full.
 		}
 
 		auto& rootGraphics = *(window->RootWindow->RootGraphics);
@@ -561,8 +616,10 @@ namespace Berta
 		if (window->IsNative())
 		{
 			ArgDisposing argDisposing{ false };
-			auto events = dynamic_cast<FormEvents*>(window->Events.get());
-			events->Disposing.Emit(argDisposing);
+			if (auto events = dynamic_cast<FormEvents*>(window->Events.get()))
+			{
+				events->Disposing.Emit(argDisposing);
+			}
 
 			if (!argDisposing.Cancel)
 			{
@@ -588,14 +645,30 @@ namespace Berta
 		}
 
 		m_windowNativeRegistry.erase(window->RootHandle);
-		m_windowRegistry.erase(window);
+		m_windowRegistry.Remove(window->Handle);
+		DrawBatch::ReleaseContext(window);
 #if BT_DEBUG
 		//BT_CORE_DEBUG << "    - Remove. Window =" << window->Name << std::endl;
 #else
 		//BT_CORE_DEBUG << "    - Remove." << std::endl;
 #endif
-		//delete window; //TODO: place this deallocation in a safe place!
-		
+		Retire(window);
+	}
+
+	void WindowManager::Retire(Window* window)
+	{
+		bool reclaimPending = m_windowPool.HasRetired();
+		m_windowPool.Retire(window);
+
+		if (!reclaimPending)
+		{
+			// Posted tasks run from the top of the message loop: by then no event dispatch, draw batch
+			// or root guard can still be using the retired windows.
+			Foundation::GetInstance().GetMessageLoop().PostTask([this]()
+			{
+				m_windowPool.Reclaim();
+			});
+		}
 	}
 
 	void WindowManager::Refresh(Window* window)
@@ -627,7 +700,7 @@ namespace Berta
 
 	bool WindowManager::Exists(Window* window) const
 	{
-		return m_windowRegistry.find(window) != m_windowRegistry.end();
+		return window && m_windowRegistry.Get(window->Handle) == window;
 	}
 
 	uint32_t WindowManager::NativeWindowCount()
@@ -649,7 +722,7 @@ namespace Berta
 
 			if (m_capture.WindowPtr)
 			{
-				m_capture.PrevCaptured.emplace_back(m_capture.WindowPtr, m_capture.RedirectToChildren);
+				m_capture.PrevCaptured.emplace_back(m_capture.WindowPtr, m_capture.WindowPtr->Handle, m_capture.RedirectToChildren);
 			}
 			m_capture.WindowPtr = window;
 			m_capture.RedirectToChildren = redirectToChildren;
@@ -667,7 +740,7 @@ namespace Berta
 				auto& lastCaptured = m_capture.PrevCaptured.back();
 				m_capture.PrevCaptured.pop_back();
 
-				if (Exists(lastCaptured.WindowPtr))
+				if (Get(lastCaptured.Handle) == lastCaptured.WindowPtr)
 				{
 					m_capture.WindowPtr = lastCaptured.WindowPtr;
 					m_capture.RedirectToChildren = lastCaptured.RedirectToChildren;
@@ -710,7 +783,7 @@ namespace Berta
 		{
 			if (window->Visible && IsPointOnWindow(window, point))
 			{
-				return FindInTree(window, point);
+				return FindInRoot(window, point);
 			}
 
 			return nullptr;
@@ -718,7 +791,7 @@ namespace Berta
 
 		if (m_capture.RedirectToChildren && window->Visible && IsPointOnWindow(window, point))
 		{
-			auto target = FindInTree(window, point);
+			auto target = FindInRoot(window, point);
 
 			auto current = target;
 			while (current)
@@ -753,29 +826,44 @@ namespace Berta
 		auto containerPosition = GetAbsoluteRootPosition(container);
 		Rectangle containerRectangle{ containerPosition.X, containerPosition.Y, container->ClientSize.Width, container->ClientSize.Height };
 
+		uint32_t culledWindows = 0;
 		if (now || !window->IsBatchActive())
 		{
-			window->Renderer.Update();
-			window->DrawStatus = DrawWindowStatus::Updated;
 			rootGraphics.Begin();
-			if (LayoutUtils::GetIntersectionClipRect(containerRectangle, requestRectangle, requestRectangle))
+			bool isInside = LayoutUtils::GetIntersectionClipRect(containerRectangle, requestRectangle, requestRectangle);
+			if (isInside && IsOccluded(window, requestRectangle))
 			{
-				rootGraphics.BitBlt(requestRectangle, window->Renderer.GetGraphics(), { 0,0 });
+				++culledWindows;
+			}
+			else
+			{
+				if (window->Renderer.IsDirty())
+				{
+					window->Renderer.Update();
+					window->DamageArea = {}; // Rendered in full.
+				}
+				window->DrawStatus = DrawWindowStatus::Updated;
+
+				if (isInside)
+				{
+					rootGraphics.BitBlt(requestRectangle, window->Renderer.GetGraphics(), { 0,0 });
+				}
 			}
 		}
 		else
 		{
 			if (LayoutUtils::GetIntersectionClipRect(containerRectangle, requestRectangle, requestRectangle))
 			{
-				AddWindowToBatch(window, requestRectangle, DrawOperation::NeedUpdate | DrawOperation::NeedMap);
+				AddWindowToBatch(window, requestRectangle, window->Renderer.IsDirty() ? DrawOperation::NeedUpdate | DrawOperation::NeedMap : DrawOperation::NeedMap);
 			}
 		}
 
-		UpdateTreeInternal(window, rootGraphics, now, absolutePosition, containerRectangle);
+		UpdateTreeInternal(window, rootGraphics, now, culledWindows, absolutePosition, containerRectangle);
 
 		if (now || !window->IsBatchActive())
 		{
 			rootGraphics.Flush();
+			DrawBatch::RecordCulledWindows(window->RootWindow, culledWindows);
 		}
 	}
 
@@ -814,7 +902,10 @@ namespace Berta
 
 			ArgVisibility argVisibility;
 			argVisibility.IsVisible = visible;
-			window->Events->Visibility.Emit(argVisibility);
+			if (window->Events)
+			{
+				window->Events->Visibility.Emit(argVisibility);
+			}
 
 			auto windowToUpdate = window->FindFirstNonPanelAncestor();
 			if (windowToUpdate)
@@ -839,6 +930,17 @@ namespace Berta
 		auto& foundation = Foundation::GetInstance();
 
 		window->ClientSize = newSize;
+		if (auto hitTest = GetHitTestIndex(window))
+		{
+			if (window->IsNative())
+			{
+				hitTest->Invalidate(); // The grid covers the form's client area.
+			}
+			else
+			{
+				hitTest->Resize(window);
+			}
+		}
 
 #ifdef BT_PLATFORM_WINDOWS
 		if (window->Type == WindowType::Form)
@@ -872,6 +974,7 @@ namespace Berta
 		if (window->Type != WindowType::Panel && window->Type != WindowType::RenderForm)
 		{
 			window->Renderer.GetGraphics().Swap(newGraphics);
+			window->Renderer.Invalidate();
 
 			if (window->Type == WindowType::Form)
 			{
@@ -919,6 +1022,10 @@ namespace Berta
 			if (sizeChanged)
 			{
 				window->ClientSize = newRect;
+				if (auto hitTest = GetHitTestIndex(window))
+				{
+					hitTest->Invalidate();
+				}
 
 #ifdef BT_PLATFORM_WINDOWS
 				auto hr = window->RootPaintHandle.RenderTarget->Resize(D2D1::SizeU(window->ClientSize.Width, window->ClientSize.Height));
@@ -929,6 +1036,7 @@ namespace Berta
 #endif
 
 				window->Renderer.GetGraphics().Rebuild(window->ClientSize, window->RootPaintHandle);
+				window->Renderer.Invalidate();
 				window->RootGraphics->Rebuild(window->ClientSize, window->RootPaintHandle);
 
 				API::MoveWindow(window->RootHandle, rootRect, forceRepaint);
@@ -953,6 +1061,10 @@ namespace Berta
 			if (positionChanged)
 			{
 				window->Position = newRect;
+				if (auto hitTest = GetHitTestIndex(window))
+				{
+					hitTest->Move(window);
+				}
 				MoveInternal(window, delta, forceRepaint);
 
 				ArgMove argMove;
@@ -989,6 +1101,10 @@ namespace Berta
 		{
 			Point delta{ newPosition.X - window->Position.X, newPosition.Y - window->Position.Y };
 			window->Position = newPosition;
+			if (auto hitTest = GetHitTestIndex(window))
+			{
+				hitTest->Move(window);
+			}
 
 			MoveInternal(window, delta, forceRepaint);
 
@@ -1003,29 +1119,19 @@ namespace Berta
 
 	void WindowManager::Update(Window* window)
 	{
+		window->Renderer.Invalidate(); // Even when hidden, the layer is out of date (e.g. a caption set before Show).
 		if (!window->IsVisible())
 			return;
 
+		window->DamageArea = window->ClientSize.ToRectangle();
 		if (window->IsBatchActive())
 		{
 			TryAddWindowToBatch(window);
 		}
 		else
 		{
-			if (window->Flags.isUpdating)
-			{
-				BT_CORE_WARN << " - WindowManager.Update() / ALREADY updating..." << std::endl;
-			}
-
-			if (!window->Flags.isUpdating)
-			{
-				window->Flags.isUpdating = true;
-				window->Renderer.Update();
-				window->Flags.isUpdating = false;
-			}
-
-			Paint(window, false);
-			Map(window, nullptr);
+			// Drawn by the next frame, together with everything else invalidated until then.
+			Foundation::GetInstance().GetFrameScheduler().Invalidate(window);
 		}
 	}
 
@@ -1041,6 +1147,10 @@ namespace Berta
 
 		window->DPI = newDPI;
 		window->DPIScaleFactor = LayoutUtils::CalculateDPIScaleFactor(newDPI);
+		if (auto hitTest = GetHitTestIndex(window))
+		{
+			hitTest->Invalidate();
+		}
 
 		if (window->IsNative())
 		{
@@ -1061,6 +1171,7 @@ namespace Berta
 			graphics.Release();
 			graphics.Build(window->ClientSize, window->RootPaintHandle);
 			graphics.BuildFont(newDPI);
+			window->Renderer.Invalidate();
 		}
 
 		if (window->IsNative() && window->RootHandle != nativeWindowHandle)
@@ -1140,6 +1251,11 @@ namespace Berta
 		if (window->Parent == newParent)
 			return;
 
+		if (auto hitTest = GetHitTestIndex(window))
+		{
+			hitTest->Invalidate();
+		}
+
 		if (window->Parent)
 		{
 			for (size_t i = 0; i < window->Parent->Children.size(); i++)
@@ -1147,6 +1263,7 @@ namespace Berta
 				if (window->Parent->Children[i] == window)
 				{
 					window->Parent->Children.erase(window->Parent->Children.begin() + i);
+					Window::InvalidateHierarchyIndices();
 					break;
 				}
 			}
@@ -1167,11 +1284,13 @@ namespace Berta
 				auto& graphics = window->Renderer.GetGraphics();
 				graphics.Rebuild(window->ClientSize, newParent->RootPaintHandle);
 				graphics.BuildFont(window->DPI);
+				window->Renderer.Invalidate();
 			}
 		}
 		window->Position = { 0,0 };
 
 		newParent->Children.emplace_back(window);
+		Window::InvalidateHierarchyIndices();
 
 		if (window->IsNative())
 		{
@@ -1187,6 +1306,11 @@ namespace Berta
 		}
 
 		SetParentInternal(window, newParent, deltaPosition);
+
+		if (auto hitTest = GetHitTestIndex(newParent))
+		{
+			hitTest->Invalidate();
+		}
 	}
 
 	void WindowManager::SetMenu(MenuItemReactor* rootMenuItemWindow)
@@ -1250,6 +1374,41 @@ namespace Berta
 		return rect.IsInside(point);
 	}
 
+	Window* WindowManager::FindInRoot(Window* window, const Point& point)
+	{
+		if (window->IsNative())
+		{
+			if (auto hitTest = GetHitTestIndex(window))
+			{
+				return hitTest->Find(window, point);
+			}
+		}
+
+		return FindInTree(window, point);
+	}
+
+	bool WindowManager::IsOccluded(Window* window, const Rectangle& area)
+	{
+		if (window->IsNative() && window != window->RootWindow)
+		{
+			return false; // A nested form paints on its own surface.
+		}
+
+		auto hitTest = GetHitTestIndex(window);
+		return hitTest && hitTest->IsOccluded(window->RootWindow, window, area);
+	}
+
+	HitTestIndex* WindowManager::GetHitTestIndex(Window* window)
+	{
+		if (!window->RootWindow)
+		{
+			return nullptr;
+		}
+
+		auto formData = GetFormData(window->RootWindow->RootHandle);
+		return formData ? &formData->HitTest : nullptr;
+	}
+
 	Window* WindowManager::FindInTree(Window* window, const Point& point)
 	{
 		if (!window->Visible)
@@ -8,12 +8,14 @@
 #define BT_WINDOW_MANAGER_HEADER
 
 #include <map>
-#include <set>
 #include <string>
 #include <iostream>
 #include "Berta/API/WindowAPI.h"
 #include "Berta/Paint/Graphics.h"
 #include "Berta/Paint/DrawBatch.h"
+#include "Berta/GUI/HitTestIndex.h"
+#include "Berta/GUI/WindowPool.h"
+#include "Berta/GUI/WindowRegistry.h"
 
 namespace Berta
 {
@@ -35,6 +37,9 @@ namespace Berta
 			Window* Released{ nullptr }; // Handle double-click
 
 			API::NativeCursor CurrentCursor;
+			bool IsSizeMoving{ false };
+
+			HitTestIndex HitTest;
 
 #ifdef BT_PLATFORM_WINDOWS
 			TRACKMOUSEEVENT TrackEvent = { sizeof(TRACKMOUSEEVENT), TME_LEAVE };
@@ -58,8 +63,13 @@ namespace Berta
 		void Remove(Window* window);
 		void Refresh(Window* window);
 		Window* Get(API::NativeWindowHandle nativeWindowHandle) const;
+		Window* Get(WindowHandle handle) const { return m_windowRegistry.Get(handle); }
 		FormData* GetFormData(API::NativeWindowHandle nativeWindowHandle);
+		// Only for pointers known to be live (a control's handle is reset when it is destroyed). A freed window's
+		// address is reused by the next one, so a pointer kept past its window's lifetime can match a new window:
+		// keep the handle instead and check that one.
 		bool Exists(Window* window) const;
+		bool Exists(WindowHandle handle) const { return m_windowRegistry.Get(handle) != nullptr; }
 		uint32_t NativeWindowCount();
 
 		void Capture(Window* window, bool redirectToChildren);
@@ -95,6 +105,10 @@ namespace Berta
 		void TryAddWindowToBatch(Window* window, const DrawOperation& operation = DrawOperation::NeedUpdate | DrawOperation::NeedMap);
 
 		void GetNativeWindows(std::vector<API::NativeWindowHandle>& windows);
+		const WindowPool& GetWindowPool() const { return m_windowPool; }
+
+		// True when opaque windows painted after this one cover the whole area (root relative), see ControlReactor::IsOpaque.
+		bool IsOccluded(Window* window, const Rectangle& area);
 	private:
 		void AddWindowToBatch(Window* window, const Rectangle& areaToUpdate, const DrawOperation& operation);
 		void AddWindowToBatch(DrawBatch* batch, Window* window, const Rectangle& areaToUpdate, const DrawOperation& operation);
@@ -103,8 +117,11 @@ namespace Berta
 		bool GetIntersectionClipRect(Window* window, Rectangle& result);
 		bool IsPointOnWindow(Window* window, const Point& point);
 		Window* FindInTree(Window* window, const Point& point);
+		Window* FindInRoot(Window* window, const Point& point);
+		HitTestIndex* GetHitTestIndex(Window* window);
 		void DestroyInternal(Window* window);
-		void UpdateTreeInternal(Window* window, Graphics& rootGraphics, bool now, const Point& parentPosition = {}, const Rectangle& parentRectangle = {});
+		void Retire(Window* window);
+		void UpdateTreeInternal(Window* window, Graphics& rootGraphics, bool now, uint32_t& culledWindows, const Point& parentPosition = {}, const Rectangle& parentRectangle = {});
 		void PaintInternal(Window* window, Graphics& rootGraphics, bool doUpdate, const Point& parentPosition = {}, const Rectangle& parentRectangle = {});
 		
 		void SetParentInternal(Window* window, Window* newParent, const Point& deltaPosition);
@@ -114,11 +131,13 @@ namespace Berta
 		struct CaptureHistoryData
 		{
 			Window* WindowPtr{ nullptr };
+			WindowHandle Handle{ InvalidWindowHandle }; // The window may be gone by the time the capture returns to it.
 			bool RedirectToChildren{ false };
 
 			CaptureHistoryData() = default;
-			CaptureHistoryData(Window* windowPtr, bool redirectToChildren) : 
+			CaptureHistoryData(Window* windowPtr, WindowHandle handle, bool redirectToChildren) : 
 				WindowPtr(windowPtr),
+				Handle(handle),
 				RedirectToChildren(redirectToChildren)
 			{}
 		};
@@ -129,8 +148,9 @@ namespace Berta
 			std::vector<CaptureHistoryData> PrevCaptured;
 		}m_capture;
 
+		WindowPool m_windowPool; // First: destroyed after everything that may point to a window.
 		std::map<API::NativeWindowHandle, FormData> m_windowNativeRegistry;
-		std::set<Window*> m_windowRegistry;
+		WindowRegistry m_windowRegistry;
 
 		MenuItemReactor* m_rootMenuItemReactor{ nullptr };
 		bool m_keyboardCaptured{ false };
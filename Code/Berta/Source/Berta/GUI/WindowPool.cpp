@@ -0,0 +1,86 @@
+/*
+* MIT License
+*
+* Copyright (c) 2024 Edgar Bernal (edgar.bernal@gmail.com)
+*/
+
+#include "btpch.h"
+#include "WindowPool.h"
+
+#include "Berta/GUI/Window.h"
+
+#include <new>
+
+namespace Berta
+{
+	WindowPool::~WindowPool()
+	{
+		Reclaim();
+
+		// Windows still alive at this point are only the ones never destroyed, their memory goes with the blocks.
+		for (auto block : m_blocks)
+		{
+			::operator delete(block, std::align_val_t{ alignof(Window) });
+		}
+	}
+
+	Window* WindowPool::Allocate(WindowType type)
+	{
+		if (m_free.empty())
+		{
+			auto block = static_cast<Window*>(::operator new(sizeof(Window) * BlockSize, std::align_val_t{ alignof(Window) }));
+			m_blocks.emplace_back(block);
+
+			m_free.reserve(m_free.size() + BlockSize);
+			for (size_t i = BlockSize; i > 0; --i)
+			{
+				m_free.emplace_back(block + i - 1);
+			}
+		}
+
+		auto slot = m_free.back();
+		m_free.pop_back();
+		++m_allocated;
+
+		return new (slot) Window(type);
+	}
+
+	void WindowPool::Retire(Window* window)
+	{
+		if (window)
+		{
+			m_retired.emplace_back(window);
+		}
+	}
+
+	void WindowPool::Reclaim()
+	{
+		// A destructor may end up retiring more windows, take the current list first.
+		while (!m_retired.empty())
+		{
+			auto retired = std::move(m_retired);
+			m_retired.clear();
+
+			for (auto window : retired)
+			{
+				// Stale pointers checked with WindowManager::Exists still read this handle, the slot stays mapped.
+				window->Handle = InvalidWindowHandle;
+				window->~Window();
+
+				m_free.emplace_back(window);
+				++m_reclaimed;
+			}
+		}
+	}
+
+	WindowPool::Statistics WindowPool::GetStatistics() const
+	{
+		Statistics statistics;
+		statistics.Allocated = m_allocated;
+		statistics.Reclaimed = m_reclaimed;
+		statistics.Live = static_cast<size_t>(m_allocated - m_reclaimed);
+		statistics.Retired = m_retired.size();
+		statistics.Blocks = m_blocks.size();
+		return statistics;
+	}
+}
\ No newline at end of file
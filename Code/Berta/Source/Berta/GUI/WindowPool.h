@@ -0,0 +1,61 @@
+/*
+* MIT License
+*
+* Copyright (c) 2024 Edgar Bernal (edgar.bernal@gmail.com)
+*/
+
+#ifndef BT_WINDOW_POOL_HEADER
+#define BT_WINDOW_POOL_HEADER
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Berta
+{
+	struct Window;
+	enum class WindowType;
+
+	/*
+	* Block allocator for Window objects. A destroyed window is only retired: event handlers, draw batches
+	* and root guards further up the stack may still use it, so it is destructed later by Reclaim,
+	* once none of them can be running (see WindowManager::Retire). UI thread only.
+	*/
+	class WindowPool
+	{
+	public:
+		static constexpr size_t BlockSize = 64; // Windows per block.
+
+		struct Statistics
+		{
+			uint64_t Allocated{ 0 };
+			uint64_t Reclaimed{ 0 };
+			size_t Live{ 0 };		// Includes the retired ones.
+			size_t Retired{ 0 };
+			size_t Blocks{ 0 };
+		};
+
+		WindowPool() = default;
+		~WindowPool();
+
+		WindowPool(const WindowPool&) = delete;
+		WindowPool& operator=(const WindowPool&) = delete;
+
+		Window* Allocate(WindowType type);
+		void Retire(Window* window);
+		void Reclaim();
+
+		bool HasRetired() const { return !m_retired.empty(); }
+		Statistics GetStatistics() const;
+
+	private:
+		std::vector<void*> m_blocks;
+		std::vector<Window*> m_free;		// Slots are reused LIFO, the most recently freed memory is likely in cache.
+		std::vector<Window*> m_retired;
+
+		uint64_t m_allocated{ 0 };
+		uint64_t m_reclaimed{ 0 };
+	};
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,66 @@
+/*
+* MIT License
+*
+* Copyright (c) 2024 Edgar Bernal (edgar.bernal@gmail.com)
+*/
+
+#include "btpch.h"
+#include "WindowRegistry.h"
+
+namespace Berta
+{
+	WindowHandle WindowRegistry::Add(Window* window)
+	{
+		uint32_t index = m_freeSlot;
+		if (index != InvalidSlot)
+		{
+			m_freeSlot = m_slots[index].NextFree;
+		}
+		else
+		{
+			index = static_cast<uint32_t>(m_slots.size());
+			m_slots.emplace_back();
+		}
+
+		auto& slot = m_slots[index];
+		slot.WindowPtr = window;
+		slot.NextFree = InvalidSlot;
+		slot.DenseIndex = static_cast<uint32_t>(m_windows.size());
+
+		m_windows.emplace_back(window);
+		m_windowSlots.emplace_back(index);
+
+		return (static_cast<WindowHandle>(slot.Generation) << 32) | index;
+	}
+
+	void WindowRegistry::Remove(WindowHandle handle)
+	{
+		if (Get(handle) == nullptr)
+		{
+			return;
+		}
+
+		auto index = static_cast<uint32_t>(handle & UINT32_MAX);
+		auto& slot = m_slots[index];
+
+		auto denseIndex = slot.DenseIndex;
+		auto lastIndex = static_cast<uint32_t>(m_windows.size() - 1);
+		if (denseIndex != lastIndex)
+		{
+			m_windows[denseIndex] = m_windows[lastIndex];
+			m_windowSlots[denseIndex] = m_windowSlots[lastIndex];
+			m_slots[m_windowSlots[denseIndex]].DenseIndex = denseIndex;
+		}
+		m_windows.pop_back();
+		m_windowSlots.pop_back();
+
+		slot.WindowPtr = nullptr;
+		slot.DenseIndex = InvalidSlot;
+		if (++slot.Generation == 0)
+		{
+			slot.Generation = 1; // Generation 0 would make InvalidWindowHandle valid.
+		}
+		slot.NextFree = m_freeSlot;
+		m_freeSlot = index;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,66 @@
+/*
+* MIT License
+*
+* Copyright (c) 2024 Edgar Bernal (edgar.bernal@gmail.com)
+*/
+
+#ifndef BT_WINDOW_REGISTRY_HEADER
+#define BT_WINDOW_REGISTRY_HEADER
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Berta
+{
+	struct Window;
+
+	// Slot index in the low 32 bits, slot generation in the high ones. A stale handle never matches a reused slot.
+	using WindowHandle = uint64_t;
+	constexpr WindowHandle InvalidWindowHandle = 0;
+
+	/*
+	* Slot map of the live windows. Handles are checked in O(1) and stay invalid after the window is destroyed,
+	* even if a new window is allocated at the same address. UI thread only.
+	*/
+	class WindowRegistry
+	{
+	public:
+		WindowHandle Add(Window* window);
+		void Remove(WindowHandle handle);
+
+		Window* Get(WindowHandle handle) const
+		{
+			auto index = static_cast<uint32_t>(handle & UINT32_MAX);
+			auto generation = static_cast<uint32_t>(handle >> 32);
+			if (index >= m_slots.size() || m_slots[index].Generation != generation)
+			{
+				return nullptr;
+			}
+
+			return m_slots[index].WindowPtr;
+		}
+
+		// Live windows, packed. Removing a window moves the last one into its place.
+		const std::vector<Window*>& GetWindows() const { return m_windows; }
+		size_t Size() const { return m_windows.size(); }
+
+	private:
+		static constexpr uint32_t InvalidSlot = UINT32_MAX;
+
+		struct Slot
+		{
+			Window* WindowPtr{ nullptr };
+			uint32_t Generation{ 1 };
+			uint32_t NextFree{ InvalidSlot };
+			uint32_t DenseIndex{ InvalidSlot };
+		};
+
+		std::vector<Slot> m_slots;
+		std::vector<Window*> m_windows;
+		std::vector<uint32_t> m_windowSlots; // Slot of each entry of m_windows.
+		uint32_t m_freeSlot{ InvalidSlot };
+	};
+}
+
+#endif
\ No newline at end of file
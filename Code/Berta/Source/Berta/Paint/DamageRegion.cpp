@@ -0,0 +1,115 @@
+/*
+* MIT License
+*
+* Copyright (c) 2024 Edgar Bernal (edgar.bernal@gmail.com)
+*/
+
+#include "btpch.h"
+#include "DamageRegion.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace Berta
+{
+	void DamageRegion::Add(const Rectangle& rect)
+	{
+		if (rect.Width == 0 || rect.Height == 0)
+		{
+			return;
+		}
+
+		auto pending = rect;
+		bool merged = true;
+		while (merged)
+		{
+			merged = false;
+			for (auto& current : m_rectangles)
+			{
+				if (Encloses(current, pending))
+				{
+					return;
+				}
+			}
+
+			std::erase_if(m_rectangles, [&pending](const Rectangle& current)
+			{
+				return Encloses(pending, current);
+			});
+
+			for (size_t i = 0; i < m_rectangles.size(); ++i)
+			{
+				if (ShouldMerge(m_rectangles[i], pending))
+				{
+					// The bigger rectangle may now overlap others, add it again.
+					pending = pending.Union(m_rectangles[i]);
+					m_rectangles.erase(m_rectangles.begin() + i);
+					merged = true;
+					break;
+				}
+			}
+		}
+
+		m_rectangles.emplace_back(pending);
+		if (m_rectangles.size() > MaxRectangles)
+		{
+			MergeClosestPair();
+		}
+	}
+
+	uint64_t DamageRegion::GetArea() const
+	{
+		uint64_t area = 0;
+		for (auto& rect : m_rectangles)
+		{
+			area += GetArea(rect);
+		}
+		return area;
+	}
+
+	uint64_t DamageRegion::GetArea(const Rectangle& rect)
+	{
+		return static_cast<uint64_t>(rect.Width) * rect.Height;
+	}
+
+	bool DamageRegion::Encloses(const Rectangle& outer, const Rectangle& inner)
+	{
+		return inner.X >= outer.X && inner.Y >= outer.Y &&
+			inner.X + (int)inner.Width <= outer.X + (int)outer.Width &&
+			inner.Y + (int)inner.Height <= outer.Y + (int)outer.Height;
+	}
+
+	bool DamageRegion::ShouldMerge(const Rectangle& lhs, const Rectangle& rhs)
+	{
+		// Merged when the bounding box is at most a quarter bigger than both rectangles together.
+		auto unionArea = GetArea(lhs.Union(rhs));
+		return unionArea * 4 <= (GetArea(lhs) + GetArea(rhs)) * 5;
+	}
+
+	void DamageRegion::MergeClosestPair()
+	{
+		size_t bestFirst = 0;
+		size_t bestSecond = 1;
+		auto bestWaste = (std::numeric_limits<uint64_t>::max)();
+		for (size_t i = 0; i < m_rectangles.size(); ++i)
+		{
+			for (size_t j = i + 1; j < m_rectangles.size(); ++j)
+			{
+				auto unionArea = GetArea(m_rectangles[i].Union(m_rectangles[j]));
+				auto pairArea = GetArea(m_rectangles[i]) + GetArea(m_rectangles[j]);
+				auto waste = unionArea > pairArea ? unionArea - pairArea : 0;
+				if (waste < bestWaste)
+				{
+					bestWaste = waste;
+					bestFirst = i;
+					bestSecond = j;
+				}
+			}
+		}
+
+		auto merged = m_rectangles[bestFirst].Union(m_rectangles[bestSecond]);
+		m_rectangles.erase(m_rectangles.begin() + bestSecond);
+		m_rectangles.erase(m_rectangles.begin() + bestFirst);
+		Add(merged);
+	}
+}
\ No newline at end of file
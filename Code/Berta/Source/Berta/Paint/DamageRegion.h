@@ -0,0 +1,44 @@
+/*
+* MIT License
+*
+* Copyright (c) 2024 Edgar Bernal (edgar.bernal@gmail.com)
+*/
+
+#ifndef BT_DAMAGE_REGION_HEADER
+#define BT_DAMAGE_REGION_HEADER
+
+#include <cstdint>
+#include <vector>
+#include "Berta/Core/BasicTypes.h"
+
+namespace Berta
+{
+	/*
+	* Damaged area of a surface as a short list of rectangles.
+	* Rectangles inside another one are dropped, and two rectangles are merged when their bounding box
+	* wastes little area, so the list stays small without covering much more than what was damaged.
+	*/
+	class DamageRegion
+	{
+	public:
+		static constexpr size_t MaxRectangles = 16;
+
+		void Add(const Rectangle& rect);
+		void Clear() { m_rectangles.clear(); }
+
+		bool IsEmpty() const { return m_rectangles.empty(); }
+		uint64_t GetArea() const;
+		const std::vector<Rectangle>& GetRectangles() const { return m_rectangles; }
+
+		static uint64_t GetArea(const Rectangle& rect);
+
+	private:
+		static bool Encloses(const Rectangle& outer, const Rectangle& inner);
+		static bool ShouldMerge(const Rectangle& lhs, const Rectangle& rhs);
+		void MergeClosestPair();
+
+		std::vector<Rectangle> m_rectangles;
+	};
+}
+
+#endif
\ No newline at end of file
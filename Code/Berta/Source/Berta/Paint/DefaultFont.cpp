@@ -0,0 +1,429 @@
+/*
+* MIT License
+*
+* Copyright (c) 2024 Edgar Bernal (edgar.bernal@gmail.com)
+*/
+
+#include "btpch.h"
+#include "DefaultFont.h"
+
+#include <cmath>
+
+// Glyphs rasterized from DejaVu Sans at 12 px (light hinting).
+// Bitstream Vera Fonts Copyright (c) 2003 by Bitstream, Inc. All Rights Reserved. Bitstream Vera is a trademark of Bitstream, Inc.
+// DejaVu changes are in the public domain. Redistributed under the Bitstream Vera license.
+
+namespace Berta::DefaultFont
+{
+	namespace
+	{
+		constexpr wchar_t FirstCharacter = 32;
+		constexpr wchar_t LastCharacter = 126;
+
+		const Glyph g_glyphs[] =
+		{
+			{ 0, 0, 0, 0, 256, 0 },	// ' '
+			{ 1, 9, 2, 9, 320, 0 },	// '!'
+			{ 1, 9, 4, 4, 384, 18 },	// '"'
+			{ 0, 9, 10, 9, 640, 34 },	// '#'
+			{ 1, 10, 6, 12, 512, 124 },	// '$'
+			{ 0, 9, 11, 9, 704, 196 },	// '%'
+			{ 0, 9, 9, 9, 576, 295 },	// '&'
+			{ 1, 9, 2, 4, 192, 376 },	// '''
+			{ 1, 10, 3, 11, 320, 384 },	// '('
+			{ 0, 10, 4, 11, 320, 417 },	// ')'
+			{ 0, 9, 6, 6, 384, 461 },	// '*'
+			{ 1, 8, 8, 8, 640, 497 },	// '+'
+			{ 0, 2, 3, 3, 256, 561 },	// ','
+			{ 0, 4, 4, 1, 256, 570 },	// '-'
+			{ 1, 2, 2, 2, 256, 574 },	// '.'
+			{ 0, 9, 5, 11, 256, 578 },	// '/'
+			{ 0, 9, 7, 9, 512, 633 },	// '0'
+			{ 1, 9, 6, 9, 512, 696 },	// '1'
+			{ 0, 9, 7, 9, 512, 750 },	// '2'
+			{ 0, 9, 7, 9, 512, 813 },	// '3'
+			{ 0, 9, 7, 9, 512, 876 },	// '4'
+			{ 0, 9, 7, 9, 512, 939 },	// '5'
+			{ 0, 9, 7, 9, 512, 1002 },	// '6'
+			{ 0, 9, 7, 9, 512, 1065 },	// '7'
+			{ 0, 9, 7, 9, 512, 1128 },	// '8'
+			{ 0, 9, 7, 9, 512, 1191 },	// '9'
+			{ 1, 7, 2, 7, 256, 1254 },	// ':'
+			{ 0, 7, 3, 8, 256, 1268 },	// ';'
+			{ 1, 8, 8, 8, 640, 1292 },	// '<'
+			{ 1, 5, 8, 4, 640, 1356 },	// '='
+			{ 1, 8, 8, 8, 640, 1388 },	// '>'
+			{ 0, 9, 6, 9, 384, 1452 },	// '?'
+			{ 0, 9, 12, 11, 768, 1506 },	// '@'
+			{ 0, 9, 9, 9, 512, 1638 },	// 'A'
+			{ 1, 9, 7, 9, 512, 1719 },	// 'B'
+			{ 0, 9, 8, 9, 512, 1782 },	// 'C'
+			{ 1, 9, 8, 9, 576, 1854 },	// 'D'
+			{ 1, 9, 6, 9, 512, 1926 },	// 'E'
+			{ 1, 9, 6, 9, 448, 1980 },	// 'F'
+			{ 0, 9, 9, 9, 576, 2034 },	// 'G'
+			{ 1, 9, 7, 9, 576, 2115 },	// 'H'
+			{ 1, 9, 2, 9, 256, 2178 },	// 'I'
+			{ -1, 9, 4, 12, 256, 2196 },	// 'J'
+			{ 1, 9, 8, 9, 512, 2244 },	// 'K'
+			{ 1, 9, 6, 9, 448, 2316 },	// 'L'
+			{ 1, 9, 9, 9, 640, 2370 },	// 'M'
+			{ 1, 9, 7, 9, 576, 2451 },	// 'N'
+			{ 0, 9, 9, 9, 576, 2514 },	// 'O'
+			{ 1, 9, 6, 9, 448, 2595 },	// 'P'
+			{ 0, 9, 9, 11, 576, 2649 },	// 'Q'
+			{ 1, 9, 7, 9, 512, 2748 },	// 'R'
+			{ 0, 9, 7, 9, 512, 2811 },	// 'S'
+			{ -1, 9, 9, 9, 448, 2874 },	// 'T'
+			{ 1, 9, 7, 9, 576, 2955 },	// 'U'
+			{ 0, 9, 9, 9, 512, 3018 },	// 'V'
+			{ 0, 9, 12, 9, 768, 3099 },	// 'W'
+			{ 0, 9, 8, 9, 512, 3207 },	// 'X'
+			{ -1, 9, 9, 9, 448, 3279 },	// 'Y'
+			{ 0, 9, 8, 9, 512, 3360 },	// 'Z'
+			{ 1, 10, 3, 11, 320, 3432 },	// '['
+			{ 0, 9, 5, 11, 256, 3465 },	// '\\'
+			{ 1, 10, 3, 11, 320, 3520 },	// ']'
+			{ 1, 10, 8, 4, 640, 3553 },	// '^'
+			{ -1, -2, 8, 1, 384, 3585 },	// '_'
+			{ 1, 11, 3, 3, 384, 3593 },	// '`'
+			{ 0, 7, 7, 7, 448, 3602 },	// 'a'
+			{ 1, 10, 6, 10, 512, 3651 },	// 'b'
+			{ 0, 7, 6, 7, 448, 3711 },	// 'c'
+			{ 0, 10, 7, 10, 512, 3753 },	// 'd'
+			{ 0, 7, 7, 7, 448, 3823 },	// 'e'
+			{ 0, 10, 5, 10, 256, 3872 },	// 'f'
+			{ 0, 7, 7, 10, 512, 3922 },	// 'g'
+			{ 1, 10, 6, 10, 512, 3992 },	// 'h'
+			{ 1, 10, 2, 10, 192, 4052 },	// 'i'
+			{ -1, 10, 4, 13, 192, 4072 },	// 'j'
+			{ 1, 10, 6, 10, 448, 4124 },	// 'k'
+			{ 1, 10, 2, 10, 192, 4184 },	// 'l'
+			{ 1, 7, 10, 7, 768, 4204 },	// 'm'
+			{ 1, 7, 6, 7, 512, 4274 },	// 'n'
+			{ 0, 7, 7, 7, 448, 4316 },	// 'o'
+			{ 1, 7, 6, 10, 512, 4365 },	// 'p'
+			{ 0, 7, 7, 10, 512, 4425 },	// 'q'
+			{ 1, 8, 4, 8, 320, 4495 },	// 'r'
+			{ 0, 7, 6, 7, 384, 4527 },	// 's'
+			{ 0, 9, 5, 9, 320, 4569 },	// 't'
+			{ 1, 7, 6, 7, 512, 4614 },	// 'u'
+			{ 0, 7, 7, 7, 448, 4656 },	// 'v'
+			{ 0, 7, 10, 7, 640, 4705 },	// 'w'
+			{ 0, 7, 7, 7, 448, 4775 },	// 'x'
+			{ 0, 7, 7, 10, 448, 4824 },	// 'y'
+			{ 0, 7, 6, 7, 384, 4894 },	// 'z'
+			{ 1, 10, 6, 12, 512, 4936 },	// '{'
+			{ 1, 10, 2, 13, 256, 5008 },	// '|'
+			{ 1, 10, 6, 12, 512, 5034 },	// '}'
+			{ 1, 6, 8, 4, 640, 5106 },	// '~'
+		};
+
+		const uint8_t g_coverage[] =
+		{
+			0x30, 0xff, 0x30, 0xff, 0x30, 0xff, 0x30, 0xff, 0x29, 0xf9, 0x1a, 0xec, 0x03, 0x27, 0x1a, 0x8c, 0x30, 0xff, 0xd8, 0x28,
+			0xa0, 0x5c, 0xd8, 0x28, 0xa0, 0x5c, 0xd8, 0x28, 0xa0, 0x5c, 0x54, 0x0f, 0x3e, 0x23, 0x00, 0x00, 0x00, 0x00, 0xca, 0x25,
+			0x22, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xe9, 0x01, 0x55, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0xbf, 0x00,
+			0x89, 0x6a, 0x00, 0x00, 0x00, 0x61, 0xf0, 0xf6, 0xf8, 0xf0, 0xfc, 0xf3, 0xf0, 0x21, 0x00, 0x00, 0x00, 0xc3, 0x30, 0x1e,
+			0xd0, 0x01, 0x00, 0x00, 0x12, 0xf0, 0xf1, 0xfd, 0xf0, 0xf7, 0xf7, 0xf0, 0x70, 0x00, 0x00, 0x00, 0x58, 0x99, 0x00, 0xaf,
+			0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0x67, 0x00, 0xe0, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0x35, 0x13, 0xdd,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x10, 0x00, 0x00, 0x00, 0x00, 0x88, 0x10, 0x00, 0x00, 0x31, 0xbc, 0xea, 0xd9,
+			0xbc, 0x10, 0xd6, 0x59, 0x88, 0x11, 0x37, 0x0c, 0xf1, 0x30, 0x88, 0x10, 0x00, 0x00, 0x7a, 0xeb, 0xdc, 0x71, 0x18, 0x00,
+			0x00, 0x20, 0xaf, 0xaf, 0xf0, 0x36, 0x00, 0x00, 0x88, 0x10, 0x8a, 0x94, 0x64, 0x06, 0x88, 0x18, 0xb5, 0x7b, 0xa0, 0xe0,
+			0xf0, 0xe8, 0xa8, 0x0b, 0x00, 0x00, 0x88, 0x10, 0x00, 0x00, 0x00, 0x00, 0x88, 0x10, 0x00, 0x00, 0x00, 0x8a, 0xce, 0xbf,
+			0x18, 0x00, 0x00, 0x56, 0x99, 0x00, 0x00, 0x2e, 0xc9, 0x01, 0x71, 0x89, 0x00, 0x0c, 0xd0, 0x12, 0x00, 0x00, 0x4f, 0x9e,
+			0x00, 0x43, 0xaa, 0x00, 0x8d, 0x62, 0x00, 0x00, 0x00, 0x25, 0xd0, 0x05, 0x7f, 0x80, 0x2d, 0xc1, 0x01, 0x00, 0x00, 0x00,
+			0x00, 0x6c, 0xc5, 0xa6, 0x10, 0xbf, 0x2f, 0x63, 0xc2, 0xa7, 0x10, 0x00, 0x00, 0x00, 0x00, 0x60, 0x90, 0x1b, 0xd7, 0x08,
+			0x76, 0x86, 0x00, 0x00, 0x00, 0x10, 0xd0, 0x0e, 0x43, 0xaa, 0x00, 0x3b, 0xb2, 0x00, 0x00, 0x00, 0x97, 0x59, 0x00, 0x24,
+			0xd2, 0x02, 0x67, 0x91, 0x00, 0x00, 0x34, 0xbb, 0x00, 0x00, 0x00, 0x83, 0xcc, 0xc1, 0x1b, 0x00, 0x00, 0x70, 0xe7, 0xf2,
+			0xc0, 0x0b, 0x00, 0x00, 0x00, 0x22, 0xf7, 0x33, 0x06, 0x44, 0x09, 0x00, 0x00, 0x00, 0x26, 0xf2, 0x0a, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x07, 0xdd, 0xac, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x93, 0xaf, 0xa4, 0x02, 0x00, 0x87, 0x6b,
+			0x23, 0xfc, 0x0e, 0x07, 0xbb, 0xa1, 0x02, 0xce, 0x3c, 0x2d, 0xf5, 0x02, 0x00, 0x0b, 0xc6, 0xbe, 0xc5, 0x00, 0x04, 0xd5,
+			0x80, 0x01, 0x00, 0x51, 0xff, 0xa0, 0x00, 0x00, 0x20, 0xad, 0xd6, 0xcf, 0xb2, 0x49, 0xdc, 0x84, 0xd8, 0x28, 0xd8, 0x28,
+			0xd8, 0x28, 0x54, 0x0f, 0x00, 0x7e, 0x78, 0x0f, 0xe6, 0x0d, 0x69, 0xa3, 0x00, 0xb4, 0x64, 0x00, 0xe2, 0x3d, 0x00, 0xf3,
+			0x30, 0x00, 0xe2, 0x3d, 0x00, 0xb4, 0x63, 0x00, 0x6a, 0xa2, 0x00, 0x10, 0xe6, 0x0c, 0x00, 0x7e, 0x78, 0x00, 0xc7, 0x2e,
+			0x00, 0x00, 0x54, 0xb1, 0x00, 0x00, 0x07, 0xed, 0x1c, 0x00, 0x00, 0xb7, 0x63, 0x00, 0x00, 0x8e, 0x92, 0x00, 0x00, 0x81,
+			0xa2, 0x00, 0x00, 0x8e, 0x92, 0x00, 0x00, 0xb7, 0x63, 0x00, 0x06, 0xed, 0x1d, 0x00, 0x52, 0xb2, 0x00, 0x00, 0xc7, 0x30,
+			0x00, 0x00, 0x00, 0x54, 0x54, 0x00, 0x00, 0x5f, 0x6f, 0x57, 0x57, 0x6f, 0x5f, 0x00, 0x4f, 0xd1, 0xd2, 0x50, 0x00, 0x16,
+			0x93, 0xbb, 0xbb, 0x95, 0x16, 0x47, 0x2a, 0x54, 0x54, 0x2a, 0x47, 0x00, 0x00, 0x3b, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x65, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x84, 0x00, 0x00,
+			0x00, 0xad, 0xec, 0xec, 0xf5, 0xf6, 0xec, 0xec, 0xb8, 0x14, 0x1c, 0x1c, 0x86, 0x91, 0x1c, 0x1c, 0x15, 0x00, 0x00, 0x00,
+			0x78, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x84, 0x00, 0x00,
+			0x00, 0x00, 0x98, 0xa4, 0x00, 0xb5, 0x6a, 0x03, 0xd7, 0x07, 0x68, 0xff, 0xff, 0xc0, 0x64, 0x48, 0xb8, 0x84, 0x00, 0x00,
+			0x1a, 0xe4, 0x00, 0x00, 0x00, 0x64, 0x9c, 0x00, 0x00, 0x00, 0xae, 0x52, 0x00, 0x00, 0x05, 0xec, 0x0d, 0x00, 0x00, 0x43,
+			0xbd, 0x00, 0x00, 0x00, 0x8d, 0x73, 0x00, 0x00, 0x00, 0xd7, 0x28, 0x00, 0x00, 0x21, 0xde, 0x00, 0x00, 0x00, 0x6c, 0x94,
+			0x00, 0x00, 0x00, 0xb6, 0x4a, 0x00, 0x00, 0x00, 0x76, 0x09, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xa8, 0xf5, 0xe4, 0x68, 0x00,
+			0x00, 0x9b, 0xbe, 0x15, 0x3d, 0xf3, 0x3d, 0x05, 0xf4, 0x3e, 0x00, 0x00, 0x9c, 0x9c, 0x25, 0xff, 0x0e, 0x00, 0x00, 0x6c,
+			0xc7, 0x31, 0xff, 0x01, 0x00, 0x00, 0x5d, 0xd4, 0x25, 0xff, 0x0e, 0x00, 0x00, 0x6c, 0xc7, 0x05, 0xf5, 0x3c, 0x00, 0x00,
+			0x9b, 0x9c, 0x00, 0x9c, 0xba, 0x11, 0x38, 0xf1, 0x3d, 0x00, 0x0d, 0xa9, 0xf5, 0xe6, 0x68, 0x00, 0x6f, 0xcf, 0xfb, 0x98,
+			0x00, 0x00, 0x53, 0x4d, 0xa4, 0x98, 0x00, 0x00, 0x00, 0x00, 0x94, 0x98, 0x00, 0x00, 0x00, 0x00, 0x94, 0x98, 0x00, 0x00,
+			0x00, 0x00, 0x94, 0x98, 0x00, 0x00, 0x00, 0x00, 0x94, 0x98, 0x00, 0x00, 0x00, 0x00, 0x94, 0x98, 0x00, 0x00, 0x04, 0x08,
+			0x97, 0x9b, 0x08, 0x04, 0x84, 0xff, 0xff, 0xff, 0xff, 0x88, 0x06, 0x94, 0xdd, 0xf6, 0xd1, 0x4e, 0x00, 0x0d, 0x93, 0x34,
+			0x16, 0x67, 0xf8, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0xda, 0x56, 0x00, 0x00, 0x00, 0x00, 0x18, 0xfa, 0x29, 0x00, 0x00,
+			0x00, 0x07, 0xbf, 0x94, 0x00, 0x00, 0x00, 0x05, 0xb1, 0xaa, 0x03, 0x00, 0x00, 0x04, 0xad, 0xb2, 0x05, 0x00, 0x00, 0x03,
+			0xa8, 0xbe, 0x0f, 0x08, 0x08, 0x03, 0x20, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x00, 0x94, 0xe2, 0xf8, 0xde, 0x72, 0x00,
+			0x00, 0x3d, 0x20, 0x11, 0x38, 0xe8, 0x46, 0x00, 0x00, 0x00, 0x00, 0x15, 0xdb, 0x6a, 0x00, 0x00, 0x86, 0xea, 0xfd, 0xd9,
+			0x15, 0x00, 0x00, 0x0d, 0x1d, 0x58, 0x8d, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x98, 0x9d, 0x0d, 0x6e, 0x21, 0x12, 0x53, 0xf5, 0x5a, 0x0b, 0xb7, 0xed, 0xf7, 0xd6, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x20,
+			0xf6, 0xb8, 0x00, 0x00, 0x00, 0x00, 0xb3, 0xc3, 0xb8, 0x00, 0x00, 0x00, 0x50, 0xb2, 0x78, 0xb8, 0x00, 0x00, 0x0b, 0xd9,
+			0x22, 0x78, 0xb8, 0x00, 0x00, 0x89, 0x7f, 0x00, 0x78, 0xb8, 0x00, 0x2a, 0xd9, 0x08, 0x00, 0x78, 0xb8, 0x00, 0x68, 0xf5,
+			0xe8, 0xe8, 0xf3, 0xf9, 0xe0, 0x09, 0x18, 0x18, 0x18, 0x84, 0xbe, 0x17, 0x00, 0x00, 0x00, 0x00, 0x78, 0xb8, 0x00, 0x00,
+			0xb4, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0xb4, 0x65, 0x08, 0x08, 0x07, 0x00, 0x00, 0xb4, 0x60, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0xb4, 0xe2, 0xe2, 0xbc, 0x41, 0x00, 0x00, 0x4a, 0x32, 0x28, 0x78, 0xf8, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5,
+			0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x82, 0x0b, 0x5a, 0x1a, 0x13, 0x64, 0xf9, 0x36, 0x0c, 0xc2, 0xf0, 0xf5, 0xce,
+			0x51, 0x00, 0x00, 0x00, 0x5e, 0xd9, 0xf9, 0xd9, 0x35, 0x00, 0x4c, 0xe8, 0x4d, 0x16, 0x34, 0x20, 0x00, 0xce, 0x60, 0x00,
+			0x00, 0x00, 0x00, 0x07, 0xfe, 0x78, 0xe5, 0xe7, 0x92, 0x08, 0x22, 0xff, 0xc3, 0x17, 0x1d, 0xd1, 0x81, 0x19, 0xff, 0x4f,
+			0x00, 0x00, 0x63, 0xcb, 0x00, 0xeb, 0x4e, 0x00, 0x00, 0x63, 0xcb, 0x00, 0x8a, 0xc2, 0x14, 0x1a, 0xcf, 0x7f, 0x00, 0x07,
+			0x9b, 0xf1, 0xe8, 0x90, 0x07, 0x04, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x00, 0x08, 0x08, 0x08, 0x12, 0xf3, 0x3d, 0x00,
+			0x00, 0x00, 0x00, 0x5d, 0xdd, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x1e, 0xfc, 0x20, 0x00,
+			0x00, 0x00, 0x00, 0x7d, 0xbe, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x3d, 0xf3, 0x0b, 0x00,
+			0x00, 0x00, 0x00, 0x9c, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xbe, 0xf3, 0xe7, 0x8c, 0x02, 0x00, 0xce, 0x9c, 0x0a, 0x25,
+			0xe0, 0x65, 0x00, 0xef, 0x3e, 0x00, 0x00, 0x9b, 0x90, 0x00, 0x7e, 0x9b, 0x0a, 0x24, 0xde, 0x48, 0x00, 0x34, 0xd8, 0xff,
+			0xff, 0x93, 0x00, 0x0a, 0xec, 0x7a, 0x08, 0x1d, 0xc6, 0x7c, 0x24, 0xff, 0x0c, 0x00, 0x00, 0x6c, 0xc4, 0x04, 0xe9, 0x77,
+			0x05, 0x19, 0xc4, 0x95, 0x00, 0x37, 0xc5, 0xf2, 0xea, 0xa4, 0x10, 0x00, 0x27, 0xbd, 0xf4, 0xdd, 0x56, 0x00, 0x04, 0xd8,
+			0x88, 0x0a, 0x3f, 0xf3, 0x2d, 0x2b, 0xfd, 0x09, 0x00, 0x00, 0xab, 0x8d, 0x2d, 0xfd, 0x08, 0x00, 0x00, 0xab, 0xbb, 0x05,
+			0xdc, 0x84, 0x06, 0x3b, 0xf5, 0xc5, 0x00, 0x2b, 0xbd, 0xed, 0xc5, 0x9c, 0xa9, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0x73,
+			0x00, 0x38, 0x19, 0x19, 0x7d, 0xe6, 0x0b, 0x00, 0x82, 0xef, 0xf7, 0xbb, 0x29, 0x00, 0x53, 0x59, 0x98, 0xa4, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x53, 0x59, 0x98, 0xa4, 0x00, 0x98, 0xa4, 0x00, 0x53, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x98, 0xa4, 0x00, 0xb5, 0x6a, 0x03, 0xd7, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17,
+			0x00, 0x00, 0x00, 0x00, 0x0f, 0x66, 0xc7, 0xbf, 0x00, 0x01, 0x43, 0xa4, 0xf1, 0xb1, 0x52, 0x06, 0x69, 0xe1, 0xcf, 0x70,
+			0x15, 0x00, 0x00, 0x00, 0x89, 0xf3, 0xa0, 0x42, 0x01, 0x00, 0x00, 0x00, 0x00, 0x15, 0x70, 0xd0, 0xe2, 0x86, 0x28, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x30, 0x91, 0xeb, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x37, 0xaa, 0xe8, 0xe8, 0xe8,
+			0xe8, 0xe8, 0xe8, 0xb5, 0x11, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x12, 0xad, 0xec, 0xec, 0xec, 0xec, 0xec, 0xec, 0xb8,
+			0x14, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x15, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb3, 0xcb, 0x6b, 0x11,
+			0x00, 0x00, 0x00, 0x00, 0x04, 0x4e, 0xad, 0xf2, 0xa9, 0x48, 0x03, 0x00, 0x00, 0x00, 0x00, 0x12, 0x6b, 0xcb, 0xe4, 0x71,
+			0x00, 0x00, 0x00, 0x01, 0x3d, 0x9b, 0xf2, 0x94, 0x00, 0x24, 0x81, 0xde, 0xd3, 0x74, 0x17, 0x00, 0x9a, 0xed, 0x95, 0x35,
+			0x00, 0x00, 0x00, 0x00, 0x35, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x9b, 0xe7, 0xf1, 0xa0, 0x06, 0x1b, 0x73,
+			0x17, 0x21, 0xe0, 0x67, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x6b, 0x00, 0x00, 0x00, 0x7d, 0xd3, 0x0d, 0x00, 0x00, 0x58, 0xda,
+			0x14, 0x00, 0x00, 0x00, 0xa2, 0x79, 0x00, 0x00, 0x00, 0x00, 0x63, 0x43, 0x00, 0x00, 0x00, 0x00, 0x62, 0x43, 0x00, 0x00,
+			0x00, 0x00, 0xb4, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xa9, 0xde, 0xde, 0xbe, 0x5f, 0x01, 0x00, 0x00, 0x00, 0x00,
+			0x7a, 0xc7, 0x49, 0x0a, 0x00, 0x26, 0x96, 0xb8, 0x09, 0x00, 0x00, 0x50, 0xb8, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78,
+			0x87, 0x00, 0x00, 0xce, 0x1c, 0x00, 0x7a, 0xdc, 0xc3, 0x86, 0x78, 0x04, 0xd9, 0x01, 0x18, 0xc1, 0x00, 0x3f, 0xcb, 0x10,
+			0x0e, 0xc4, 0x80, 0x00, 0xba, 0x1c, 0x2e, 0xa6, 0x00, 0x6e, 0x82, 0x00, 0x00, 0x76, 0x80, 0x00, 0xd1, 0x06, 0x19, 0xbe,
+			0x00, 0x40, 0xcb, 0x10, 0x0d, 0xc4, 0x84, 0x71, 0x95, 0x00, 0x00, 0xcf, 0x19, 0x00, 0x7d, 0xdd, 0xc6, 0x85, 0xce, 0x7a,
+			0x06, 0x00, 0x00, 0x57, 0xb3, 0x04, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0xc0, 0x3b, 0x02,
+			0x02, 0x42, 0xd5, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0xaf, 0xde, 0xdf, 0xb3, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0xc0, 0xef, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xfd, 0xee, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xc5,
+			0x8e, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0x6a, 0x33, 0xfb, 0x17, 0x00, 0x00, 0x00, 0x3c, 0xfb, 0x14, 0x00, 0xd8,
+			0x71, 0x00, 0x00, 0x00, 0x9b, 0xb5, 0x00, 0x00, 0x7e, 0xd0, 0x00, 0x00, 0x09, 0xf1, 0xf4, 0xe8, 0xe8, 0xef, 0xff, 0x2f,
+			0x00, 0x59, 0xee, 0x1e, 0x18, 0x18, 0x18, 0xc2, 0x8d, 0x00, 0xb8, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x56, 0xe8, 0x04, 0xd4,
+			0xff, 0xff, 0xf5, 0xc2, 0x2d, 0x00, 0xd4, 0x5e, 0x04, 0x11, 0x96, 0xd0, 0x00, 0xd4, 0x5c, 0x00, 0x00, 0x36, 0xfa, 0x00,
+			0xd4, 0x5c, 0x00, 0x0c, 0x91, 0xc1, 0x00, 0xd4, 0xff, 0xff, 0xff, 0xed, 0x3a, 0x00, 0xd4, 0x5c, 0x00, 0x07, 0x53, 0xf0,
+			0x1b, 0xd4, 0x5c, 0x00, 0x00, 0x00, 0xe7, 0x58, 0xd4, 0x5e, 0x04, 0x0b, 0x57, 0xfc, 0x2f, 0xd4, 0xff, 0xff, 0xf9, 0xd6,
+			0x60, 0x00, 0x00, 0x00, 0x53, 0xc8, 0xf6, 0xeb, 0xb5, 0x39, 0x00, 0x66, 0xf2, 0x66, 0x1b, 0x10, 0x54, 0x98, 0x09, 0xef,
+			0x66, 0x00, 0x00, 0x00, 0x00, 0x01, 0x3c, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xf4, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x3c, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xef, 0x65, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x67,
+			0xf1, 0x64, 0x19, 0x10, 0x53, 0x97, 0x00, 0x00, 0x54, 0xc9, 0xf6, 0xeb, 0xb4, 0x39, 0xd4, 0xff, 0xfe, 0xf1, 0xc8, 0x6e,
+			0x03, 0x00, 0xd4, 0x5e, 0x04, 0x1d, 0x56, 0xe0, 0xaa, 0x00, 0xd4, 0x5c, 0x00, 0x00, 0x00, 0x32, 0xfd, 0x35, 0xd4, 0x5c,
+			0x00, 0x00, 0x00, 0x00, 0xdb, 0x72, 0xd4, 0x5c, 0x00, 0x00, 0x00, 0x00, 0xc1, 0x83, 0xd4, 0x5c, 0x00, 0x00, 0x00, 0x00,
+			0xdb, 0x71, 0xd4, 0x5c, 0x00, 0x00, 0x00, 0x30, 0xfd, 0x34, 0xd4, 0x5e, 0x04, 0x1b, 0x54, 0xde, 0xaa, 0x00, 0xd4, 0xff,
+			0xff, 0xf2, 0xca, 0x6f, 0x04, 0x00, 0xd4, 0xff, 0xff, 0xff, 0xff, 0xb4, 0xd4, 0x61, 0x08, 0x08, 0x08, 0x05, 0xd4, 0x5c,
+			0x00, 0x00, 0x00, 0x00, 0xd4, 0x5c, 0x00, 0x00, 0x00, 0x00, 0xd4, 0xf3, 0xec, 0xec, 0xec, 0x7d, 0xd4, 0x6d, 0x1c, 0x1c,
+			0x1c, 0x0e, 0xd4, 0x5c, 0x00, 0x00, 0x00, 0x00, 0xd4, 0x61, 0x08, 0x08, 0x08, 0x06, 0xd4, 0xff, 0xff, 0xff, 0xff, 0xd0,
+			0xd4, 0xff, 0xff, 0xff, 0xff, 0x34, 0xd4, 0x61, 0x08, 0x08, 0x08, 0x01, 0xd4, 0x5c, 0x00, 0x00, 0x00, 0x00, 0xd4, 0x5c,
+			0x00, 0x00, 0x00, 0x00, 0xd4, 0xf3, 0xec, 0xec, 0xc3, 0x00, 0xd4, 0x6d, 0x1c, 0x1c, 0x17, 0x00, 0xd4, 0x5c, 0x00, 0x00,
+			0x00, 0x00, 0xd4, 0x5c, 0x00, 0x00, 0x00, 0x00, 0xd4, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0xc5, 0xf5, 0xef,
+			0xc8, 0x64, 0x03, 0x00, 0x67, 0xf1, 0x68, 0x1e, 0x0c, 0x3d, 0xac, 0x17, 0x09, 0xef, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x3c, 0xff, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xf4, 0x00, 0x00, 0x00, 0xb8, 0xe8, 0xe8, 0x48, 0x3d,
+			0xff, 0x0d, 0x00, 0x00, 0x13, 0x18, 0xdf, 0x50, 0x09, 0xf0, 0x62, 0x00, 0x00, 0x00, 0x00, 0xdc, 0x50, 0x00, 0x6a, 0xf0,
+			0x66, 0x1d, 0x0d, 0x3a, 0xeb, 0x4f, 0x00, 0x00, 0x54, 0xc7, 0xf6, 0xf7, 0xcc, 0x61, 0x04, 0xd4, 0x5c, 0x00, 0x00, 0x00,
+			0x58, 0xd8, 0xd4, 0x5c, 0x00, 0x00, 0x00, 0x58, 0xd8, 0xd4, 0x5c, 0x00, 0x00, 0x00, 0x58, 0xd8, 0xd4, 0x5c, 0x00, 0x00,
+			0x00, 0x58, 0xd8, 0xd4, 0xf3, 0xec, 0xec, 0xec, 0xf2, 0xd8, 0xd4, 0x6d, 0x1c, 0x1c, 0x1c, 0x6a, 0xd8, 0xd4, 0x5c, 0x00,
+			0x00, 0x00, 0x58, 0xd8, 0xd4, 0x5c, 0x00, 0x00, 0x00, 0x58, 0xd8, 0xd4, 0x5c, 0x00, 0x00, 0x00, 0x58, 0xd8, 0xd4, 0x5c,
+			0xd4, 0x5c, 0xd4, 0x5c, 0xd4, 0x5c, 0xd4, 0x5c, 0xd4, 0x5c, 0xd4, 0x5c, 0xd4, 0x5c, 0xd4, 0x5c, 0x00, 0x00, 0xd4, 0x5c,
+			0x00, 0x00, 0xd4, 0x5c, 0x00, 0x00, 0xd4, 0x5c, 0x00, 0x00, 0xd4, 0x5c, 0x00, 0x00, 0xd4, 0x5c, 0x00, 0x00, 0xd4, 0x5c,
+			0x00, 0x00, 0xd4, 0x5c, 0x00, 0x00, 0xd4, 0x5c, 0x00, 0x00, 0xd4, 0x5b, 0x00, 0x00, 0xe3, 0x48, 0x06, 0x4b, 0xf9, 0x19,
+			0x9f, 0xe3, 0x65, 0x00, 0xd4, 0x5c, 0x00, 0x00, 0x46, 0xf0, 0x51, 0x00, 0xd4, 0x5c, 0x00, 0x4c, 0xf0, 0x4b, 0x00, 0x00,
+			0xd4, 0x5c, 0x52, 0xef, 0x44, 0x00, 0x00, 0x00, 0xd4, 0xaf, 0xef, 0x3e, 0x00, 0x00, 0x00, 0x00, 0xd4, 0xf2, 0xc4, 0x07,
+			0x00, 0x00, 0x00, 0x00, 0xd4, 0x69, 0xc8, 0xb4, 0x05, 0x00, 0x00, 0x00, 0xd4, 0x5c, 0x10, 0xcd, 0xad, 0x04, 0x00, 0x00,
+			0xd4, 0x5c, 0x00, 0x13, 0xd2, 0xa7, 0x03, 0x00, 0xd4, 0x5c, 0x00, 0x00, 0x16, 0xd6, 0xa1, 0x02, 0xd4, 0x5c, 0x00, 0x00,
+			0x00, 0x00, 0xd4, 0x5c, 0x00, 0x00, 0x00, 0x00, 0xd4, 0x5c, 0x00, 0x00, 0x00, 0x00, 0xd4, 0x5c, 0x00, 0x00, 0x00, 0x00,
+			0xd4, 0x5c, 0x00, 0x00, 0x00, 0x00, 0xd4, 0x5c, 0x00, 0x00, 0x00, 0x00, 0xd4, 0x5c, 0x00, 0x00, 0x00, 0x00, 0xd4, 0x61,
+			0x08, 0x08, 0x08, 0x05, 0xd4, 0xff, 0xff, 0xff, 0xff, 0xa0, 0xd4, 0xfe, 0x1f, 0x00, 0x00, 0x00, 0xc4, 0xff, 0x30, 0xd4,
+			0xd9, 0x7b, 0x00, 0x00, 0x22, 0xdf, 0xf9, 0x30, 0xd4, 0x7d, 0xd8, 0x00, 0x00, 0x80, 0x83, 0xf8, 0x30, 0xd4, 0x54, 0xcc,
+			0x36, 0x00, 0xdc, 0x26, 0xf8, 0x30, 0xd4, 0x54, 0x6e, 0x93, 0x3c, 0xc7, 0x00, 0xf8, 0x30, 0xd4, 0x54, 0x15, 0xe7, 0x9f,
+			0x69, 0x00, 0xf8, 0x30, 0xd4, 0x54, 0x00, 0xb4, 0xf7, 0x12, 0x00, 0xf8, 0x30, 0xd4, 0x54, 0x00, 0x20, 0x37, 0x00, 0x00,
+			0xf8, 0x30, 0xd4, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x30, 0xd4, 0xf2, 0x13, 0x00, 0x00, 0x58, 0xcc, 0xd4, 0xed,
+			0x8a, 0x00, 0x00, 0x58, 0xcc, 0xd4, 0x7c, 0xf2, 0x18, 0x00, 0x58, 0xcc, 0xd4, 0x54, 0xa1, 0x92, 0x00, 0x58, 0xcc, 0xd4,
+			0x54, 0x22, 0xf3, 0x1d, 0x58, 0xcc, 0xd4, 0x54, 0x00, 0x99, 0x9b, 0x58, 0xcc, 0xd4, 0x54, 0x00, 0x1d, 0xf4, 0x7b, 0xcc,
+			0xd4, 0x54, 0x00, 0x00, 0x92, 0xed, 0xcc, 0xd4, 0x54, 0x00, 0x00, 0x18, 0xf5, 0xcc, 0x00, 0x00, 0x59, 0xd0, 0xf8, 0xe9,
+			0x9a, 0x12, 0x00, 0x00, 0x67, 0xef, 0x58, 0x0f, 0x29, 0xb7, 0xce, 0x07, 0x08, 0xee, 0x62, 0x00, 0x00, 0x00, 0x0a, 0xe7,
+			0x66, 0x3c, 0xff, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x99, 0xab, 0x50, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xbf, 0x3c,
+			0xff, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x99, 0xab, 0x09, 0xef, 0x62, 0x00, 0x00, 0x00, 0x0a, 0xe7, 0x68, 0x00, 0x6a, 0xef,
+			0x57, 0x0f, 0x28, 0xb7, 0xd1, 0x08, 0x00, 0x00, 0x5b, 0xd1, 0xf9, 0xeb, 0x9c, 0x13, 0x00, 0xd4, 0xff, 0xff, 0xeb, 0xa6,
+			0x13, 0xd4, 0x5e, 0x04, 0x25, 0xce, 0x99, 0xd4, 0x5c, 0x00, 0x00, 0x77, 0xc8, 0xd4, 0x5c, 0x00, 0x0c, 0xbf, 0xa2, 0xd4,
+			0xf0, 0xe8, 0xf8, 0xbf, 0x1b, 0xd4, 0x6b, 0x17, 0x06, 0x00, 0x00, 0xd4, 0x5c, 0x00, 0x00, 0x00, 0x00, 0xd4, 0x5c, 0x00,
+			0x00, 0x00, 0x00, 0xd4, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xd0, 0xf8, 0xe9, 0x99, 0x11, 0x00, 0x00, 0x67,
+			0xef, 0x58, 0x0f, 0x29, 0xb7, 0xcc, 0x06, 0x08, 0xee, 0x62, 0x00, 0x00, 0x00, 0x0a, 0xe7, 0x63, 0x3c, 0xff, 0x0d, 0x00,
+			0x00, 0x00, 0x00, 0x99, 0xa9, 0x50, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xbe, 0x3c, 0xff, 0x0d, 0x00, 0x00, 0x00,
+			0x00, 0x99, 0xa9, 0x09, 0xef, 0x62, 0x00, 0x00, 0x00, 0x0a, 0xe7, 0x6a, 0x00, 0x6a, 0xef, 0x57, 0x0f, 0x28, 0xb7, 0xd9,
+			0x0d, 0x00, 0x00, 0x5b, 0xd1, 0xfa, 0xff, 0xc4, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0xe7, 0x22, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x5c, 0x00, 0xd4, 0xff, 0xff, 0xeb, 0xa7, 0x12, 0x00, 0xd4, 0x5e, 0x04, 0x21, 0xc8,
+			0x98, 0x00, 0xd4, 0x5c, 0x00, 0x00, 0x77, 0xc9, 0x00, 0xd4, 0x5c, 0x00, 0x1c, 0xc7, 0xa5, 0x00, 0xd4, 0xff, 0xff, 0xff,
+			0xc9, 0x18, 0x00, 0xd4, 0x5c, 0x01, 0x37, 0xe3, 0x31, 0x00, 0xd4, 0x5c, 0x00, 0x00, 0x71, 0xc3, 0x00, 0xd4, 0x5c, 0x00,
+			0x00, 0x0b, 0xed, 0x43, 0xd4, 0x5c, 0x00, 0x00, 0x00, 0x83, 0xc1, 0x00, 0x38, 0xc2, 0xf3, 0xef, 0xc5, 0x3f, 0x08, 0xec,
+			0x78, 0x0e, 0x12, 0x4a, 0x3b, 0x28, 0xff, 0x08, 0x00, 0x00, 0x00, 0x00, 0x08, 0xe4, 0xa8, 0x47, 0x11, 0x00, 0x00, 0x00,
+			0x1f, 0x95, 0xdb, 0xfb, 0xb6, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x1a, 0xb9, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xe7,
+			0x21, 0x80, 0x28, 0x08, 0x24, 0xbd, 0xb0, 0x13, 0xa0, 0xe0, 0xf9, 0xe7, 0xa2, 0x16, 0x08, 0xff, 0xff, 0xff, 0xff, 0xff,
+			0xff, 0xff, 0x5c, 0x00, 0x08, 0x08, 0x08, 0xec, 0x49, 0x08, 0x08, 0x02, 0x00, 0x00, 0x00, 0x00, 0xec, 0x44, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0xec, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xec, 0x44, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0xec, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xec, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0xec, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xec, 0x44, 0x00, 0x00, 0x00, 0xf4, 0x3c, 0x00, 0x00, 0x00,
+			0x74, 0xbc, 0xf4, 0x3c, 0x00, 0x00, 0x00, 0x74, 0xbc, 0xf4, 0x3c, 0x00, 0x00, 0x00, 0x74, 0xbc, 0xf4, 0x3c, 0x00, 0x00,
+			0x00, 0x74, 0xbc, 0xf4, 0x3c, 0x00, 0x00, 0x00, 0x74, 0xbc, 0xef, 0x41, 0x00, 0x00, 0x00, 0x79, 0xb7, 0xd1, 0x62, 0x00,
+			0x00, 0x00, 0x9c, 0x98, 0x79, 0xd6, 0x2e, 0x0a, 0x47, 0xf3, 0x41, 0x05, 0x81, 0xde, 0xf6, 0xd3, 0x5d, 0x00, 0xb9, 0x82,
+			0x00, 0x00, 0x00, 0x00, 0x4f, 0xe8, 0x04, 0x59, 0xdf, 0x01, 0x00, 0x00, 0x00, 0xac, 0x8d, 0x00, 0x09, 0xf1, 0x3e, 0x00,
+			0x00, 0x11, 0xf8, 0x2f, 0x00, 0x00, 0x9b, 0x9c, 0x00, 0x00, 0x67, 0xd0, 0x00, 0x00, 0x00, 0x3c, 0xf1, 0x09, 0x00, 0xc5,
+			0x71, 0x00, 0x00, 0x00, 0x00, 0xdc, 0x58, 0x22, 0xfa, 0x17, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xb6, 0x7f, 0xb4, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x20, 0xfa, 0xe4, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xef, 0x07, 0x00, 0x00, 0x00, 0x79,
+			0xb6, 0x00, 0x00, 0x00, 0xdb, 0xb6, 0x00, 0x00, 0x00, 0xdb, 0x58, 0x3b, 0xf1, 0x03, 0x00, 0x18, 0xe0, 0xe8, 0x03, 0x00,
+			0x18, 0xff, 0x1a, 0x06, 0xf6, 0x33, 0x00, 0x56, 0x9f, 0xc1, 0x33, 0x00, 0x56, 0xdc, 0x00, 0x00, 0xbf, 0x71, 0x00, 0x94,
+			0x62, 0x85, 0x71, 0x00, 0x94, 0x9e, 0x00, 0x00, 0x80, 0xaf, 0x00, 0xd1, 0x25, 0x48, 0xaf, 0x00, 0xd1, 0x5f, 0x00, 0x00,
+			0x42, 0xeb, 0x11, 0xe6, 0x00, 0x0e, 0xe9, 0x11, 0xfd, 0x21, 0x00, 0x00, 0x09, 0xfa, 0x77, 0xab, 0x00, 0x00, 0xcf, 0x77,
+			0xe3, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xe9, 0x6e, 0x00, 0x00, 0x93, 0xe9, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x87, 0xff, 0x32,
+			0x00, 0x00, 0x56, 0xff, 0x67, 0x00, 0x00, 0x0c, 0xe0, 0x5a, 0x00, 0x00, 0x0d, 0xe2, 0x54, 0x00, 0x46, 0xeb, 0x15, 0x00,
+			0x97, 0xae, 0x00, 0x00, 0x00, 0xa0, 0xa7, 0x40, 0xed, 0x19, 0x00, 0x00, 0x00, 0x11, 0xe7, 0xec, 0x61, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0xbc, 0xf6, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x5c, 0xdc, 0xb2, 0x98, 0x00, 0x00, 0x00, 0x16, 0xeb, 0x41, 0x19,
+			0xee, 0x3e, 0x00, 0x00, 0xaa, 0x9b, 0x00, 0x00, 0x64, 0xd9, 0x07, 0x50, 0xe6, 0x10, 0x00, 0x00, 0x00, 0xbd, 0x85, 0x00,
+			0xb4, 0x93, 0x00, 0x00, 0x00, 0x40, 0xed, 0x19, 0x00, 0x1b, 0xee, 0x3c, 0x00, 0x09, 0xdc, 0x60, 0x00, 0x00, 0x00, 0x62,
+			0xd9, 0x08, 0x8c, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb9, 0xb0, 0xef, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0xf9,
+			0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xec, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xec, 0x44, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xec, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xec, 0x44, 0x00, 0x00, 0x00,
+			0x54, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8b, 0x02, 0x08, 0x08, 0x08, 0x08, 0x54, 0xf1, 0x28, 0x00, 0x00, 0x00, 0x00,
+			0x24, 0xee, 0x52, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xd2, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xbb, 0x03, 0x00, 0x00,
+			0x00, 0x00, 0x70, 0xe1, 0x13, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xf3, 0x33, 0x00, 0x00, 0x00, 0x00, 0x1a, 0xe8, 0x6a, 0x08,
+			0x08, 0x08, 0x08, 0x05, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0xf8, 0xe3, 0x73, 0xf8, 0x1c, 0x00, 0xf8, 0x1c,
+			0x00, 0xf8, 0x1c, 0x00, 0xf8, 0x1c, 0x00, 0xf8, 0x1c, 0x00, 0xf8, 0x1c, 0x00, 0xf8, 0x1c, 0x00, 0xf8, 0x1c, 0x00, 0xf8,
+			0x1c, 0x00, 0xe4, 0xda, 0x6f, 0xdb, 0x25, 0x00, 0x00, 0x00, 0x91, 0x6f, 0x00, 0x00, 0x00, 0x47, 0xb9, 0x00, 0x00, 0x00,
+			0x07, 0xed, 0x0b, 0x00, 0x00, 0x00, 0xb2, 0x4e, 0x00, 0x00, 0x00, 0x68, 0x98, 0x00, 0x00, 0x00, 0x1d, 0xe1, 0x00, 0x00,
+			0x00, 0x00, 0xd3, 0x2c, 0x00, 0x00, 0x00, 0x89, 0x77, 0x00, 0x00, 0x00, 0x3f, 0xc1, 0x00, 0x00, 0x00, 0x04, 0x7a, 0x00,
+			0xb9, 0xee, 0xa8, 0x00, 0x70, 0xa8, 0x00, 0x70, 0xa8, 0x00, 0x70, 0xa8, 0x00, 0x70, 0xa8, 0x00, 0x70, 0xa8, 0x00, 0x70,
+			0xa8, 0x00, 0x70, 0xa8, 0x00, 0x70, 0xa8, 0x00, 0x70, 0xa8, 0xb2, 0xe0, 0x9a, 0x00, 0x00, 0x00, 0x63, 0x6a, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x75, 0xe4, 0xdd, 0x83, 0x00, 0x00, 0x00, 0x5f, 0xde, 0x22, 0x1a, 0xd7, 0x6b, 0x00, 0x4b, 0xd6, 0x1d,
+			0x00, 0x00, 0x16, 0xcf, 0x55, 0x1c, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0x1c, 0x67, 0x28, 0x00, 0x40, 0xc8, 0x03, 0x00,
+			0x7a, 0x77, 0x00, 0x82, 0xe1, 0xf3, 0xcf, 0x3f, 0x00, 0x00, 0x59, 0x17, 0x03, 0x65, 0xe9, 0x09, 0x00, 0x00, 0x00, 0x00,
+			0x00, 0xe0, 0x2f, 0x00, 0x5e, 0xcb, 0xe3, 0xe0, 0xfa, 0x43, 0x25, 0xef, 0x2d, 0x00, 0x00, 0xde, 0x44, 0x33, 0xe5, 0x08,
+			0x00, 0x4d, 0xff, 0x44, 0x00, 0x8c, 0xd7, 0xb7, 0x87, 0xd3, 0x44, 0xe8, 0x2c, 0x00, 0x00, 0x00, 0x00, 0xe8, 0x2c, 0x00,
+			0x00, 0x00, 0x00, 0xe8, 0x2c, 0x00, 0x00, 0x00, 0x00, 0xe8, 0x6f, 0xdb, 0xed, 0x98, 0x06, 0xe8, 0xc6, 0x14, 0x13, 0xc9,
+			0x7c, 0xe8, 0x50, 0x00, 0x00, 0x4e, 0xd5, 0xe8, 0x33, 0x00, 0x00, 0x2f, 0xef, 0xe8, 0x50, 0x00, 0x00, 0x4d, 0xd5, 0xe8,
+			0xc4, 0x13, 0x12, 0xc7, 0x7e, 0xe8, 0x6f, 0xdb, 0xed, 0x9a, 0x07, 0x00, 0x1a, 0xa9, 0xe9, 0xed, 0x9e, 0x02, 0xcb, 0x96,
+			0x0d, 0x07, 0x3d, 0x31, 0xf0, 0x07, 0x00, 0x00, 0x00, 0x4e, 0xd4, 0x00, 0x00, 0x00, 0x00, 0x31, 0xf0, 0x06, 0x00, 0x00,
+			0x00, 0x01, 0xcb, 0x93, 0x0c, 0x07, 0x3d, 0x00, 0x1b, 0xad, 0xec, 0xed, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x88,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x88, 0x00, 0x2a, 0xc9, 0xf1, 0xb4, 0x9c,
+			0x88, 0x03, 0xd9, 0x78, 0x03, 0x46, 0xf8, 0x88, 0x36, 0xec, 0x03, 0x00, 0x00, 0xb5, 0x88, 0x50, 0xce, 0x00, 0x00, 0x00,
+			0x93, 0x88, 0x36, 0xe4, 0x00, 0x00, 0x00, 0xaa, 0x88, 0x03, 0xdb, 0x52, 0x00, 0x25, 0xf5, 0x88, 0x00, 0x2c, 0xc7, 0xc4,
+			0xab, 0xa0, 0x88, 0x00, 0x17, 0xaa, 0xea, 0xe0, 0x71, 0x00, 0x01, 0xc6, 0x8c, 0x08, 0x1f, 0xd9, 0x4b, 0x2f, 0xf1, 0x03,
+			0x00, 0x00, 0x6d, 0xa0, 0x4e, 0xf8, 0xd8, 0xd8, 0xd8, 0xde, 0xae, 0x31, 0xe8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0xc7,
+			0x8a, 0x0c, 0x03, 0x2a, 0x36, 0x00, 0x17, 0xa4, 0xe8, 0xef, 0xc8, 0x46, 0x00, 0x20, 0xcb, 0xef, 0x6c, 0x00, 0x8e, 0x8d,
+			0x00, 0x00, 0x00, 0xac, 0x64, 0x00, 0x00, 0xa1, 0xf6, 0xec, 0xe0, 0x26, 0x00, 0xb0, 0x64, 0x00, 0x00, 0x00, 0xb0, 0x64,
+			0x00, 0x00, 0x00, 0xb0, 0x64, 0x00, 0x00, 0x00, 0xb0, 0x64, 0x00, 0x00, 0x00, 0xb0, 0x64, 0x00, 0x00, 0x00, 0xb0, 0x64,
+			0x00, 0x00, 0x00, 0x2c, 0xca, 0xf1, 0xb4, 0x9c, 0x88, 0x03, 0xdb, 0x73, 0x03, 0x40, 0xf6, 0x88, 0x36, 0xe9, 0x02, 0x00,
+			0x00, 0xb0, 0x88, 0x50, 0xcf, 0x00, 0x00, 0x00, 0x93, 0x88, 0x37, 0xe9, 0x02, 0x00, 0x00, 0xb0, 0x88, 0x04, 0xdc, 0x73,
+			0x03, 0x40, 0xf6, 0x88, 0x00, 0x2f, 0xcb, 0xf2, 0xb4, 0xa0, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb2, 0x65, 0x00, 0x3c,
+			0x16, 0x01, 0x49, 0xf4, 0x1c, 0x00, 0x64, 0xe8, 0xef, 0xd4, 0x4e, 0x00, 0xe8, 0x2c, 0x00, 0x00, 0x00, 0x00, 0xe8, 0x2c,
+			0x00, 0x00, 0x00, 0x00, 0xe8, 0x2c, 0x00, 0x00, 0x00, 0x00, 0xe8, 0x66, 0xd7, 0xf1, 0xa0, 0x04, 0xe8, 0xbe, 0x18, 0x16,
+			0xd8, 0x5a, 0xe8, 0x46, 0x00, 0x00, 0x87, 0x8c, 0xe8, 0x2c, 0x00, 0x00, 0x7c, 0x98, 0xe8, 0x2c, 0x00, 0x00, 0x7c, 0x98,
+			0xe8, 0x2c, 0x00, 0x00, 0x7c, 0x98, 0xe8, 0x2c, 0x00, 0x00, 0x7c, 0x98, 0xe0, 0x34, 0x5e, 0x15, 0x00, 0x00, 0xe0, 0x34,
+			0xe0, 0x34, 0xe0, 0x34, 0xe0, 0x34, 0xe0, 0x34, 0xe0, 0x34, 0xe0, 0x34, 0x00, 0x00, 0xe0, 0x34, 0x00, 0x00, 0x5e, 0x15,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x34, 0x00, 0x00, 0xe0, 0x34, 0x00, 0x00, 0xe0, 0x34, 0x00, 0x00, 0xe0, 0x34,
+			0x00, 0x00, 0xe0, 0x34, 0x00, 0x00, 0xe0, 0x34, 0x00, 0x00, 0xe0, 0x34, 0x00, 0x00, 0xe2, 0x2f, 0x00, 0x15, 0xf5, 0x12,
+			0x35, 0xef, 0x80, 0x00, 0xe8, 0x2c, 0x00, 0x00, 0x00, 0x00, 0xe8, 0x2c, 0x00, 0x00, 0x00, 0x00, 0xe8, 0x2c, 0x00, 0x00,
+			0x00, 0x00, 0xe8, 0x2c, 0x00, 0x37, 0xe3, 0x46, 0xe8, 0x2c, 0x42, 0xe4, 0x3b, 0x00, 0xe8, 0x7a, 0xe2, 0x31, 0x00, 0x00,
+			0xe8, 0xe9, 0x93, 0x00, 0x00, 0x00, 0xe8, 0x42, 0xd6, 0x79, 0x00, 0x00, 0xe8, 0x2c, 0x19, 0xda, 0x73, 0x00, 0xe8, 0x2c,
+			0x00, 0x1c, 0xdc, 0x6f, 0xe0, 0x34, 0xe0, 0x34, 0xe0, 0x34, 0xe0, 0x34, 0xe0, 0x34, 0xe0, 0x34, 0xe0, 0x34, 0xe0, 0x34,
+			0xe0, 0x34, 0xe0, 0x34, 0xe8, 0x6a, 0xda, 0xf4, 0x8d, 0x1d, 0xc1, 0xf4, 0xb3, 0x0b, 0xe8, 0xbc, 0x14, 0x22, 0xef, 0xc6,
+			0x2e, 0x0c, 0xc5, 0x6f, 0xe8, 0x44, 0x00, 0x00, 0xb2, 0x84, 0x00, 0x00, 0x72, 0xa0, 0xe8, 0x2c, 0x00, 0x00, 0xa8, 0x6c,
+			0x00, 0x00, 0x68, 0xac, 0xe8, 0x2c, 0x00, 0x00, 0xa8, 0x6c, 0x00, 0x00, 0x68, 0xac, 0xe8, 0x2c, 0x00, 0x00, 0xa8, 0x6c,
+			0x00, 0x00, 0x68, 0xac, 0xe8, 0x2c, 0x00, 0x00, 0xa8, 0x6c, 0x00, 0x00, 0x68, 0xac, 0xe8, 0x77, 0xca, 0xdb, 0xa0, 0x04,
+			0xe8, 0xad, 0x05, 0x05, 0xc9, 0x5a, 0xe8, 0x3f, 0x00, 0x00, 0x85, 0x8c, 0xe8, 0x2c, 0x00, 0x00, 0x7c, 0x98, 0xe8, 0x2c,
+			0x00, 0x00, 0x7c, 0x98, 0xe8, 0x2c, 0x00, 0x00, 0x7c, 0x98, 0xe8, 0x2c, 0x00, 0x00, 0x7c, 0x98, 0x00, 0x24, 0xbb, 0xef,
+			0xd7, 0x56, 0x00, 0x03, 0xd6, 0x82, 0x06, 0x3d, 0xf3, 0x31, 0x35, 0xee, 0x04, 0x00, 0x00, 0x9c, 0x8c, 0x4f, 0xd3, 0x00,
+			0x00, 0x00, 0x7c, 0xa7, 0x35, 0xee, 0x04, 0x00, 0x00, 0x9c, 0x8c, 0x03, 0xd7, 0x7f, 0x05, 0x3b, 0xf2, 0x32, 0x00, 0x26,
+			0xbd, 0xf0, 0xd8, 0x59, 0x00, 0xe8, 0x7d, 0xc7, 0xd5, 0x98, 0x06, 0xe8, 0xb6, 0x04, 0x04, 0xb5, 0x7c, 0xe8, 0x49, 0x00,
+			0x00, 0x47, 0xd5, 0xe8, 0x32, 0x00, 0x00, 0x2f, 0xef, 0xe8, 0x53, 0x00, 0x00, 0x51, 0xd5, 0xe8, 0xc7, 0x15, 0x13, 0xcb,
+			0x7e, 0xe8, 0x6f, 0xdb, 0xed, 0x9a, 0x07, 0xe8, 0x2c, 0x00, 0x00, 0x00, 0x00, 0xe8, 0x2c, 0x00, 0x00, 0x00, 0x00, 0xe8,
+			0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xc9, 0xf1, 0xb4, 0x9c, 0x88, 0x03, 0xd9, 0x75, 0x03, 0x45, 0xf8, 0x88, 0x36,
+			0xea, 0x02, 0x00, 0x00, 0xb2, 0x88, 0x50, 0xcf, 0x00, 0x00, 0x00, 0x93, 0x88, 0x36, 0xe9, 0x02, 0x00, 0x00, 0xb1, 0x88,
+			0x03, 0xdb, 0x73, 0x03, 0x42, 0xf7, 0x88, 0x00, 0x2c, 0xca, 0xf2, 0xb5, 0x9c, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c,
+			0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x88, 0x00, 0x00, 0x00, 0x04, 0xe8,
+			0x77, 0xce, 0xd7, 0xe8, 0xb5, 0x07, 0x01, 0xe8, 0x46, 0x00, 0x00, 0xe8, 0x2d, 0x00, 0x00, 0xe8, 0x2c, 0x00, 0x00, 0xe8,
+			0x2c, 0x00, 0x00, 0xe8, 0x2c, 0x00, 0x00, 0x00, 0x80, 0xe7, 0xf0, 0xd9, 0x36, 0x33, 0xe0, 0x15, 0x00, 0x21, 0x1c, 0x2f,
+			0xea, 0x44, 0x06, 0x00, 0x00, 0x00, 0x62, 0xcb, 0xf1, 0xa4, 0x15, 0x00, 0x00, 0x00, 0x14, 0xb3, 0x91, 0x2b, 0x3a, 0x04,
+			0x06, 0xa7, 0x8c, 0x37, 0xcf, 0xf2, 0xeb, 0xab, 0x11, 0x00, 0xe4, 0x34, 0x00, 0x00, 0x00, 0xe4, 0x34, 0x00, 0x00, 0x96,
+			0xfc, 0xe6, 0xe0, 0x5e, 0x00, 0xe4, 0x34, 0x00, 0x00, 0x00, 0xe4, 0x34, 0x00, 0x00, 0x00, 0xe4, 0x34, 0x00, 0x00, 0x00,
+			0xe2, 0x34, 0x00, 0x00, 0x00, 0xcc, 0x58, 0x00, 0x00, 0x00, 0x52, 0xe3, 0xef, 0x65, 0xfc, 0x18, 0x00, 0x00, 0x90, 0x84,
+			0xfc, 0x18, 0x00, 0x00, 0x90, 0x84, 0xfc, 0x18, 0x00, 0x00, 0x90, 0x84, 0xfc, 0x18, 0x00, 0x00, 0x90, 0x84, 0xf1, 0x1f,
+			0x00, 0x00, 0xa3, 0x84, 0xc1, 0x66, 0x00, 0x23, 0xf0, 0x84, 0x31, 0xcf, 0xca, 0xac, 0xa5, 0x84, 0x78, 0xac, 0x00, 0x00,
+			0x00, 0x91, 0x92, 0x1f, 0xf6, 0x0e, 0x00, 0x03, 0xe7, 0x38, 0x00, 0xc4, 0x5e, 0x00, 0x45, 0xdd, 0x00, 0x00, 0x6a, 0xb7,
+			0x00, 0x9f, 0x83, 0x00, 0x00, 0x15, 0xf7, 0x1c, 0xf0, 0x29, 0x00, 0x00, 0x00, 0xb7, 0xbb, 0xcf, 0x00, 0x00, 0x00, 0x00,
+			0x5d, 0xff, 0x75, 0x00, 0x00, 0x61, 0xb3, 0x00, 0x00, 0xdc, 0xaa, 0x00, 0x00, 0xe3, 0x30, 0x22, 0xf0, 0x02, 0x19, 0xe1,
+			0xe5, 0x00, 0x22, 0xef, 0x02, 0x00, 0xe3, 0x32, 0x58, 0x9a, 0xca, 0x28, 0x61, 0xb2, 0x00, 0x00, 0xa4, 0x72, 0x96, 0x5b,
+			0x8a, 0x67, 0xa0, 0x73, 0x00, 0x00, 0x65, 0xb2, 0xd3, 0x1c, 0x4b, 0xa6, 0xdf, 0x34, 0x00, 0x00, 0x26, 0xf3, 0xdc, 0x00,
+			0x0e, 0xee, 0xf2, 0x03, 0x00, 0x00, 0x00, 0xe7, 0x9f, 0x00, 0x00, 0xcc, 0xb7, 0x00, 0x00, 0x23, 0xee, 0x32, 0x00, 0x1a,
+			0xec, 0x40, 0x00, 0x65, 0xd7, 0x0a, 0xb9, 0x8c, 0x00, 0x00, 0x00, 0xb2, 0xd3, 0xd2, 0x07, 0x00, 0x00, 0x00, 0x4d, 0xff,
+			0x65, 0x00, 0x00, 0x00, 0x0c, 0xdd, 0x9c, 0xe5, 0x12, 0x00, 0x00, 0x9d, 0xaa, 0x00, 0x9a, 0xaa, 0x00, 0x4f, 0xe5, 0x12,
+			0x00, 0x0c, 0xdc, 0x5b, 0x75, 0xad, 0x00, 0x00, 0x00, 0x93, 0x90, 0x19, 0xf5, 0x10, 0x00, 0x04, 0xea, 0x33, 0x00, 0xb7,
+			0x65, 0x00, 0x4c, 0xd6, 0x00, 0x00, 0x58, 0xc1, 0x00, 0xa8, 0x79, 0x00, 0x00, 0x08, 0xef, 0x2c, 0xf4, 0x1e, 0x00, 0x00,
+			0x00, 0x9b, 0xd2, 0xbe, 0x00, 0x00, 0x00, 0x00, 0x3c, 0xff, 0x61, 0x00, 0x00, 0x00, 0x00, 0x1e, 0xf6, 0x0e, 0x00, 0x00,
+			0x00, 0x02, 0x90, 0x9e, 0x00, 0x00, 0x00, 0x0b, 0xf4, 0xd5, 0x1d, 0x00, 0x00, 0x00, 0x4f, 0xe8, 0xe8, 0xe8, 0xf3, 0xc8,
+			0x00, 0x00, 0x00, 0x0e, 0xd7, 0x68, 0x00, 0x00, 0x01, 0xb0, 0x9c, 0x00, 0x00, 0x00, 0x7f, 0xc9, 0x07, 0x00, 0x00, 0x4d,
+			0xe6, 0x1b, 0x00, 0x00, 0x27, 0xec, 0x3d, 0x00, 0x00, 0x00, 0x7c, 0xf9, 0xe4, 0xe4, 0xe4, 0xb2, 0x00, 0x00, 0x34, 0xd4,
+			0xdf, 0x1f, 0x00, 0x00, 0x99, 0x88, 0x00, 0x00, 0x00, 0x00, 0xab, 0x68, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x66, 0x00, 0x00,
+			0x00, 0x0f, 0xde, 0x48, 0x00, 0x00, 0x70, 0xfc, 0xb9, 0x01, 0x00, 0x00, 0x00, 0x17, 0xe7, 0x3a, 0x00, 0x00, 0x00, 0x00,
+			0xb3, 0x62, 0x00, 0x00, 0x00, 0x00, 0xac, 0x68, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x92, 0x99,
+			0x00, 0x00, 0x00, 0x00, 0x27, 0xbf, 0xdf, 0x1f, 0x78, 0x84, 0x78, 0x84, 0x78, 0x84, 0x78, 0x84, 0x78, 0x84, 0x78, 0x84,
+			0x78, 0x84, 0x78, 0x84, 0x78, 0x84, 0x78, 0x84, 0x78, 0x84, 0x78, 0x84, 0x3c, 0x42, 0x6f, 0xe2, 0xae, 0x04, 0x00, 0x00,
+			0x00, 0x04, 0xe0, 0x3c, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x4f, 0x00, 0x00, 0x00, 0x00, 0xc2, 0x52, 0x00, 0x00, 0x00, 0x00,
+			0xa6, 0x90, 0x01, 0x00, 0x00, 0x00, 0x2a, 0xee, 0xf0, 0x1f, 0x00, 0x00, 0x99, 0x9d, 0x02, 0x00, 0x00, 0x00, 0xbf, 0x56,
+			0x00, 0x00, 0x00, 0x00, 0xc4, 0x50, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x4d, 0x00, 0x00, 0x00, 0x0d, 0xe8, 0x34, 0x00, 0x00,
+			0x6f, 0xdc, 0x94, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0xa9, 0xdb, 0xa9, 0x43, 0x01,
+			0x22, 0x8c, 0xa1, 0x54, 0x23, 0x69, 0xd6, 0xf6, 0xdd, 0x4e, 0x08, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00,
+		};
+	}
+
+	const Glyph* GetGlyph(wchar_t character)
+	{
+		if (character < FirstCharacter)
+		{
+			return nullptr;
+		}
+
+		if (character > LastCharacter)
+		{
+			character = L'?';
+		}
+
+		return &g_glyphs[character - FirstCharacter];
+	}
+
+	const uint8_t* GetCoverage(const Glyph& glyph)
+	{
+		return g_coverage + glyph.Offset;
+	}
+
+	Size Measure(const std::wstring& str, size_t length, uint32_t fontSize)
+	{
+		return { static_cast<uint32_t>(std::ceil(MeasureWidth(str, length, fontSize))), GetLineHeight(fontSize) };
+	}
+
+	double MeasureWidth(const std::wstring& str, size_t length, uint32_t fontSize)
+	{
+		length = (std::min)(length, str.size());
+
+		uint64_t advance = 0;
+		for (size_t i = 0; i < length; ++i)
+		{
+			if (auto glyph = GetGlyph(str[i]))
+			{
+				advance += glyph->Advance;
+			}
+		}
+
+		return advance / 64.0 * (static_cast<double>(fontSize) / PixelSize);
+	}
+
+	uint32_t GetLineHeight(uint32_t fontSize)
+	{
+		return static_cast<uint32_t>(std::ceil(LineHeight * (static_cast<double>(fontSize) / PixelSize)));
+	}
+}
\ No newline at end of file
@@ -0,0 +1,39 @@
+/*
+* MIT License
+*
+* Copyright (c) 2024 Edgar Bernal (edgar.bernal@gmail.com)
+*/
+
+#ifndef BT_DEFAULT_FONT_HEADER
+#define BT_DEFAULT_FONT_HEADER
+
+#include <string>
+#include "Berta/Core/BasicTypes.h"
+
+namespace Berta::DefaultFont
+{
+	// Built-in font of the software backend: printable ASCII baked at PixelSize, 8 bit coverage per pixel.
+	constexpr uint32_t PixelSize = 12;
+	constexpr uint32_t Ascender = 12;
+	constexpr uint32_t LineHeight = 14;
+
+	struct Glyph
+	{
+		int8_t Left;		// Bearings from the pen position / baseline.
+		int8_t Top;
+		uint8_t Width;
+		uint8_t Height;
+		uint16_t Advance;	// 26.6 fixed point.
+		uint16_t Offset;	// Into the coverage table.
+	};
+
+	// Control characters have no glyph (nullptr), anything else outside printable ASCII maps to '?'.
+	const Glyph* GetGlyph(wchar_t character);
+	const uint8_t* GetCoverage(const Glyph& glyph);
+
+	Size Measure(const std::wstring& str, size_t length, uint32_t fontSize);
+	double MeasureWidth(const std::wstring& str, size_t length, uint32_t fontSize);	// Pixels, before rounding up.
+	uint32_t GetLineHeight(uint32_t fontSize);
+}
+
+#endif
\ No newline at end of file
@@ -21,8 +21,10 @@ namespace Berta
 	std::unordered_map< Window*, DrawBatcherContext> DrawBatch::g_contexts;
 
 	DrawBatch::DrawBatch(Window* rootWindow) :
+		m_contextKey(rootWindow->RootWindow),
 		m_context(g_contexts[rootWindow->RootWindow])
 	{
+		++m_context.m_batchCount;
 		////std::cout << ">> START.... \twindow = " << rootWindow->Name << std::endl;
 		if (m_context.m_rootWindow)
 			return;
@@ -34,7 +36,22 @@ namespace Berta
 	DrawBatch::~DrawBatch()
 	{
 		//std::cout << ">> END.... \twindow = " << m_context.m_rootWindow->Name << std::endl;
-		if (!m_context.m_rootWindow || m_context.m_rootWindow->Flags.IsDisposed)
+		--m_context.m_batchCount;
+		if (m_contextKey->Flags.IsDisposed)
+		{
+			// The form was destroyed during the batch: drop the pending work. If WindowManager::Remove
+			// couldn't erase the context because a batch was still using it, the last one does.
+			m_contextKey->Batcher = nullptr;
+			m_context.m_rootWindow = nullptr;
+			Clear();
+			if (m_context.m_batchCount == 0)
+			{
+				g_contexts.erase(m_contextKey);
+			}
+			return;
+		}
+
+		if (!m_context.m_rootWindow)
 			return;
 
 		auto& windowManager = Foundation::GetInstance().GetWindowManager();
@@ -51,9 +68,10 @@ namespace Berta
 			return;
 		}
 
+		m_context.m_batchItemIndices.clear();
 		for (auto& batchItem : m_context.m_batchItemRequests)
 		{
-			batchItem.Index = batchItem.Target->GetHierarchyIndex();
+			batchItem.Index = batchItem.Target->GetHierarchyIndex(); // Cached, only the first call after a structural change walks the tree.
 		}
 
 		BatchItemComparer comparer;
@@ -69,53 +87,93 @@ namespace Berta
 		std::cout << std::endl;
 #endif // BT_PRINT_DRAW_BATCH_MESSAGES
 
+		// Only the damaged part of each window is composed into the root graphics, and only the merged
+		// damage is presented, instead of whole windows (or the whole form when it is in the batch).
+		auto& damage = m_context.m_damage;
+		damage.Clear();
+		uint64_t pixelsComposed = 0;
+		uint32_t culledWindows = 0;
+
 		rootGraphics.Begin();
-		bool fullMap = !m_context.m_batchItemRequests.empty() && m_context.m_batchItemRequests[0].Target->Type == WindowType::Form;
 		for (auto& batchItem : m_context.m_batchItemRequests)
 		{
-			if (batchItem.Target->Flags.IsDisposed)
+			auto target = batchItem.Target;
+			if (target->Flags.IsDisposed)
 				continue;
 
-			if (HasFlag(batchItem.Operation, DrawOperation::NeedUpdate) && !batchItem.Target->Flags.isUpdating)
+			// Covered by opaque windows above it: neither rendered (stays dirty) nor composed.
+			if (windowManager.IsOccluded(target, batchItem.Area))
 			{
-				batchItem.Target->Flags.isUpdating = true;
-				batchItem.Target->Renderer.Update();
-				batchItem.Target->Flags.isUpdating = false;
+				++culledWindows;
+				target->DrawStatus = DrawWindowStatus::None;
+				continue;
 			}
 
-			if (HasFlag(batchItem.Operation, DrawOperation::NeedMap))
+			// Invalidated as a whole (resize, DPI change...) after a sub-rectangle was marked.
+			if (target->Renderer.HasFullDamage())
 			{
-				rootGraphics.BitBlt(batchItem.Area, batchItem.Target->Renderer.GetGraphics(), { 0,0 });
+				target->DamageArea = target->ClientSize.ToRectangle();
 			}
 
-			//if there are children, paste it too!
+			auto windowDamage = target->DamageArea;
+			if (HasFlag(batchItem.Operation, DrawOperation::NeedUpdate) && !target->Flags.isUpdating)
+			{
+				target->Flags.isUpdating = true;
+				target->Renderer.Update(windowDamage);
+				target->Flags.isUpdating = false;
+				target->DamageArea = {};
+			}
+			else
+			{
+				windowDamage = {};
+			}
+
+			if (HasFlag(batchItem.Operation, DrawOperation::NeedMap) || HasFlag(batchItem.Operation, DrawOperation::MapOverDamage))
+			{
+				auto position = windowManager.GetAbsoluteRootPosition(target);
+				if (HasFlag(batchItem.Operation, DrawOperation::NeedMap))
+				{
+					auto area = batchItem.Area;
+					Rectangle rootDamage{ position.X + windowDamage.X, position.Y + windowDamage.Y, windowDamage.Width, windowDamage.Height };
+					if (windowDamage.IsEmpty() || LayoutUtils::GetIntersectionClipRect(batchItem.Area, rootDamage, area))
+					{
+						Compose(target, position, area, pixelsComposed);
+						damage.Add(area);
+					}
+				}
+				else
+				{
+					for (auto& damagedRectangle : damage.GetRectangles())
+					{
+						Rectangle area;
+						if (LayoutUtils::GetIntersectionClipRect(batchItem.Area, damagedRectangle, area))
+						{
+							Compose(target, position, area, pixelsComposed);
+						}
+					}
+				}
+			}
 
-			batchItem.Target->DrawStatus = DrawWindowStatus::None;
+			target->DrawStatus = DrawWindowStatus::None;
 		}
 		rootGraphics.Flush();
 
-		if (fullMap)
+		for (auto& damagedRectangle : damage.GetRectangles())
 		{
-			m_context.m_rootWindow->Renderer.Map(m_context.m_rootWindow, m_context.m_rootWindow->ClientSize.ToRectangle());
+			m_context.m_rootWindow->Renderer.Map(m_context.m_rootWindow, damagedRectangle);
 		}
 
-		//TODO: Remove this! or put an ASSERT
-		for (size_t i = 0; i < m_context.m_batchItemRequests.size(); i++)
-		{
-			for (size_t j = i + 1; j < m_context.m_batchItemRequests.size(); j++)
-			{
-				if (m_context.m_batchItemRequests[i].Target == m_context.m_batchItemRequests[j].Target) {
-					break;
-				}
-			}
-		}
+		auto& statistics = m_context.m_statistics;
+		++statistics.Frames;
+		statistics.PixelsComposed = pixelsComposed;
+		statistics.PixelsPresented = damage.GetArea();
+		statistics.TotalPixelsComposed += statistics.PixelsComposed;
+		statistics.TotalPixelsPresented += statistics.PixelsPresented;
+		statistics.WindowsCulled = culledWindows;
+		statistics.TotalWindowsCulled += culledWindows;
 
 		for (auto& batchItem : m_context.m_batchItemRequests)
 		{
-			if (!fullMap)
-			{
-				m_context.m_rootWindow->Renderer.Map(m_context.m_rootWindow, batchItem.Area);
-			}
 			if (HasFlag(batchItem.Operation, DrawOperation::Refresh))
 			{
 				API::RefreshWindow(batchItem.Target->RootHandle);
@@ -129,18 +187,18 @@ namespace Berta
 	void DrawBatch::Clear()
 	{
 		m_context.m_batchItemRequests.clear();
+		m_context.m_batchItemIndices.clear();
 	}
 
 	void DrawBatch::AddWindow(Window* window, const Rectangle& areaToUpdate, const DrawOperation& operation)
 	{
-		for (auto& batchItem : m_context.m_batchItemRequests)
+		auto [it, inserted] = m_context.m_batchItemIndices.try_emplace(window, m_context.m_batchItemRequests.size());
+		if (!inserted)
 		{
-			if (batchItem.Target == window)
-			{
-				batchItem.Area = areaToUpdate;
-				batchItem.Operation = batchItem.Operation | operation;
-				return;
-			}
+			auto& batchItem = m_context.m_batchItemRequests[it->second];
+			batchItem.Area = areaToUpdate;
+			batchItem.Operation = batchItem.Operation | operation;
+			return;
 		}
 
 		m_context.m_batchItemRequests.emplace_back(BatchItem{ window, areaToUpdate, operation });
@@ -148,13 +206,42 @@ namespace Berta
 
 	bool DrawBatch::Exists(Window* window, const Rectangle& areaToUpdate, const DrawOperation& operation)
 	{
-		for (auto& batchItem : m_context.m_batchItemRequests)
+		auto it = m_context.m_batchItemIndices.find(window);
+		if (it == m_context.m_batchItemIndices.end())
 		{
-			if (batchItem.Target == window && batchItem.Area == areaToUpdate && batchItem.Operation == operation)
-				return true;
+			return false;
 		}
 
-		return false;
+		auto& batchItem = m_context.m_batchItemRequests[it->second];
+		return batchItem.Area == areaToUpdate && batchItem.Operation == operation;
+	}
+
+	const CompositorStatistics& DrawBatch::GetStatistics(Window* rootWindow)
+	{
+		return g_contexts[rootWindow->RootWindow].m_statistics;
+	}
+
+	void DrawBatch::RecordCulledWindows(Window* rootWindow, uint32_t count)
+	{
+		auto& statistics = g_contexts[rootWindow->RootWindow].m_statistics;
+		statistics.WindowsCulled = count;
+		statistics.TotalWindowsCulled += count;
+	}
+
+	void DrawBatch::ReleaseContext(Window* rootWindow)
+	{
+		auto it = g_contexts.find(rootWindow);
+		if (it != g_contexts.end() && it->second.m_batchCount == 0)
+		{
+			g_contexts.erase(it);
+		}
+	}
+
+	void DrawBatch::Compose(Window* window, const Point& windowPosition, const Rectangle& area, uint64_t& pixelsComposed)
+	{
+		auto& rootGraphics = *(m_context.m_rootWindow->RootGraphics);
+		rootGraphics.BitBlt(area, window->Renderer.GetGraphics(), { area.X - windowPosition.X, area.Y - windowPosition.Y });
+		pixelsComposed += DamageRegion::GetArea(area);
 	}
 
 	bool BatchItemComparer::operator()(BatchItem a, BatchItem b) const
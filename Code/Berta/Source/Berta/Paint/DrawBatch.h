@@ -9,6 +9,7 @@
 
 #include "Berta/Core/Base.h"
 #include "Berta/Core/BasicTypes.h"
+#include "Berta/Paint/DamageRegion.h"
 #include <vector>
 #include <unordered_map>
 
@@ -22,6 +23,7 @@ namespace Berta
 		NeedUpdate = 1,
 		NeedMap = 2,
 		Refresh = 4,
+		MapOverDamage = 8,	// Content unchanged, composed again only where something below it was.
 	};
 	BT_DEFINITION_FLAG_FROM_ENUM(DrawOperation);
 
@@ -38,10 +40,25 @@ namespace Berta
 		bool operator()(BatchItem a, BatchItem b) const;
 	};
 
+	struct CompositorStatistics
+	{
+		uint64_t Frames{ 0 };
+		uint64_t PixelsComposed{ 0 };	// Last frame.
+		uint64_t PixelsPresented{ 0 };	// Last frame.
+		uint64_t WindowsCulled{ 0 };	// Last frame, or last immediate UpdateTree.
+		uint64_t TotalPixelsComposed{ 0 };
+		uint64_t TotalPixelsPresented{ 0 };
+		uint64_t TotalWindowsCulled{ 0 };
+	};
+
 	struct DrawBatcherContext
 	{
 		Window* m_rootWindow{ nullptr };
 		std::vector<BatchItem> m_batchItemRequests;
+		std::unordered_map<Window*, size_t> m_batchItemIndices; // Position of each window in m_batchItemRequests.
+		DamageRegion m_damage; // Root relative, what is composed this frame and then presented.
+		CompositorStatistics m_statistics;
+		uint32_t m_batchCount{ 0 }; // DrawBatch objects alive on this context, nested ones included.
 	};
 
 	class DrawBatch
@@ -55,7 +72,15 @@ namespace Berta
 		void AddWindow(Window* window, const Rectangle& areaToUpdate, const DrawOperation& operation);
 		bool Exists(Window* window, const Rectangle& areaToUpdate, const DrawOperation& operation);
 
+		static const CompositorStatistics& GetStatistics(Window* rootWindow);
+		static void RecordCulledWindows(Window* rootWindow, uint32_t count);
+		// Called when the root window is removed: its slot is reused by the next window, which must start with a new context.
+		static void ReleaseContext(Window* rootWindow);
+
 	private:
+		void Compose(Window* window, const Point& windowPosition, const Rectangle& area, uint64_t& pixelsComposed);
+
+		Window* m_contextKey;
 		DrawBatcherContext& m_context;
 		static std::unordered_map<Window*, DrawBatcherContext> g_contexts;
 	};
@@ -15,6 +15,10 @@
 #if BT_PLATFORM_WINDOWS
 #include "Berta/Platform/Windows/D2D.h"
 #include <comdef.h>
+#else
+#include "Berta/Paint/DefaultFont.h"
+#include "Berta/Paint/Rasterizer.h"
+#include "Berta/Platform/Headless/VirtualDisplay.h"
 #endif
 
 // Define M_PI if it's not already defined
@@ -128,7 +132,11 @@ namespace Berta
 				BT_CORE_ERROR << "Error creating bitmap render target." << std::endl;
 			}
 		}
-
+#else
+		// Same initial content as a compatible render target: transparent black.
+		m_attributes->m_size = m_size;
+		m_attributes->m_pixels.assign(static_cast<size_t>(m_size.Width) * m_size.Height, 0u);
+		m_attributes->m_clips.clear();
 #endif
 	}
 
@@ -155,6 +163,15 @@ namespace Berta
 			&m_attributes->m_textFormat
 		);
 
+		m_attributes->m_textExtents = nullptr;
+		if (SUCCEEDED(hr))
+		{
+			API::BindTextExtentCache(m_attributes.get(), { lfText.lfFaceName, static_cast<float>(std::abs(lfText.lfHeight)), dpi });
+		}
+		m_attributes->m_textExtent = GetTextExtent("{}[]");
+#else
+		m_attributes->m_fontSize = static_cast<uint32_t>(std::lround(DefaultFont::PixelSize * LayoutUtils::CalculateDPIScaleFactor(dpi)));
+		API::BindTextExtentCache(m_attributes.get(), { L"DefaultFont", static_cast<float>(m_attributes->m_fontSize), dpi });
 		m_attributes->m_textExtent = GetTextExtent("{}[]");
 #endif
 	}
@@ -195,6 +212,14 @@ namespace Berta
 
 			sourceBitmap->Release();
 		}
+#else
+		if (!m_attributes || !graphicsSource.m_attributes)
+		{
+			return;
+		}
+
+		auto opacity = static_cast<uint32_t>(std::lround((std::clamp)(alpha, 0.0, 1.0) * 255.0));
+		Rasterizer(*m_attributes).Blit(blendDestRectangle, *graphicsSource.m_attributes, pointSource, opacity);
 #endif
 	}
 
@@ -219,6 +244,13 @@ namespace Berta
 		{
 			BT_CORE_ERROR << " Graphics / BitBlt" << std::endl;
 		}
+#else
+		if (!m_attributes || !graphicsSource.m_attributes)
+		{
+			return;
+		}
+
+		Rasterizer(*m_attributes).Blit(rectDestination, *graphicsSource.m_attributes, pointSource, 255);
 #endif
 	}
 
@@ -230,15 +262,13 @@ namespace Berta
 	void Graphics::DrawLine(const Point& point1, const Point& point2, float strokeWidth, const Color& color, LineStyle style)
 	{
 #ifdef BT_PLATFORM_WINDOWS
-		if (!m_attributes)
+		if (!m_attributes || !m_attributes->m_bitmapRT)
 		{
 			return;
 		}
 
-		ID2D1SolidColorBrush* brush;
-		auto hr = m_attributes->m_bitmapRT->CreateSolidColorBrush(color, &brush);
-
-		if (SUCCEEDED(hr))
+		auto brush = m_attributes->m_brushes.Get(m_attributes->m_bitmapRT, color);
+		if (brush)
 		{
 			D2D1_POINT_2F point1F;
 			point1F.x = static_cast<FLOAT>(point1.X) + 0.5f;
@@ -254,26 +284,19 @@ namespace Berta
 			}
 			else
 			{
-				ID2D1StrokeStyle* strokeStyle = nullptr;
-
-				D2D1_STROKE_STYLE_PROPERTIES props = D2D1::StrokeStyleProperties
-				(
-					D2D1_CAP_STYLE_ROUND,      // startCap
-					D2D1_CAP_STYLE_ROUND,      // endCap
-					D2D1_CAP_STYLE_FLAT,       // dashCap
-					D2D1_LINE_JOIN_ROUND,      // lineJoin
-					10.0f,                     // miterLimit
-					D2D1_DASH_STYLE_DASH,      // dashStyle
-					0.0f                       // dashOffset
-				);
-
-				DirectX::D2DModule::GetInstance().GetFactory()->CreateStrokeStyle(&props, nullptr, 0, &strokeStyle);
+				auto strokeStyle = DirectX::D2DModule::GetInstance().GetGeometryCache().GetStrokeStyle(D2D1_DASH_STYLE_DASH);
 				m_attributes->m_bitmapRT->DrawLine(point1F, point2F, brush, strokeWidth, strokeStyle);
-
-				strokeStyle->Release();
 			}
-			brush->Release();
 		}
+#else
+		if (!m_attributes)
+		{
+			return;
+		}
+
+		Rasterizer::PointF point1F{ static_cast<float>(point1.X) + 0.5f, static_cast<float>(point1.Y) + 0.5f };
+		Rasterizer::PointF point2F{ static_cast<float>(point2.X) + 0.5f, static_cast<float>(point2.Y) + 0.5f };
+		Rasterizer(*m_attributes).StrokeLine(point1F, point2F, strokeWidth, Rasterizer::ToPremultiplied(color), style != LineStyle::Solid);
 #endif
 	}
 
@@ -310,10 +333,8 @@ namespace Berta
 
 		D2D1_RECT_F d2dRect = validRectangle;
 
-		ID2D1SolidColorBrush* brush;
-		auto hr = m_attributes->m_bitmapRT->CreateSolidColorBrush(color, &brush);
-
-		if (SUCCEEDED(hr))
+		auto brush = m_attributes->m_brushes.Get(m_attributes->m_bitmapRT, color);
+		if (brush)
 		{
 			if (solid)
 			{
@@ -328,7 +349,28 @@ namespace Berta
 
 				m_attributes->m_bitmapRT->DrawRectangle(&d2dRect, brush);
 			}
-			brush->Release();
+		}
+#else
+		if (!m_attributes)
+		{
+			return;
+		}
+
+		Rectangle validRectangle;
+		if (!LayoutUtils::GetIntersectionClipRect(GetSize().ToRectangle(), rectangle, validRectangle))
+		{
+			return;
+		}
+
+		Rasterizer rasterizer(*m_attributes);
+		auto premultiplied = Rasterizer::ToPremultiplied(color);
+		if (solid)
+		{
+			rasterizer.FillRectangle(validRectangle, premultiplied);
+		}
+		else
+		{
+			DrawRectangleBorder(rasterizer, validRectangle, premultiplied);
 		}
 #endif
 	}
@@ -349,19 +391,15 @@ namespace Berta
 
 		D2D1_RECT_F d2dRect = validRectangle;
 		
-		ID2D1SolidColorBrush* borderBrush;
-		auto hr = m_attributes->m_bitmapRT->CreateSolidColorBrush(borderColor, &borderBrush);
-
-		if (SUCCEEDED(hr))
+		auto borderBrush = m_attributes->m_brushes.Get(m_attributes->m_bitmapRT, borderColor);
+		if (borderBrush)
 		{
 			if (solid)
 			{
-				ID2D1SolidColorBrush* solidBrush;
-				hr = m_attributes->m_bitmapRT->CreateSolidColorBrush(solidColor, &solidBrush);
-				if (SUCCEEDED(hr))
+				auto solidBrush = m_attributes->m_brushes.Get(m_attributes->m_bitmapRT, solidColor);
+				if (solidBrush)
 				{
 					m_attributes->m_bitmapRT->FillRectangle(&d2dRect, solidBrush);
-					solidBrush->Release();
 				}
 			}
 			
@@ -371,9 +409,25 @@ namespace Berta
 			d2dRect.bottom -= 0.5f;
 
 			m_attributes->m_bitmapRT->DrawRectangle(&d2dRect, borderBrush);
+		}
+#else
+		if (!m_attributes)
+		{
+			return;
+		}
 
-			borderBrush->Release();
+		Rectangle validRectangle;
+		if (!LayoutUtils::GetIntersectionClipRect(GetSize().ToRectangle(), rectangle, validRectangle))
+		{
+			return;
+		}
+
+		Rasterizer rasterizer(*m_attributes);
+		if (solid)
+		{
+			rasterizer.FillRectangle(validRectangle, Rasterizer::ToPremultiplied(solidColor));
 		}
+		DrawRectangleBorder(rasterizer, validRectangle, Rasterizer::ToPremultiplied(borderColor));
 #endif
 	}
 
@@ -398,9 +452,11 @@ namespace Berta
 		d2dRect.right = static_cast<FLOAT>(position.X + textSize.Width);
 		d2dRect.bottom = static_cast<FLOAT>(position.Y + textSize.Height);
 
-		ID2D1SolidColorBrush* brush;
-		m_attributes->m_bitmapRT->CreateSolidColorBrush(color,
-			&brush);
+		auto brush = m_attributes->m_brushes.Get(m_attributes->m_bitmapRT, color);
+		if (!brush)
+		{
+			return;
+		}
 
 		m_attributes->m_bitmapRT->DrawText
 		(
@@ -410,8 +466,13 @@ namespace Berta
 			d2dRect,
 			brush
 		);
+#else
+		if (!m_attributes)
+		{
+			return;
+		}
 
-		brush->Release();
+		Rasterizer(*m_attributes).DrawString(position, wstr, Rasterizer::ToPremultiplied(color));
 #endif
 	}
 
@@ -428,92 +489,150 @@ namespace Berta
 	void Graphics::DrawArrow(const Rectangle& rect, int arrowLength, int arrowWidth, ArrowDirection direction, const Color& borderColor, bool solid, const Color& solidColor, float strokeWidth)
 	{
 #ifdef BT_PLATFORM_WINDOWS
+		if (!m_attributes->m_bitmapRT)
+		{
+			return;
+		}
+
 		Rectangle output;
 		if (!LayoutUtils::GetIntersectionClipRect(GetSize().ToRectangle(), rect, output))
 		{
 			return;
 		}
 
-		D2D1_POINT_2F p1, p2, p3;
 		Point center{};
 		center.X = (rect.X * 2 + rect.Width) >> 1;
 		center.Y = (rect.Y * 2 + rect.Height) >> 1;
 
+		// Relative to the center, the geometry is cached by shape (see GeometryCache).
+		auto length = static_cast<float>(arrowLength);
+		auto width = static_cast<float>(arrowWidth);
+		D2D1_POINT_2F points[3]{};
 		switch (direction)
 		{
 		case ArrowDirection::Upwards:
-			p1 = D2D1::Point2F(static_cast<float>(center.X), static_cast<float>(center.Y - arrowLength));
-			p2 = D2D1::Point2F(static_cast<float>(center.X - arrowWidth), static_cast<float>(center.Y + arrowLength));
-			p3 = D2D1::Point2F(static_cast<float>(center.X + arrowWidth), static_cast<float>(center.Y + arrowLength));
+			points[0] = D2D1::Point2F(0.0f, -length);
+			points[1] = D2D1::Point2F(-width, length);
+			points[2] = D2D1::Point2F(width, length);
 			break;
 
 		case ArrowDirection::Downwards:
-			p1 = D2D1::Point2F(static_cast<float>(center.X), static_cast<float>(center.Y + arrowLength));
-			p2 = D2D1::Point2F(static_cast<float>(center.X - arrowWidth), static_cast<float>(center.Y - arrowLength));
-			p3 = D2D1::Point2F(static_cast<float>(center.X + arrowWidth), static_cast<float>(center.Y - arrowLength));
+			points[0] = D2D1::Point2F(0.0f, length);
+			points[1] = D2D1::Point2F(-width, -length);
+			points[2] = D2D1::Point2F(width, -length);
 			break;
 
 		case ArrowDirection::Left:
-			p1 = D2D1::Point2F(static_cast<float>(center.X - arrowLength), static_cast<float>(center.Y));
-			p2 = D2D1::Point2F(static_cast<float>(center.X + arrowLength), static_cast<float>(center.Y - arrowWidth));
-			p3 = D2D1::Point2F(static_cast<float>(center.X + arrowLength), static_cast<float>(center.Y + arrowWidth));
+			points[0] = D2D1::Point2F(-length, 0.0f);
+			points[1] = D2D1::Point2F(length, -width);
+			points[2] = D2D1::Point2F(length, width);
 			break;
 
 		case ArrowDirection::Right:
-			p1 = D2D1::Point2F(static_cast<float>(center.X + arrowLength), static_cast<float>(center.Y));
-			p2 = D2D1::Point2F(static_cast<float>(center.X - arrowLength), static_cast<float>(center.Y - arrowWidth));
-			p3 = D2D1::Point2F(static_cast<float>(center.X - arrowLength), static_cast<float>(center.Y + arrowWidth));
+			points[0] = D2D1::Point2F(length, 0.0f);
+			points[1] = D2D1::Point2F(-length, -width);
+			points[2] = D2D1::Point2F(-length, width);
 			break;
 		}
 
-		if (!output.IsInside(p1) && !output.IsInside(p2) && !output.IsInside(p3))
+		auto centerX = static_cast<float>(center.X);
+		auto centerY = static_cast<float>(center.Y);
+		if (!output.IsInside(D2D1::Point2F(centerX + points[0].x, centerY + points[0].y)) &&
+			!output.IsInside(D2D1::Point2F(centerX + points[1].x, centerY + points[1].y)) &&
+			!output.IsInside(D2D1::Point2F(centerX + points[2].x, centerY + points[2].y)))
 			return;
 
-		ID2D1PathGeometry* geometry = nullptr;
-		ID2D1GeometrySink* sink = nullptr;
-
-		auto hr = DirectX::D2DModule::GetInstance().GetFactory()->CreatePathGeometry(&geometry);
-		if (FAILED(hr))
+		DirectX::GeometryCache::ArrowKey key{ static_cast<int>(direction), arrowLength, arrowWidth, solid };
+		auto geometry = DirectX::D2DModule::GetInstance().GetGeometryCache().GetArrow(key, points);
+		auto borderBrush = m_attributes->m_brushes.Get(m_attributes->m_bitmapRT, borderColor);
+		if (!geometry || !borderBrush)
 		{
 			return;
 		}
 
-		hr = geometry->Open(&sink);
-		if (FAILED(hr))
+		D2D1_MATRIX_3X2_F transform;
+		m_attributes->m_bitmapRT->GetTransform(&transform);
+		m_attributes->m_bitmapRT->SetTransform(D2D1::Matrix3x2F::Translation(centerX, centerY) * (*D2D1::Matrix3x2F::ReinterpretBaseType(&transform)));
+
+		if (solid)
+		{
+			auto solidBrush = m_attributes->m_brushes.Get(m_attributes->m_bitmapRT, solidColor);
+			if (solidBrush)
+			{
+				m_attributes->m_bitmapRT->FillGeometry(geometry, solidBrush);
+			}
+		}
+
+		m_attributes->m_bitmapRT->DrawGeometry(geometry, borderBrush, strokeWidth);
+		m_attributes->m_bitmapRT->SetTransform(transform);
+#else
+		if (!m_attributes)
 		{
-			geometry->Release();
 			return;
 		}
 
-		sink->BeginFigure(p1, solid ? D2D1_FIGURE_BEGIN_FILLED : D2D1_FIGURE_BEGIN_HOLLOW);
-		sink->AddLine(p2);
-		sink->AddLine(p3);
-		sink->EndFigure(D2D1_FIGURE_END_CLOSED);
-		sink->Close();
+		Rectangle output;
+		if (!LayoutUtils::GetIntersectionClipRect(GetSize().ToRectangle(), rect, output))
+		{
+			return;
+		}
 
-		ID2D1SolidColorBrush* borderBrush;
-		hr = m_attributes->m_bitmapRT->CreateSolidColorBrush(borderColor, &borderBrush);
+		Point center{};
+		center.X = (rect.X * 2 + rect.Width) >> 1;
+		center.Y = (rect.Y * 2 + rect.Height) >> 1;
 
-		if (SUCCEEDED(hr))
+		Point p1, p2, p3;
+		switch (direction)
 		{
-			if (solid)
-			{
-				ID2D1SolidColorBrush* solidBrush;
-				hr = m_attributes->m_bitmapRT->CreateSolidColorBrush(solidColor, &solidBrush);
-				if (SUCCEEDED(hr))
-				{
-					m_attributes->m_bitmapRT->FillGeometry(geometry, solidBrush);
-					solidBrush->Release();
-				}
-			}
+		case ArrowDirection::Upwards:
+			p1 = { center.X, center.Y - arrowLength };
+			p2 = { center.X - arrowWidth, center.Y + arrowLength };
+			p3 = { center.X + arrowWidth, center.Y + arrowLength };
+			break;
 
-			m_attributes->m_bitmapRT->DrawGeometry(geometry, borderBrush, strokeWidth);
+		case ArrowDirection::Downwards:
+			p1 = { center.X, center.Y + arrowLength };
+			p2 = { center.X - arrowWidth, center.Y - arrowLength };
+			p3 = { center.X + arrowWidth, center.Y - arrowLength };
+			break;
 
-			borderBrush->Release();
+		case ArrowDirection::Left:
+			p1 = { center.X - arrowLength, center.Y };
+			p2 = { center.X + arrowLength, center.Y - arrowWidth };
+			p3 = { center.X + arrowLength, center.Y + arrowWidth };
+			break;
 
+		case ArrowDirection::Right:
+			p1 = { center.X + arrowLength, center.Y };
+			p2 = { center.X - arrowLength, center.Y - arrowWidth };
+			p3 = { center.X - arrowLength, center.Y + arrowWidth };
+			break;
 		}
-		sink->Release();
-		geometry->Release();
+
+		if (!output.IsInside(p1) && !output.IsInside(p2) && !output.IsInside(p3))
+			return;
+
+		const Rasterizer::PointF triangle[3] =
+		{
+			{ static_cast<float>(p1.X), static_cast<float>(p1.Y) },
+			{ static_cast<float>(p2.X), static_cast<float>(p2.Y) },
+			{ static_cast<float>(p3.X), static_cast<float>(p3.Y) }
+		};
+
+		Rasterizer rasterizer(*m_attributes);
+		if (solid)
+		{
+			Rasterizer::Path fill;
+			fill.AddPolygon(triangle, 3);
+			rasterizer.FillPath(fill, Rasterizer::ToPremultiplied(solidColor));
+		}
+
+		Rasterizer::Path border;
+		for (size_t i = 0; i < 3; ++i)
+		{
+			border.AddLine(triangle[i], triangle[(i + 1) % 3], strokeWidth);
+		}
+		rasterizer.FillPath(border, Rasterizer::ToPremultiplied(borderColor));
 #endif
 	}
 	
@@ -546,16 +665,14 @@ namespace Berta
 			radiusScaled
 		);
 
-		ID2D1SolidColorBrush* brush;
-		auto hr = m_attributes->m_bitmapRT->CreateSolidColorBrush(color, &brush);
-		if (FAILED(hr))
+		auto brush = m_attributes->m_brushes.Get(m_attributes->m_bitmapRT, color);
+		if (!brush)
 		{
 			return;
 		}
 
-		ID2D1SolidColorBrush* brushBorder;
-		hr = m_attributes->m_bitmapRT->CreateSolidColorBrush(bordercolor, &brushBorder);
-		if (SUCCEEDED(hr))
+		auto brushBorder = m_attributes->m_brushes.Get(m_attributes->m_bitmapRT, bordercolor);
+		if (brushBorder)
 		{
 			if (solid)
 			{
@@ -567,10 +684,39 @@ namespace Berta
 
 				m_attributes->m_bitmapRT->DrawRoundedRectangle(&roundedRect, brushBorder);
 			}
-			brushBorder->Release();
 		}
+#else
+		if (!m_attributes)
+		{
+			return;
+		}
+
+		Rectangle output;
+		if (!LayoutUtils::GetIntersectionClipRect(GetSize().ToRectangle(), rect, output))
+		{
+			return;
+		}
+
+		float scaleFactor = LayoutUtils::CalculateDPIScaleFactor(m_dpi);
+		auto radiusScaled = radius * scaleFactor;
+		auto left = static_cast<float>(rect.X) + 0.5f;
+		auto top = static_cast<float>(rect.Y) + 0.5f;
+		auto right = static_cast<float>(rect.X + static_cast<int>(rect.Width)) - 0.5f;
+		auto bottom = static_cast<float>(rect.Y + static_cast<int>(rect.Height)) - 0.5f;
 
-		brush->Release();
+		Rasterizer rasterizer(*m_attributes);
+		if (solid)
+		{
+			Rasterizer::Path fill;
+			fill.AddRoundRectangle(left, top, right, bottom, radiusScaled);
+			rasterizer.FillPath(fill, Rasterizer::ToPremultiplied(color));
+		}
+
+		// One pixel wide stroke centered on the outline.
+		Rasterizer::Path border;
+		border.AddRoundRectangle(left - 0.5f, top - 0.5f, right + 0.5f, bottom + 0.5f, radiusScaled + 0.5f);
+		border.AddRoundRectangle(left + 0.5f, top + 0.5f, right - 0.5f, bottom - 0.5f, radiusScaled - 0.5f);
+		rasterizer.FillPath(border, Rasterizer::ToPremultiplied(bordercolor), Rasterizer::FillRule::EvenOdd);
 #endif
 	}
 
@@ -626,6 +772,13 @@ namespace Berta
 
 		if (pLinearGradientBrush) pLinearGradientBrush->Release();
 		if (pGradientStopCollection) pGradientStopCollection->Release();
+#else
+		if (!m_attributes)
+		{
+			return;
+		}
+
+		Rasterizer(*m_attributes).FillVerticalGradient(rect, Rasterizer::ToPremultiplied(startColor), Rasterizer::ToPremultiplied(endColor));
 #endif
 	}
 
@@ -634,30 +787,31 @@ namespace Berta
 #ifdef BT_PLATFORM_WINDOWS
 		D2D1_ELLIPSE ellipse = D2D1::Ellipse(D2D1::Point2F(dest.X, dest.Y), static_cast<float>(radius), static_cast<float>(radius));
 
-		ID2D1SolidColorBrush* borderBrush;
-		auto hr = m_attributes->m_bitmapRT->CreateSolidColorBrush(borderColor, &borderBrush);
-		if (FAILED(hr))
+		auto borderBrush = m_attributes->m_brushes.Get(m_attributes->m_bitmapRT, borderColor);
+		if (!borderBrush)
 		{
 			return;
 		}
 
 		if (solid)
 		{
-			ID2D1SolidColorBrush* fillBrush;
-			hr = m_attributes->m_bitmapRT->CreateSolidColorBrush(fillColor, &fillBrush);
-			if (FAILED(hr))
+			auto fillBrush = m_attributes->m_brushes.Get(m_attributes->m_bitmapRT, fillColor);
+			if (!fillBrush)
 			{
-				borderBrush->Release();
 				return;
 			}
 
 			m_attributes->m_bitmapRT->FillEllipse(ellipse, fillBrush);
-			fillBrush->Release();
 		}
 
 		m_attributes->m_bitmapRT->DrawEllipse(ellipse, borderBrush, strokeWidth);
+#else
+		if (!m_attributes)
+		{
+			return;
+		}
 
-		borderBrush->Release();
+		DrawEllipseShape(static_cast<float>(dest.X), static_cast<float>(dest.Y), static_cast<float>(radius), static_cast<float>(radius), fillColor, borderColor, solid, strokeWidth);
 #endif
 	}
 
@@ -667,33 +821,74 @@ namespace Berta
 		D2D1_ELLIPSE ellipse = D2D1::Ellipse(D2D1::Point2F(static_cast<FLOAT>((dest.X * 2 + dest.Width)>> 1), static_cast<FLOAT>((dest.Y * 2 + dest.Height) >> 1)), 
 			static_cast<FLOAT>(dest.Width >> 1), static_cast<FLOAT>(dest.Height >> 1));
 
-		ID2D1SolidColorBrush* borderBrush;
-		auto hr = m_attributes->m_bitmapRT->CreateSolidColorBrush(borderColor, &borderBrush);
-		if (FAILED(hr))
+		auto borderBrush = m_attributes->m_brushes.Get(m_attributes->m_bitmapRT, borderColor);
+		if (!borderBrush)
 		{
 			return;
 		}
 
 		if (solid)
 		{
-			ID2D1SolidColorBrush* fillBrush;
-			hr = m_attributes->m_bitmapRT->CreateSolidColorBrush(fillColor, &fillBrush);
-			if (FAILED(hr))
+			auto fillBrush = m_attributes->m_brushes.Get(m_attributes->m_bitmapRT, fillColor);
+			if (!fillBrush)
 			{
-				borderBrush->Release();
 				return;
 			}
 
 			m_attributes->m_bitmapRT->FillEllipse(ellipse, fillBrush);
-			fillBrush->Release();
 		}
 
 		m_attributes->m_bitmapRT->DrawEllipse(ellipse, borderBrush, strokeWidth);
+#else
+		if (!m_attributes)
+		{
+			return;
+		}
 
-		borderBrush->Release();
+		DrawEllipseShape(static_cast<float>((dest.X * 2 + dest.Width) >> 1), static_cast<float>((dest.Y * 2 + dest.Height) >> 1),
+			static_cast<float>(dest.Width >> 1), static_cast<float>(dest.Height >> 1), fillColor, borderColor, solid, strokeWidth);
 #endif
 	}
 
+#ifndef BT_PLATFORM_WINDOWS
+	void Graphics::DrawRectangleBorder(Rasterizer& rasterizer, const Rectangle& rectangle, uint32_t color)
+	{
+		// Same pixels as the D2D one pixel stroke inset by half a pixel.
+		auto width = rectangle.Width;
+		auto height = rectangle.Height;
+		rasterizer.FillRectangle({ rectangle.X, rectangle.Y, width, 1 }, color);
+		if (height > 1)
+		{
+			rasterizer.FillRectangle({ rectangle.X, rectangle.Y + static_cast<int>(height) - 1, width, 1 }, color);
+		}
+		if (height > 2)
+		{
+			rasterizer.FillRectangle({ rectangle.X, rectangle.Y + 1, 1, height - 2 }, color);
+			if (width > 1)
+			{
+				rasterizer.FillRectangle({ rectangle.X + static_cast<int>(width) - 1, rectangle.Y + 1, 1, height - 2 }, color);
+			}
+		}
+	}
+
+	void Graphics::DrawEllipseShape(float centerX, float centerY, float radiusX, float radiusY, const Color& fillColor, const Color& borderColor, bool solid, float strokeWidth)
+	{
+		Rasterizer rasterizer(*m_attributes);
+		if (solid)
+		{
+			Rasterizer::Path fill;
+			fill.AddEllipse(centerX, centerY, radiusX, radiusY);
+			rasterizer.FillPath(fill, Rasterizer::ToPremultiplied(fillColor));
+		}
+
+		auto halfStroke = strokeWidth * 0.5f;
+		Rasterizer::Path border;
+		border.AddEllipse(centerX, centerY, radiusX + halfStroke, radiusY + halfStroke);
+		border.AddEllipse(centerX, centerY, radiusX - halfStroke, radiusY - halfStroke);
+		rasterizer.FillPath(border, Rasterizer::ToPremultiplied(borderColor), Rasterizer::FillRule::EvenOdd);
+	}
+#endif
+
 	void Graphics::Paste(API::NativeWindowHandle destinationHandle, const Rectangle& areaToUpdate, int x, int y) const
 	{
 		Paste(destinationHandle, areaToUpdate.X, areaToUpdate.Y, areaToUpdate.Width, areaToUpdate.Height, x, y);
@@ -739,8 +934,19 @@ namespace Berta
 			if (FAILED(hr))
 			{
 				BT_CORE_ERROR << "Error on Paste method, EndDraw()" << std::endl;
+				if (hr == D2DERR_RECREATE_TARGET)
+				{
+					m_attributes->m_brushes.Clear(); // Device lost, its brushes are no longer usable.
+				}
 			}
 		}
+#else
+		if (!m_attributes || m_attributes->m_pixels.empty() || !destinationHandle)
+		{
+			return;
+		}
+
+		VirtualDisplay::GetInstance().Present(destinationHandle.Target, *m_attributes, { dx, dy, width, height }, { sx, sy });
 #endif
 	}
 
@@ -754,6 +960,11 @@ namespace Berta
 		
 		m_attributes->m_bitmapRT->BeginDraw();
 		m_attributes->m_bitmapRT->SetTransform(D2D1::Matrix3x2F::Identity());
+#else
+		if (m_attributes)
+		{
+			m_attributes->m_clips.clear();
+		}
 #endif
 	}
 
@@ -770,6 +981,53 @@ namespace Berta
 		{
 			_com_error err(hr);
 			BT_CORE_ERROR << "Error Bitmap EndDraw(). err.ErrorMessage() = " << StringUtils::Convert(err.ErrorMessage()) << std::endl;
+			if (hr == D2DERR_RECREATE_TARGET)
+			{
+				m_attributes->m_brushes.Clear(); // Device lost, its brushes are no longer usable.
+			}
+		}
+#endif
+	}
+
+	void Graphics::PushClip(const Rectangle& rect)
+	{
+#ifdef BT_PLATFORM_WINDOWS
+		if (!m_attributes->m_bitmapRT)
+		{
+			return;
+		}
+
+		D2D1_RECT_F d2dRect = rect;
+		m_attributes->m_bitmapRT->PushAxisAlignedClip(d2dRect, D2D1_ANTIALIAS_MODE_ALIASED);
+#else
+		if (!m_attributes)
+		{
+			return;
+		}
+
+		auto& clips = m_attributes->m_clips;
+		Rectangle clip = rect;
+		if (!clips.empty() && !LayoutUtils::GetIntersectionClipRect(clips.back(), rect, clip))
+		{
+			clip = {};
+		}
+		clips.push_back(clip);
+#endif
+	}
+
+	void Graphics::PopClip()
+	{
+#ifdef BT_PLATFORM_WINDOWS
+		if (!m_attributes->m_bitmapRT)
+		{
+			return;
+		}
+
+		m_attributes->m_bitmapRT->PopAxisAlignedClip();
+#else
+		if (m_attributes && !m_attributes->m_clips.empty())
+		{
+			m_attributes->m_clips.pop_back();
 		}
 #endif
 	}
@@ -810,7 +1068,7 @@ namespace Berta
 #ifdef BT_PLATFORM_WINDOWS
 		return m_attributes->m_bitmapRT->GetAntialiasMode() == D2D1_ANTIALIAS_MODE_ALIASED;
 #else
-		return false;
+		return m_attributes && m_attributes->m_aliased;
 #endif
 	}
 
@@ -818,6 +1076,11 @@ namespace Berta
 	{
 #ifdef BT_PLATFORM_WINDOWS
 		m_attributes->m_bitmapRT->SetAntialiasMode(enabled ? D2D1_ANTIALIAS_MODE_ALIASED : D2D1_ANTIALIAS_MODE_PER_PRIMITIVE);
+#else
+		if (m_attributes)
+		{
+			m_attributes->m_aliased = enabled;
+		}
 #endif
 	}
 }
@@ -14,6 +14,8 @@
 
 namespace Berta
 {
+	class Rasterizer;
+
 	/*
 	* Wrapper for GDI functions.
 	*/
@@ -93,6 +95,10 @@ namespace Berta
 		void Begin();
 		void Flush();
 
+		// Restricts drawing to the rectangle until PopClip, only between Begin and Flush.
+		void PushClip(const Rectangle& rect);
+		void PopClip();
+
 		void Swap(Graphics& other);
 		void Release();
 		bool IsEnabledAliasing();
@@ -103,10 +109,14 @@ namespace Berta
 #ifdef BT_PLATFORM_WINDOWS
 			return m_attributes != nullptr && m_attributes->m_bitmapRT;
 #else
-			return m_attributes != nullptr;
+			return m_attributes != nullptr && !m_attributes->m_pixels.empty();
 #endif
 		}
 	private:
+#ifndef BT_PLATFORM_WINDOWS
+		static void DrawRectangleBorder(Rasterizer& rasterizer, const Rectangle& rectangle, uint32_t color);
+		void DrawEllipseShape(float centerX, float centerY, float radiusX, float radiusY, const Color& fillColor, const Color& borderColor, bool solid, float strokeWidth);
+#endif
 
 		uint32_t m_dpi{ 96u };
 		uint32_t m_lastForegroundColor{ 0 };
@@ -110,6 +110,7 @@ namespace Berta
 			return;
 		}
 
+#if BT_PLATFORM_WINDOWS
 		if (m_bitmap)
 		{
 			m_bitmap->Release();
@@ -148,6 +149,7 @@ namespace Berta
 			D2D1_BITMAP_INTERPOLATION_MODE_LINEAR,
 			validSourceDest
 		);
+#endif
 	}
 
 	void BasicImageAttributes::ReleaseNativeObjects()
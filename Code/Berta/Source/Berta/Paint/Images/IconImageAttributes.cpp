@@ -73,6 +73,7 @@ namespace Berta
 
 	void IconImageAttributes::Open(const std::string& filepath)
 	{
+#if BT_PLATFORM_WINDOWS
 		std::filesystem::path path{ filepath };
 		auto hIcon = (HICON)LoadImage
 		(
@@ -89,6 +90,7 @@ namespace Berta
 			BT_CORE_ERROR << "Failed to load icon: " << GetLastError() << std::endl;
 		}
 		m_hIcon = hIcon;
+#endif
 	}
 
 	void IconImageAttributes::Paste(Graphics& destination, const Point& positionDestination)
@@ -0,0 +1,648 @@
+/*
+* MIT License
+*
+* Copyright (c) 2024 Edgar Bernal (edgar.bernal@gmail.com)
+*/
+
+#include "btpch.h"
+#include "Rasterizer.h"
+
+#include "Berta/API/PaintAPI.h"
+#include "Berta/Paint/DefaultFont.h"
+
+#include <algorithm>
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define BT_RASTERIZER_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace Berta
+{
+	namespace
+	{
+		constexpr int Subsamples = 4;
+		constexpr int SubsampleCoverage = 64;		// Subsamples * SubsampleCoverage is a fully covered pixel.
+		constexpr int FullCoverage = Subsamples * SubsampleCoverage;
+
+		// x / 255 for x in [0, 255 * 255], on the two 16 bit lanes of 0x00XX00XX.
+		inline uint32_t DivideBy255Lanes(uint32_t x)
+		{
+			x += 0x00800080u;
+			return ((x + ((x >> 8) & 0x00FF00FFu)) >> 8) & 0x00FF00FFu;
+		}
+
+		inline uint32_t Scale(uint32_t color, uint32_t factor)
+		{
+			auto rb = DivideBy255Lanes((color & 0x00FF00FFu) * factor);
+			auto ag = DivideBy255Lanes(((color >> 8) & 0x00FF00FFu) * factor);
+			return rb | (ag << 8);
+		}
+
+		inline uint32_t SourceOver(uint32_t destination, uint32_t source)
+		{
+			return source + Scale(destination, 255u - (source >> 24));
+		}
+
+		uint32_t Lerp(uint32_t a, uint32_t b, uint32_t t)
+		{
+			return Scale(a, 255u - t) + Scale(b, t);
+		}
+
+		uint32_t GetSegmentCount(float radius, uint32_t minimum)
+		{
+			// Keeps the distance between the polygon and the arc under a tenth of a pixel.
+			if (radius <= 0.5f)
+			{
+				return minimum;
+			}
+			auto count = static_cast<uint32_t>(std::ceil(3.14159265f / std::acos(1.0f - 0.1f / radius)));
+			return (std::clamp)(count, minimum, 512u);
+		}
+
+#ifdef BT_RASTERIZER_SSE2
+		inline __m128i DivideBy255(__m128i x)
+		{
+			x = _mm_add_epi16(x, _mm_set1_epi16(128));
+			return _mm_srli_epi16(_mm_add_epi16(x, _mm_srli_epi16(x, 8)), 8);
+		}
+
+		// Broadcasts the alpha of each pixel (16 bit lanes 3 and 7) over its four channels.
+		inline __m128i BroadcastAlpha(__m128i pixels)
+		{
+			return _mm_shufflehi_epi16(_mm_shufflelo_epi16(pixels, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+		}
+
+		inline __m128i ScaleByLanes(__m128i pixels, __m128i factorLow, __m128i factorHigh)
+		{
+			auto zero = _mm_setzero_si128();
+			auto low = DivideBy255(_mm_mullo_epi16(_mm_unpacklo_epi8(pixels, zero), factorLow));
+			auto high = DivideBy255(_mm_mullo_epi16(_mm_unpackhi_epi8(pixels, zero), factorHigh));
+			return _mm_packus_epi16(low, high);
+		}
+#endif
+
+		struct Edge
+		{
+			float X;		// At Top.
+			float Top;
+			float Bottom;
+			float Slope;	// dx / dy.
+			int Direction;
+		};
+
+		struct Crossing
+		{
+			float X;
+			int Direction;
+		};
+	}
+
+	void Rasterizer::Path::MoveTo(float x, float y)
+	{
+		m_contourStarts.push_back(m_points.size());
+		m_points.push_back({ x, y });
+	}
+
+	void Rasterizer::Path::LineTo(float x, float y)
+	{
+		if (m_contourStarts.empty())
+		{
+			m_contourStarts.push_back(m_points.size());
+		}
+		m_points.push_back({ x, y });
+	}
+
+	void Rasterizer::Path::AddPolygon(const PointF* points, size_t count)
+	{
+		if (count == 0)
+		{
+			return;
+		}
+
+		MoveTo(points[0].X, points[0].Y);
+		for (size_t i = 1; i < count; ++i)
+		{
+			LineTo(points[i].X, points[i].Y);
+		}
+	}
+
+	void Rasterizer::Path::AddEllipse(float centerX, float centerY, float radiusX, float radiusY)
+	{
+		if (radiusX <= 0.0f || radiusY <= 0.0f)
+		{
+			return;
+		}
+
+		auto count = GetSegmentCount((std::max)(radiusX, radiusY), 8);
+		MoveTo(centerX + radiusX, centerY);
+		for (uint32_t i = 1; i < count; ++i)
+		{
+			auto angle = 6.28318531f * i / count;
+			LineTo(centerX + radiusX * std::cos(angle), centerY + radiusY * std::sin(angle));
+		}
+	}
+
+	void Rasterizer::Path::AddRoundRectangle(float left, float top, float right, float bottom, float radius)
+	{
+		if (right <= left || bottom <= top)
+		{
+			return;
+		}
+
+		radius = (std::clamp)(radius, 0.0f, (std::min)(right - left, bottom - top) * 0.5f);
+		auto count = GetSegmentCount(radius, 1);
+
+		// Corner centers in drawing order (clockwise on screen), each arc covering a quarter turn.
+		const PointF centers[4] =
+		{
+			{ right - radius, top + radius },
+			{ right - radius, bottom - radius },
+			{ left + radius, bottom - radius },
+			{ left + radius, top + radius }
+		};
+
+		m_contourStarts.push_back(m_points.size());
+		for (uint32_t corner = 0; corner < 4; ++corner)
+		{
+			auto startAngle = -1.57079633f + 1.57079633f * corner;
+			for (uint32_t i = 0; i <= count; ++i)
+			{
+				auto angle = startAngle + 1.57079633f * i / count;
+				m_points.push_back({ centers[corner].X + radius * std::cos(angle), centers[corner].Y + radius * std::sin(angle) });
+			}
+		}
+	}
+
+	void Rasterizer::Path::AddLine(const PointF& point1, const PointF& point2, float strokeWidth)
+	{
+		auto dx = point2.X - point1.X;
+		auto dy = point2.Y - point1.Y;
+		auto length = std::sqrt(dx * dx + dy * dy);
+		if (length <= 0.0f)
+		{
+			return;
+		}
+
+		// Every quad built this way has the same orientation, so overlapping ones add up under NonZero.
+		auto normalX = dy / length * strokeWidth * 0.5f;
+		auto normalY = -dx / length * strokeWidth * 0.5f;
+		const PointF quad[4] =
+		{
+			{ point1.X + normalX, point1.Y + normalY },
+			{ point2.X + normalX, point2.Y + normalY },
+			{ point2.X - normalX, point2.Y - normalY },
+			{ point1.X - normalX, point1.Y - normalY }
+		};
+		AddPolygon(quad, 4);
+	}
+
+	Rasterizer::Rasterizer(PaintNativeHandle& surface) :
+		m_surface(surface)
+	{
+		m_clipRight = static_cast<int>(surface.m_size.Width);
+		m_clipBottom = static_cast<int>(surface.m_size.Height);
+		if (surface.m_pixels.empty())
+		{
+			m_clipRight = m_clipBottom = 0;
+			return;
+		}
+
+		if (!surface.m_clips.empty())
+		{
+			auto& clip = surface.m_clips.back();
+			m_clipLeft = (std::max)(m_clipLeft, clip.X);
+			m_clipTop = (std::max)(m_clipTop, clip.Y);
+			m_clipRight = (std::min)(m_clipRight, clip.X + static_cast<int>(clip.Width));
+			m_clipBottom = (std::min)(m_clipBottom, clip.Y + static_cast<int>(clip.Height));
+		}
+	}
+
+	uint32_t Rasterizer::ToPremultiplied(const Color& color)
+	{
+		auto abgr = static_cast<uint32_t>(color);
+		uint32_t alpha = abgr >> 24;
+		uint32_t argb = (alpha << 24) | ((abgr & 0xFFu) << 16) | (abgr & 0xFF00u) | ((abgr >> 16) & 0xFFu);
+		return (alpha << 24) | Scale(argb & 0x00FFFFFFu, alpha);
+	}
+
+	void Rasterizer::FillRectangle(const Rectangle& rect, uint32_t color)
+	{
+		auto left = (std::max)(rect.X, m_clipLeft);
+		auto top = (std::max)(rect.Y, m_clipTop);
+		auto right = (std::min)(rect.X + static_cast<int>(rect.Width), m_clipRight);
+		auto bottom = (std::min)(rect.Y + static_cast<int>(rect.Height), m_clipBottom);
+		if (left >= right || top >= bottom || color == 0)
+		{
+			return;
+		}
+
+		for (int y = top; y < bottom; ++y)
+		{
+			FillSpan(GetRow(y) + left, static_cast<size_t>(right - left), color);
+		}
+	}
+
+	void Rasterizer::FillVerticalGradient(const Rectangle& rect, uint32_t startColor, uint32_t endColor)
+	{
+		auto left = (std::max)(rect.X, m_clipLeft);
+		auto top = (std::max)(rect.Y, m_clipTop);
+		auto right = (std::min)(rect.X + static_cast<int>(rect.Width), m_clipRight);
+		auto bottom = (std::min)(rect.Y + static_cast<int>(rect.Height), m_clipBottom);
+		if (left >= right || top >= bottom)
+		{
+			return;
+		}
+
+		// One color per row, sampled at the pixel center.
+		for (int y = top; y < bottom; ++y)
+		{
+			auto t = static_cast<uint32_t>((2 * (y - rect.Y) + 1) * 255 / (2 * static_cast<int>(rect.Height)));
+			FillSpan(GetRow(y) + left, static_cast<size_t>(right - left), Lerp(startColor, endColor, t));
+		}
+	}
+
+	void Rasterizer::FillPath(const Path& path, uint32_t color, FillRule rule)
+	{
+		if (path.IsEmpty() || color == 0 || m_clipLeft >= m_clipRight || m_clipTop >= m_clipBottom)
+		{
+			return;
+		}
+
+		thread_local std::vector<Edge> edges;
+		thread_local std::vector<Crossing> crossings;
+		thread_local std::vector<int32_t> cells;
+		thread_local std::vector<int32_t> runs;
+		edges.clear();
+
+		float minY = path.m_points[0].Y, maxY = minY;
+		float minX = path.m_points[0].X, maxX = minX;
+		for (size_t contour = 0; contour < path.m_contourStarts.size(); ++contour)
+		{
+			auto begin = path.m_contourStarts[contour];
+			auto end = contour + 1 < path.m_contourStarts.size() ? path.m_contourStarts[contour + 1] : path.m_points.size();
+			for (auto i = begin; i < end; ++i)
+			{
+				auto& a = path.m_points[i];
+				auto& b = path.m_points[i + 1 < end ? i + 1 : begin];
+				minX = (std::min)(minX, a.X);
+				maxX = (std::max)(maxX, a.X);
+				minY = (std::min)(minY, a.Y);
+				maxY = (std::max)(maxY, a.Y);
+				if (a.Y == b.Y)
+				{
+					continue;
+				}
+
+				auto& top = a.Y < b.Y ? a : b;
+				auto& bottom = a.Y < b.Y ? b : a;
+				edges.push_back({ top.X, top.Y, bottom.Y, (bottom.X - top.X) / (bottom.Y - top.Y), a.Y < b.Y ? 1 : -1 });
+			}
+		}
+
+		auto left = (std::max)(static_cast<int>(std::floor(minX)), m_clipLeft);
+		auto right = (std::min)(static_cast<int>(std::ceil(maxX)), m_clipRight);
+		auto top = (std::max)(static_cast<int>(std::floor(minY)), m_clipTop);
+		auto bottom = (std::min)(static_cast<int>(std::ceil(maxY)), m_clipBottom);
+		if (left >= right || top >= bottom || edges.empty())
+		{
+			return;
+		}
+
+		auto width = static_cast<size_t>(right - left);
+		cells.assign(width + 1, 0);
+		runs.assign(width + 1, 0);
+		auto clipLeft = static_cast<float>(left);
+		auto clipRight = static_cast<float>(right);
+
+		auto addSpan = [&](float a, float b)
+		{
+			a = (std::max)(a, clipLeft);
+			b = (std::min)(b, clipRight);
+			if (b <= a)
+			{
+				return;
+			}
+
+			auto first = static_cast<int>(a);
+			auto last = static_cast<int>(b);
+			auto firstIndex = first - left;
+			if (first == last)
+			{
+				cells[firstIndex] += static_cast<int32_t>((b - a) * SubsampleCoverage);
+				return;
+			}
+
+			// Partial end pixels go to cells, the fully covered pixels in between to runs (prefix summed later).
+			cells[firstIndex] += static_cast<int32_t>((first + 1 - a) * SubsampleCoverage);
+			runs[firstIndex + 1] += SubsampleCoverage;
+			runs[last - left] -= SubsampleCoverage;
+			cells[last - left] += static_cast<int32_t>((b - last) * SubsampleCoverage);
+		};
+
+		bool aliased = m_surface.m_aliased;
+		for (int y = top; y < bottom; ++y)
+		{
+			for (int sample = 0; sample < Subsamples; ++sample)
+			{
+				auto sampleY = y + (sample + 0.5f) / Subsamples;
+				crossings.clear();
+				for (auto& edge : edges)
+				{
+					if (sampleY >= edge.Top && sampleY < edge.Bottom)
+					{
+						crossings.push_back({ edge.X + (sampleY - edge.Top) * edge.Slope, edge.Direction });
+					}
+				}
+
+				std::sort(crossings.begin(), crossings.end(), [](const Crossing& a, const Crossing& b) { return a.X < b.X; });
+
+				int winding = 0;
+				float spanStart = 0.0f;
+				for (auto& crossing : crossings)
+				{
+					bool wasInside = rule == FillRule::NonZero ? winding != 0 : (winding & 1) != 0;
+					winding += crossing.Direction;
+					bool isInside = rule == FillRule::NonZero ? winding != 0 : (winding & 1) != 0;
+					if (!wasInside && isInside)
+					{
+						spanStart = crossing.X;
+					}
+					else if (wasInside && !isInside)
+					{
+						addSpan(spanStart, crossing.X);
+					}
+				}
+			}
+
+			auto row = GetRow(y) + left;
+			int32_t run = 0;
+			size_t spanStart = 0;
+			bool inSpan = false;
+			for (size_t x = 0; x <= width; ++x)
+			{
+				int32_t coverage = 0;
+				if (x < width)
+				{
+					run += runs[x];
+					coverage = (std::min)(cells[x] + run, FullCoverage);
+					if (aliased)
+					{
+						coverage = coverage * 2 >= FullCoverage ? FullCoverage : 0;
+					}
+				}
+
+				if (coverage == FullCoverage)
+				{
+					if (!inSpan)
+					{
+						spanStart = x;
+						inSpan = true;
+					}
+					continue;
+				}
+
+				if (inSpan)
+				{
+					FillSpan(row + spanStart, x - spanStart, color);
+					inSpan = false;
+				}
+
+				if (coverage > 0)
+				{
+					row[x] = SourceOver(row[x], Scale(color, static_cast<uint32_t>(coverage * 255 / FullCoverage)));
+				}
+			}
+
+			std::fill(cells.begin(), cells.end(), 0);
+			std::fill(runs.begin(), runs.end(), 0);
+		}
+	}
+
+	void Rasterizer::StrokeLine(const PointF& point1, const PointF& point2, float strokeWidth, uint32_t color, bool dashed)
+	{
+		Path path;
+		if (!dashed)
+		{
+			path.AddLine(point1, point2, strokeWidth);
+			FillPath(path, color);
+			return;
+		}
+
+		// Same pattern as D2D1_DASH_STYLE_DASH: dashes and gaps of twice the stroke width.
+		auto dx = point2.X - point1.X;
+		auto dy = point2.Y - point1.Y;
+		auto length = std::sqrt(dx * dx + dy * dy);
+		auto dash = (std::max)(strokeWidth, 1.0f) * 2.0f;
+		for (float start = 0.0f; start < length; start += dash * 2.0f)
+		{
+			auto end = (std::min)(start + dash, length);
+			path.AddLine({ point1.X + dx * start / length, point1.Y + dy * start / length }, { point1.X + dx * end / length, point1.Y + dy * end / length }, strokeWidth);
+		}
+		FillPath(path, color);
+	}
+
+	void Rasterizer::Blit(const Rectangle& destination, const PaintNativeHandle& source, const Point& sourcePoint, uint32_t opacity)
+	{
+		if (source.m_pixels.empty() || opacity == 0)
+		{
+			return;
+		}
+
+		auto left = (std::max)({ destination.X, m_clipLeft, destination.X - sourcePoint.X });
+		auto top = (std::max)({ destination.Y, m_clipTop, destination.Y - sourcePoint.Y });
+		auto right = (std::min)({ destination.X + static_cast<int>(destination.Width), m_clipRight, destination.X - sourcePoint.X + static_cast<int>(source.m_size.Width) });
+		auto bottom = (std::min)({ destination.Y + static_cast<int>(destination.Height), m_clipBottom, destination.Y - sourcePoint.Y + static_cast<int>(source.m_size.Height) });
+		if (left >= right || top >= bottom)
+		{
+			return;
+		}
+
+		auto offsetX = sourcePoint.X - destination.X;
+		auto offsetY = sourcePoint.Y - destination.Y;
+		for (int y = top; y < bottom; ++y)
+		{
+			auto sourceRow = source.m_pixels.data() + static_cast<size_t>(y + offsetY) * source.m_size.Width + (left + offsetX);
+			BlendSpan(GetRow(y) + left, sourceRow, static_cast<size_t>(right - left), opacity);
+		}
+	}
+
+	void Rasterizer::DrawString(const Point& position, const std::wstring& str, uint32_t color)
+	{
+		if (color == 0 || m_clipLeft >= m_clipRight || m_clipTop >= m_clipBottom)
+		{
+			return;
+		}
+
+		auto scale = static_cast<float>(m_surface.m_fontSize) / DefaultFont::PixelSize;
+		auto baseline = position.Y + static_cast<int>(std::lround(DefaultFont::Ascender * scale));
+		float penX = static_cast<float>(position.X);
+
+		for (auto character : str)
+		{
+			auto glyph = DefaultFont::GetGlyph(character);
+			if (!glyph)
+			{
+				continue;
+			}
+
+			auto coverage = DefaultFont::GetCoverage(*glyph);
+			auto glyphLeft = penX + glyph->Left * scale;
+			auto glyphTop = baseline - glyph->Top * scale;
+			penX += glyph->Advance / 64.0f * scale;
+			if (glyph->Width == 0)
+			{
+				continue;
+			}
+
+			auto left = (std::max)(static_cast<int>(std::floor(glyphLeft)), m_clipLeft);
+			auto top = (std::max)(static_cast<int>(std::floor(glyphTop)), m_clipTop);
+			auto right = (std::min)(static_cast<int>(std::ceil(glyphLeft + glyph->Width * scale)), m_clipRight);
+			auto bottom = (std::min)(static_cast<int>(std::ceil(glyphTop + glyph->Height * scale)), m_clipBottom);
+
+			auto sample = [&](int u, int v) -> uint32_t
+			{
+				if (u < 0 || v < 0 || u >= glyph->Width || v >= glyph->Height)
+				{
+					return 0;
+				}
+				return coverage[v * glyph->Width + u];
+			};
+
+			if (m_surface.m_fontSize == DefaultFont::PixelSize)
+			{
+				auto originX = static_cast<int>(std::lround(glyphLeft));
+				auto originY = static_cast<int>(std::lround(glyphTop));
+				left = (std::max)(originX, m_clipLeft);
+				right = (std::min)(originX + static_cast<int>(glyph->Width), m_clipRight);
+				bottom = (std::min)(originY + static_cast<int>(glyph->Height), m_clipBottom);
+				for (int y = (std::max)(originY, m_clipTop); y < bottom; ++y)
+				{
+					auto row = GetRow(y);
+					auto coverageRow = coverage + (y - originY) * glyph->Width - originX;
+					for (int x = left; x < right; ++x)
+					{
+						if (coverageRow[x] > 0)
+						{
+							row[x] = SourceOver(row[x], Scale(color, coverageRow[x]));
+						}
+					}
+				}
+				continue;
+			}
+
+			for (int y = top; y < bottom; ++y)
+			{
+				auto row = GetRow(y);
+				// Bilinear sampling of the baked coverage, exact copy at the native size.
+				auto v = (y + 0.5f - glyphTop) / scale - 0.5f;
+				auto v0 = static_cast<int>(std::floor(v));
+				auto fv = v - v0;
+				for (int x = left; x < right; ++x)
+				{
+					auto u = (x + 0.5f - glyphLeft) / scale - 0.5f;
+					auto u0 = static_cast<int>(std::floor(u));
+					auto fu = u - u0;
+					auto value = (sample(u0, v0) * (1.0f - fu) + sample(u0 + 1, v0) * fu) * (1.0f - fv) +
+						(sample(u0, v0 + 1) * (1.0f - fu) + sample(u0 + 1, v0 + 1) * fu) * fv;
+
+					auto alpha = static_cast<uint32_t>(value + 0.5f);
+					if (alpha > 0)
+					{
+						row[x] = SourceOver(row[x], Scale(color, (std::min)(alpha, 255u)));
+					}
+				}
+			}
+		}
+	}
+
+	void Rasterizer::FillSpan(uint32_t* destination, size_t count, uint32_t color)
+	{
+		size_t i = 0;
+		auto alpha = color >> 24;
+#ifdef BT_RASTERIZER_SSE2
+		auto source = _mm_set1_epi32(static_cast<int>(color));
+		if (alpha == 255)
+		{
+			for (; i + 4 <= count; i += 4)
+			{
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i), source);
+			}
+		}
+		else
+		{
+			auto inverse = _mm_set1_epi16(static_cast<short>(255 - alpha));
+			for (; i + 4 <= count; i += 4)
+			{
+				auto pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(destination + i));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i), _mm_add_epi8(source, ScaleByLanes(pixels, inverse, inverse)));
+			}
+		}
+#endif
+		if (alpha == 255)
+		{
+			std::fill(destination + i, destination + count, color);
+			return;
+		}
+
+		for (; i < count; ++i)
+		{
+			destination[i] = SourceOver(destination[i], color);
+		}
+	}
+
+	void Rasterizer::BlendSpan(uint32_t* destination, const uint32_t* source, size_t count, uint32_t opacity)
+	{
+		size_t i = 0;
+#ifdef BT_RASTERIZER_SSE2
+		auto zero = _mm_setzero_si128();
+		auto ones = _mm_set1_epi32(-1);
+		auto maximum = _mm_set1_epi16(255);
+		auto factor = _mm_set1_epi16(static_cast<short>(opacity));
+		for (; i + 4 <= count; i += 4)
+		{
+			auto pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i));
+			auto alphas = _mm_srli_epi32(pixels, 24);
+			auto transparent = _mm_movemask_epi8(_mm_cmpeq_epi32(alphas, zero));
+			if (transparent == 0xFFFF)
+			{
+				continue;
+			}
+
+			if (opacity == 255 && _mm_movemask_epi8(_mm_cmpeq_epi32(_mm_or_si128(pixels, _mm_set1_epi32(0x00FFFFFF)), ones)) == 0xFFFF)
+			{
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i), pixels);
+				continue;
+			}
+
+			if (opacity != 255)
+			{
+				pixels = ScaleByLanes(pixels, factor, factor);
+			}
+
+			auto inverseLow = _mm_sub_epi16(maximum, BroadcastAlpha(_mm_unpacklo_epi8(pixels, zero)));
+			auto inverseHigh = _mm_sub_epi16(maximum, BroadcastAlpha(_mm_unpackhi_epi8(pixels, zero)));
+			auto target = _mm_loadu_si128(reinterpret_cast<const __m128i*>(destination + i));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i), _mm_add_epi8(pixels, ScaleByLanes(target, inverseLow, inverseHigh)));
+		}
+#endif
+		for (; i < count; ++i)
+		{
+			auto pixel = opacity == 255 ? source[i] : Scale(source[i], opacity);
+			if (pixel >> 24 == 255)
+			{
+				destination[i] = pixel;
+			}
+			else if (pixel != 0)
+			{
+				destination[i] = SourceOver(destination[i], pixel);
+			}
+		}
+	}
+
+	uint32_t* Rasterizer::GetRow(int y) const
+	{
+		return m_surface.m_pixels.data() + static_cast<size_t>(y) * m_surface.m_size.Width;
+	}
+}
\ No newline at end of file
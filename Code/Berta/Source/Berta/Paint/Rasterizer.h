@@ -0,0 +1,84 @@
+/*
+* MIT License
+*
+* Copyright (c) 2024 Edgar Bernal (edgar.bernal@gmail.com)
+*/
+
+#ifndef BT_RASTERIZER_HEADER
+#define BT_RASTERIZER_HEADER
+
+#include <string>
+#include <vector>
+#include "Berta/Core/BasicTypes.h"
+
+namespace Berta
+{
+	struct PaintNativeHandle;
+
+	/*
+	* Software backend of Graphics (non Windows platforms). Draws into PaintNativeHandle::m_pixels,
+	* BGRA8 with premultiplied alpha, clipped to the surface and to the innermost PushClip rectangle.
+	* Shapes are filled through a coverage buffer (4 sub-scanlines, exact horizontal coverage),
+	* fully covered runs go through the SIMD span loops.
+	*/
+	class Rasterizer
+	{
+	public:
+		enum class FillRule
+		{
+			NonZero,
+			EvenOdd
+		};
+
+		struct PointF
+		{
+			float X;
+			float Y;
+		};
+
+		class Path
+		{
+		public:
+			void MoveTo(float x, float y);
+			void LineTo(float x, float y);
+			void AddPolygon(const PointF* points, size_t count);
+			void AddEllipse(float centerX, float centerY, float radiusX, float radiusY);
+			void AddRoundRectangle(float left, float top, float right, float bottom, float radius);
+			void AddLine(const PointF& point1, const PointF& point2, float strokeWidth);
+
+			bool IsEmpty() const { return m_points.empty(); }
+
+		private:
+			friend class Rasterizer;
+
+			std::vector<PointF> m_points;
+			std::vector<size_t> m_contourStarts;
+		};
+
+		Rasterizer(PaintNativeHandle& surface);
+
+		static uint32_t ToPremultiplied(const Color& color);
+
+		void FillRectangle(const Rectangle& rect, uint32_t color);
+		void FillVerticalGradient(const Rectangle& rect, uint32_t startColor, uint32_t endColor);
+		void FillPath(const Path& path, uint32_t color, FillRule rule = FillRule::NonZero);
+		void StrokeLine(const PointF& point1, const PointF& point2, float strokeWidth, uint32_t color, bool dashed);
+		void Blit(const Rectangle& destination, const PaintNativeHandle& source, const Point& sourcePoint, uint32_t opacity);
+		void DrawString(const Point& position, const std::wstring& str, uint32_t color);
+
+		// Source-over of a premultiplied color on a span, and of a premultiplied span scaled by opacity (0-255).
+		static void FillSpan(uint32_t* destination, size_t count, uint32_t color);
+		static void BlendSpan(uint32_t* destination, const uint32_t* source, size_t count, uint32_t opacity);
+
+	private:
+		uint32_t* GetRow(int y) const;
+
+		PaintNativeHandle& m_surface;
+		int m_clipLeft{ 0 };
+		int m_clipTop{ 0 };
+		int m_clipRight{ 0 };
+		int m_clipBottom{ 0 };
+	};
+}
+
+#endif
\ No newline at end of file
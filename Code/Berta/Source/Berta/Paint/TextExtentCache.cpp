@@ -0,0 +1,121 @@
+/*
+* MIT License
+*
+* Copyright (c) 2024 Edgar Bernal (edgar.bernal@gmail.com)
+*/
+
+#include "btpch.h"
+#include "TextExtentCache.h"
+
+#include <memory>
+#include <vector>
+
+namespace Berta
+{
+	namespace
+	{
+		// Few fonts and DPIs are ever in use, a linear search is enough.
+		std::vector<std::pair<TextExtentCache::FontKey, std::unique_ptr<TextExtentCache>>>& GetCaches()
+		{
+			static std::vector<std::pair<TextExtentCache::FontKey, std::unique_ptr<TextExtentCache>>> caches;
+			return caches;
+		}
+	}
+
+	TextExtentCache::TextExtentCache() :
+		m_extents(Capacity)
+	{
+	}
+
+	TextExtentCache& TextExtentCache::Get(const FontKey& key)
+	{
+		auto& caches = GetCaches();
+		for (auto& [fontKey, cache] : caches)
+		{
+			if (fontKey == key)
+			{
+				return *cache;
+			}
+		}
+
+		caches.emplace_back(key, std::make_unique<TextExtentCache>());
+		return *caches.back().second;
+	}
+
+	TextExtentCache::Statistics TextExtentCache::GetTotalStatistics()
+	{
+		Statistics total;
+		for (auto& [fontKey, cache] : GetCaches())
+		{
+			auto statistics = cache->GetStatistics();
+			total.AsciiHits += statistics.AsciiHits;
+			total.Hits += statistics.Hits;
+			total.Misses += statistics.Misses;
+			total.Evictions += statistics.Evictions;
+		}
+		return total;
+	}
+
+	void TextExtentCache::ResetTotalStatistics()
+	{
+		for (auto& [fontKey, cache] : GetCaches())
+		{
+			cache->ResetStatistics();
+		}
+	}
+
+	TextExtentCache::Statistics TextExtentCache::GetStatistics() const
+	{
+		auto& extentStatistics = m_extents.GetStatistics();
+		Statistics statistics;
+		statistics.AsciiHits = m_asciiHits;
+		statistics.Hits = extentStatistics.Hits;
+		statistics.Misses = extentStatistics.Misses;
+		statistics.Evictions = extentStatistics.Evictions;
+		return statistics;
+	}
+
+	void TextExtentCache::ResetStatistics()
+	{
+		m_extents.ResetStatistics();
+		m_asciiHits = 0;
+	}
+
+	bool TextExtentCache::SumAsciiAdvances(std::wstring_view text, double& width) const
+	{
+		width = 0.0;
+		double trailingWhitespace = 0.0;
+		for (auto character : text)
+		{
+			if (character < FirstAscii || character > LastAscii)
+			{
+				return false;
+			}
+
+			double advance = m_asciiAdvances.Advances[character - FirstAscii];
+			width += advance;
+			trailingWhitespace = character == L' ' ? trailingWhitespace + advance : 0.0;
+		}
+
+		if (m_asciiAdvances.ExcludesTrailingWhitespace)
+		{
+			width -= trailingWhitespace;
+		}
+
+		width *= m_asciiAdvances.Scale;
+		return true;
+	}
+
+	bool TextExtentCache::MeasureAscii(std::wstring_view text, Size& extent) const
+	{
+		double width = 0.0;
+		if (!SumAsciiAdvances(text, width))
+		{
+			return false;
+		}
+
+		extent.Width = static_cast<uint32_t>(std::ceil(width));
+		extent.Height = m_asciiAdvances.LineHeight;
+		return true;
+	}
+}
\ No newline at end of file
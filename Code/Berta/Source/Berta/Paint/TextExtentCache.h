@@ -0,0 +1,168 @@
+/*
+* MIT License
+*
+* Copyright (c) 2024 Edgar Bernal (edgar.bernal@gmail.com)
+*/
+
+#ifndef BT_TEXT_EXTENT_CACHE_HEADER
+#define BT_TEXT_EXTENT_CACHE_HEADER
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <string>
+#include <string_view>
+#include "Berta/Core/BasicTypes.h"
+#include "Berta/Core/LruCache.h"
+
+namespace Berta
+{
+	/*
+	* Measured text extents of one font at one DPI, shared by every PaintNativeHandle built with it
+	* (see Graphics::BuildFont). Printable ASCII is summed from a per character advance table when the
+	* font allows it, anything else is measured once and kept in an LRU keyed by the string.
+	*/
+	class TextExtentCache
+	{
+	public:
+		static constexpr size_t Capacity = 2048;
+		static constexpr wchar_t FirstAscii = L' ';
+		static constexpr wchar_t LastAscii = L'~';
+		static constexpr size_t AsciiCount = LastAscii - FirstAscii + 1;
+
+		struct FontKey
+		{
+			std::wstring Family;
+			float Size{ 0.0f };
+			uint32_t Dpi{ 96u };
+
+			bool operator==(const FontKey& other) const
+			{
+				return Family == other.Family && Size == other.Size && Dpi == other.Dpi;
+			}
+		};
+
+		struct Statistics
+		{
+			uint64_t AsciiHits{ 0 };	// Summed from the advance table, no lookup.
+			uint64_t Hits{ 0 };
+			uint64_t Misses{ 0 };		// Measured by the font backend.
+			uint64_t Evictions{ 0 };
+		};
+
+		struct AsciiAdvances
+		{
+			float Advances[AsciiCount]{};	// Pixels, before Scale.
+			double Scale{ 1.0 };			// Applied to the sum, then rounded up.
+			uint32_t LineHeight{ 0 };
+			bool ExcludesTrailingWhitespace{ false };	// Like DWRITE_TEXT_METRICS::width.
+		};
+
+		// What the font backend measured before rounding: the width is compared to the summed advances.
+		struct LayoutExtent
+		{
+			double Width{ 0.0 };
+			uint32_t Height{ 0 };
+		};
+
+		// Pixels. Summing float advances drifts a little from the layout width, kerning moves it further.
+		static constexpr double AsciiTolerance = 0.01;
+
+		TextExtentCache();
+		TextExtentCache(const TextExtentCache&) = delete;
+		TextExtentCache& operator=(const TextExtentCache&) = delete;
+
+		// Created on first use, they live until the end of the process (one per font and DPI in use).
+		static TextExtentCache& Get(const FontKey& key);
+		static Statistics GetTotalStatistics();
+		static void ResetTotalStatistics();
+
+		/*
+		* Enables the ASCII path if summing the advances gives the unrounded width the measurer gives
+		* for a few probe strings, within AsciiTolerance (kerning and ligatures make them differ). The
+		* widths are compared before rounding up, a difference hidden by it on the probes would show
+		* up on other strings. Either way it is only tried once per cache.
+		* The measurer is bool(const std::wstring& text, LayoutExtent& extent).
+		*/
+		template <typename Measurer>
+		bool SetAsciiAdvances(const AsciiAdvances& asciiAdvances, Measurer&& measurer)
+		{
+			m_asciiResolved = true;
+			m_asciiAdvances = asciiAdvances;
+			for (auto probe : AsciiProbes)
+			{
+				std::wstring text(probe);
+				double width = 0.0;
+				LayoutExtent layoutExtent;
+				if (!SumAsciiAdvances(text, width) || !measurer(text, layoutExtent) ||
+					std::abs(width - layoutExtent.Width) > AsciiTolerance || layoutExtent.Height != m_asciiAdvances.LineHeight)
+				{
+					return false;
+				}
+			}
+
+			m_hasAsciiAdvances = true;
+			return true;
+		}
+
+		bool IsAsciiResolved() const { return m_asciiResolved; }
+		bool HasAsciiAdvances() const { return m_hasAsciiAdvances; }
+
+		template <typename Measurer>
+		Size Measure(const std::wstring& str, size_t length, Measurer&& measurer)
+		{
+			std::wstring_view text(str.data(), (std::min)(length, str.size()));
+
+			Size extent;
+			if (m_hasAsciiAdvances && MeasureAscii(text, extent))
+			{
+				++m_asciiHits;
+				return extent;
+			}
+
+			if (auto cached = m_extents.Find(text))
+			{
+				return *cached;
+			}
+
+			extent = measurer(str, text.size());
+			m_extents.Insert(std::wstring(text), extent);
+			return extent;
+		}
+
+		Statistics GetStatistics() const;
+		void ResetStatistics();
+		void Clear() { m_extents.Clear(); }
+
+	private:
+		struct TextHash
+		{
+			using is_transparent = void;
+
+			size_t operator()(std::wstring_view text) const
+			{
+				return std::hash<std::wstring_view>{}(text);
+			}
+		};
+
+		static constexpr const wchar_t* AsciiProbes[] =
+		{
+			L"The quick brown fox jumps over the lazy dog.",
+			L"AVATAR Today, WAVE Yo; fi ff ffi fl ",
+			L"0123456789 +-*/=%$#@!? ",
+			L"{}[]()<>\"'`~^|\\_&:;,",
+			L"  "
+		};
+
+		bool SumAsciiAdvances(std::wstring_view text, double& width) const;	// Scaled, before rounding up.
+		bool MeasureAscii(std::wstring_view text, Size& extent) const;
+
+		LruCache<std::wstring, Size, TextHash, std::equal_to<>> m_extents;
+		AsciiAdvances m_asciiAdvances;
+		bool m_asciiResolved{ false };
+		bool m_hasAsciiAdvances{ false };
+		uint64_t m_asciiHits{ 0 };
+	};
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,595 @@
+/*
+* MIT License
+*
+* Copyright (c) 2024 Edgar Bernal (edgar.bernal@gmail.com)
+*/
+
+#include "btpch.h"
+#include "Berta/Core/Foundation.h"
+
+#ifndef BT_PLATFORM_WINDOWS
+
+#include "Berta/Core/Base.h"
+#include "Berta/Core/Log.h"
+#include "Berta/GUI/Window.h"
+#include "Berta/GUI/ControlEvents.h"
+#include "Berta/GUI/EnumTypes.h"
+#include "Berta/Platform/Headless/VirtualDisplay.h"
+#ifdef BT_PLATFORM_X11
+#include "Berta/Platform/X11/X11Display.h"
+#endif
+
+#include "Berta/Controls/Menu.h"
+#include "Berta/Controls/MenuBar.h"
+#include "Berta/Paint/DrawBatch.h"
+
+// Window procedure of the headless backend (see VirtualDisplay), it mirrors Foundation_Win32.cpp.
+// With BT_PLATFORM_X11 and a $DISPLAY the virtual display mirrors real X windows (see X11Display).
+namespace Berta
+{
+	Foundation Foundation::g_foundation;
+
+	void Foundation_DispatchNativeEvent(NativeEvent& nativeEvent);
+	void DispatchInputEvent(const InputEvent& inputEvent);
+
+	Foundation::Foundation()
+	{
+		InitializeCore();
+		BT_CORE_TRACE << "Foundation init (headless)..." << std::endl;
+
+		m_messageLoop.SetTimerSource(&m_timerWheel);
+		m_inputQueue.SetDispatcher([](const InputEvent& inputEvent)
+		{
+			DispatchInputEvent(inputEvent);
+		});
+
+		VirtualDisplay::GetInstance().Attach(m_messageLoop, [](NativeEvent& nativeEvent)
+		{
+			Foundation_DispatchNativeEvent(nativeEvent);
+		});
+#ifdef BT_PLATFORM_X11
+		X11Display::GetInstance().Open(m_messageLoop);
+#endif
+	}
+
+	Foundation::~Foundation()
+	{
+		BT_CORE_TRACE << "Releasing foundation..." << std::endl;
+
+#ifdef BT_PLATFORM_X11
+		X11Display::GetInstance().Close();
+#endif
+		VirtualDisplay::GetInstance().Detach();
+
+		ShutdownCore();
+	}
+
+	void Foundation::ProcessMessages()
+	{
+		m_messageLoop.Run();
+	}
+
+	void ProcessMouseMove(Window* nativeWindow, int x, int y, const MouseButtonState& buttonState)
+	{
+		auto& foundation = Foundation::GetInstance();
+		auto& windowManager = foundation.GetWindowManager();
+		auto& rootWindowData = *windowManager.GetFormData(nativeWindow->RootHandle);
+
+		auto menuItemReactor = windowManager.GetMenu();
+		if (menuItemReactor)
+		{
+			auto currentItemReactor = menuItemReactor;
+			do
+			{
+				auto currentWindow = currentItemReactor->Owner();
+
+				auto screenPosition = API::GetPointClientToScreen(nativeWindow->RootHandle, { x, y });
+				auto localPosition = API::GetPointScreenToClient(currentWindow->RootHandle, screenPosition) - windowManager.GetAbsoluteRootPosition(currentWindow);
+				if (currentWindow->ClientSize.IsInside(localPosition))
+				{
+					if (rootWindowData.Hovered == nullptr)
+					{
+						ArgMouse argMouseEnter;
+						argMouseEnter.Position = localPosition;
+						argMouseEnter.ButtonState = buttonState;
+
+						foundation.ProcessEvents(currentWindow, &Renderer::MouseEnter, &ControlEvents::MouseEnter, argMouseEnter);
+					}
+
+					ArgMouse argMouseMove;
+					argMouseMove.Position = localPosition;
+					argMouseMove.ButtonState = buttonState;
+
+					foundation.ProcessEvents(currentWindow, &Renderer::MouseMove, &ControlEvents::MouseMove, argMouseMove);
+
+					rootWindowData.Hovered = currentWindow;
+					break;
+				}
+
+				currentItemReactor = currentItemReactor->Next();
+			} while (currentItemReactor);
+
+			if (currentItemReactor == nullptr && rootWindowData.Hovered)
+			{
+				ArgMouse argMouseLeave;
+				argMouseLeave.Position = Point{ x, y } - windowManager.GetAbsoluteRootPosition(rootWindowData.Hovered);
+				argMouseLeave.ButtonState = buttonState;
+
+				foundation.ProcessEvents(rootWindowData.Hovered, &Renderer::MouseLeave, &ControlEvents::MouseLeave, argMouseLeave);
+
+				rootWindowData.Hovered = nullptr;
+			}
+		}
+		else
+		{
+			auto window = windowManager.Find(nativeWindow, { x, y });
+			if (window && window != rootWindowData.Hovered)
+			{
+				if (rootWindowData.Hovered && windowManager.Exists(rootWindowData.Hovered))
+				{
+					ArgMouse argMouseLeave;
+					argMouseLeave.Position = Point{ x, y } - windowManager.GetAbsoluteRootPosition(rootWindowData.Hovered);
+					argMouseLeave.ButtonState = buttonState;
+
+					foundation.ProcessEvents(rootWindowData.Hovered, &Renderer::MouseLeave, &ControlEvents::MouseLeave, argMouseLeave);
+				}
+				rootWindowData.Hovered = nullptr;
+			}
+
+			if (window && window->Flags.IsEnabled && !window->Flags.IsDisposed)
+			{
+				Point position = Point{ x, y } - windowManager.GetAbsoluteRootPosition(window);
+				if (window != rootWindowData.Hovered && window->ClientSize.IsInside(position))
+				{
+					ArgMouse argMouseEnter;
+					argMouseEnter.Position = position;
+					argMouseEnter.ButtonState = buttonState;
+
+					foundation.ProcessEvents(window, &Renderer::MouseEnter, &ControlEvents::MouseEnter, argMouseEnter);
+
+					rootWindowData.Hovered = window;
+				}
+
+				if (rootWindowData.Hovered)
+				{
+					ArgMouse argMouseMove;
+					argMouseMove.Position = position;
+					argMouseMove.ButtonState = buttonState;
+
+					foundation.ProcessEvents(window, &Renderer::MouseMove, &ControlEvents::MouseMove, argMouseMove);
+				}
+				// No TrackMouseEvent: VirtualDisplay sends MouseLeave when the mouse moves to another native window.
+			}
+		}
+	}
+
+	void ProcessMouseWheel(Window* nativeWindow, const Point& position, ArgWheel& argWheel)
+	{
+		auto& foundation = Foundation::GetInstance();
+		auto& windowManager = foundation.GetWindowManager();
+
+		auto window = windowManager.Find(nativeWindow, position);
+		if (window)
+		{
+			foundation.ProcessEvents(window, &Renderer::MouseWheel, &ControlEvents::MouseWheel, argWheel);
+		}
+	}
+
+	void ProcessResize(Window* nativeWindow, const Size& newSize)
+	{
+		if (newSize.Width > 0 && newSize.Height > 0)
+		{
+			auto& windowManager = Foundation::GetInstance().GetWindowManager();
+			windowManager.Resize(nativeWindow, newSize, false);
+			windowManager.UpdateTree(nativeWindow);
+		}
+	}
+
+	void ProcessKey(Window* nativeWindow, ArgKeyboard& argKeyboard, bool isKeyReleased)
+	{
+		auto& foundation = Foundation::GetInstance();
+		auto& windowManager = foundation.GetWindowManager();
+		auto& rootWindowData = *windowManager.GetFormData(nativeWindow->RootHandle);
+
+		auto target = rootWindowData.Focused;
+		if (target == nullptr)
+		{
+			target = nativeWindow;
+		}
+
+		auto menuItemReactor = windowManager.GetMenu();
+		if (menuItemReactor)
+		{
+			target = menuItemReactor->Owner();
+		}
+
+		if (isKeyReleased)
+		{
+			foundation.ProcessEvents(target, &Renderer::KeyReleased, &ControlEvents::KeyReleased, argKeyboard);
+		}
+		else
+		{
+			foundation.ProcessEvents(target, &Renderer::KeyPressed, &ControlEvents::KeyPressed, argKeyboard);
+		}
+	}
+
+	bool CanCoalesceInput(Window* window)
+	{
+		return window == nullptr || window->Flags.CoalesceInput;
+	}
+
+	bool ToInputEvent(Window* nativeWindow, WindowManager::FormData& rootWindowData, const NativeEvent& nativeEvent, InputEvent& inputEvent)
+	{
+		if (!nativeWindow->Flags.CoalesceInput)
+		{
+			return false;
+		}
+
+		inputEvent.NativeHandle = nativeWindow->RootHandle;
+		switch (nativeEvent.EventType)
+		{
+		case NativeEvent::Type::MouseMove:
+			if (!CanCoalesceInput(rootWindowData.Hovered) || !CanCoalesceInput(rootWindowData.Pressed))
+			{
+				return false;
+			}
+			inputEvent.EventType = InputEvent::Type::MouseMove;
+			inputEvent.Position = nativeEvent.Position;
+			inputEvent.ButtonState = nativeEvent.ButtonState;
+			return true;
+
+		case NativeEvent::Type::MouseWheel:
+			if (!CanCoalesceInput(rootWindowData.Hovered))
+			{
+				return false;
+			}
+			inputEvent.EventType = InputEvent::Type::MouseWheel;
+			inputEvent.Position = nativeEvent.Position;
+			inputEvent.Wheel.WheelDelta = nativeEvent.WheelDelta;
+			inputEvent.Wheel.IsVertical = nativeEvent.IsVertical;
+			return true;
+
+		case NativeEvent::Type::Resize:
+			// Programmatic resizes expect the new size right away, only the interactive sizing loop is deferred.
+			if (!rootWindowData.IsSizeMoving)
+			{
+				return false;
+			}
+			inputEvent.EventType = InputEvent::Type::Resize;
+			inputEvent.NewSize = nativeEvent.NewSize;
+			return true;
+
+		case NativeEvent::Type::KeyDown:
+			if (!CanCoalesceInput(rootWindowData.Focused))
+			{
+				return false;
+			}
+			inputEvent.EventType = InputEvent::Type::KeyPressed;
+			inputEvent.Keyboard.ButtonState = nativeEvent.Modifiers;
+			inputEvent.Keyboard.Key = nativeEvent.Key;
+			inputEvent.Keyboard.RepeatCount = 1;
+			inputEvent.IsAutoRepeat = nativeEvent.IsAutoRepeat;
+			return true;
+
+		default:
+			break;
+		}
+		return false;
+	}
+
+	void DispatchInputEvent(const InputEvent& inputEvent)
+	{
+		auto& windowManager = Foundation::GetInstance().GetWindowManager();
+		auto nativeWindow = windowManager.Get(inputEvent.NativeHandle);
+		if (nativeWindow == nullptr)
+		{
+			return;
+		}
+
+		DrawBatch drawBatch(nativeWindow);
+		Foundation::RootGuard rootGuard(nativeWindow);
+
+		switch (inputEvent.EventType)
+		{
+		case InputEvent::Type::MouseMove:
+			ProcessMouseMove(nativeWindow, inputEvent.Position.X, inputEvent.Position.Y, inputEvent.ButtonState);
+			break;
+		case InputEvent::Type::MouseWheel:
+		{
+			auto argWheel = inputEvent.Wheel;
+			ProcessMouseWheel(nativeWindow, inputEvent.Position, argWheel);
+			break;
+		}
+		case InputEvent::Type::Resize:
+			ProcessResize(nativeWindow, inputEvent.NewSize);
+			break;
+		case InputEvent::Type::KeyPressed:
+		{
+			auto argKeyboard = inputEvent.Keyboard;
+			ProcessKey(nativeWindow, argKeyboard, false);
+			break;
+		}
+		}
+	}
+
+	void Foundation_DispatchNativeEvent(NativeEvent& nativeEvent)
+	{
+		auto& foundation = Foundation::GetInstance();
+		auto& windowManager = foundation.GetWindowManager();
+		auto nativeWindow = windowManager.Get(nativeEvent.Target);
+		if (nativeWindow == nullptr)
+		{
+			return;
+		}
+
+		auto& rootWindowData = *windowManager.GetFormData(nativeEvent.Target);
+
+		auto& inputQueue = foundation.GetInputQueue();
+		InputEvent inputEvent;
+		if (ToInputEvent(nativeWindow, rootWindowData, nativeEvent, inputEvent))
+		{
+			foundation.QueueInput(inputEvent);
+			return;
+		}
+
+		// Everything else must see the queued input first.
+		inputQueue.Flush();
+
+		DrawBatch drawBatch(nativeWindow);
+		Berta::Foundation::RootGuard rootGuard(nativeWindow);
+
+		switch (nativeEvent.EventType)
+		{
+		case NativeEvent::Type::Callback:
+		{
+			if (nativeEvent.Callback)
+			{
+				nativeEvent.Callback();
+			}
+			break;
+		}
+		case NativeEvent::Type::Activated:
+		{
+			ArgActivated argActivated{};
+			argActivated.IsActivated = nativeEvent.Flag;
+			if (auto events = dynamic_cast<FormEvents*>(nativeWindow->Events.get()))
+			{
+				events->Activated.Emit(argActivated);
+			}
+			break;
+		}
+		case NativeEvent::Type::Show:
+		{
+			bool isVisible = nativeEvent.Flag;
+			if (nativeWindow->Visible != isVisible)
+			{
+				nativeWindow->Visible = isVisible;
+
+				ArgVisibility argVisibility;
+				argVisibility.IsVisible = isVisible;
+				if (nativeWindow->Events)
+				{
+					nativeWindow->Events->Visibility.Emit(argVisibility);
+				}
+
+				auto targetWindow = isVisible ? nativeWindow : nativeWindow->FindFirstNonPanelAncestor();
+				if (targetWindow)
+				{
+					windowManager.UpdateTree(targetWindow);
+				}
+			}
+			break;
+		}
+		case NativeEvent::Type::Paint:
+		{
+			nativeWindow->Renderer.Map(nativeWindow, nativeEvent.Area);  // Copy from control's graphics to the framebuffer.
+			break;
+		}
+		case NativeEvent::Type::Move:
+		{
+			ArgMove argMove;
+			argMove.NewPosition = nativeEvent.Position;
+			foundation.ProcessEvents(nativeWindow, &Renderer::Move, &ControlEvents::Move, argMove);
+			break;
+		}
+		case NativeEvent::Type::Resize:
+		{
+			ProcessResize(nativeWindow, nativeEvent.NewSize);
+			break;
+		}
+		case NativeEvent::Type::DpiChanged:
+		{
+			windowManager.ChangeDPI(nativeWindow, nativeEvent.Dpi, nativeWindow->RootHandle);
+
+			auto& area = nativeEvent.Area;
+			VirtualDisplay::GetInstance().Move(nativeEvent.Target.Handle, { area.X, area.Y }, { area.Width, area.Height });
+
+			//This is called inside Resize method of WindowManager.
+			windowManager.UpdateTree(nativeWindow);
+			break;
+		}
+		case NativeEvent::Type::Focus:
+		{
+			if (rootWindowData.Focused)
+			{
+				ArgFocus argFocus{ nativeEvent.Flag };
+				foundation.ProcessEvents(rootWindowData.Focused, &Renderer::Focus, &ControlEvents::Focus, argFocus);
+			}
+			break;
+		}
+		case NativeEvent::Type::MouseDown:
+		{
+			auto window = windowManager.Find(nativeWindow, nativeEvent.Position);
+			if (window && window->Flags.IsEnabled)
+			{
+				rootWindowData.Pressed = window;
+
+				ArgMouse argMouseDown;
+				argMouseDown.Position = nativeEvent.Position - windowManager.GetAbsoluteRootPosition(window);
+				argMouseDown.ButtonState = nativeEvent.ButtonState;
+
+				foundation.ProcessEvents(window, &Renderer::MouseDown, &ControlEvents::MouseDown, argMouseDown);
+
+				auto focusWindow = window->Flags.MakeActive ? window : window->MakeTargetWhenInactive;
+				if (focusWindow && !focusWindow->Flags.IgnoreMouseFocus)
+				{
+					if (rootWindowData.Focused != focusWindow)
+					{
+						if (rootWindowData.Focused)
+						{
+							ArgFocus argFocus{ false };
+							foundation.ProcessEvents(rootWindowData.Focused, &Renderer::Focus, &ControlEvents::Focus, argFocus);
+						}
+						if (focusWindow)
+						{
+							ArgFocus argFocus{ true };
+							foundation.ProcessEvents(focusWindow, &Renderer::Focus, &ControlEvents::Focus, argFocus);
+						}
+					}
+					rootWindowData.Focused = focusWindow;
+				}
+			}
+			break;
+		}
+		case NativeEvent::Type::MouseMove:
+		{
+			ProcessMouseMove(nativeWindow, nativeEvent.Position.X, nativeEvent.Position.Y, nativeEvent.ButtonState);
+			break;
+		}
+		case NativeEvent::Type::MouseUp:
+		{
+			auto window = windowManager.Find(nativeWindow, nativeEvent.Position);
+			if (window && window->Flags.IsEnabled)
+			{
+				ArgMouse argMouseUp;
+				argMouseUp.Position = nativeEvent.Position - windowManager.GetAbsoluteRootPosition(window);
+				argMouseUp.ButtonState.LeftButton = nativeEvent.ChangedButton == NativeEvent::Button::Left;
+				argMouseUp.ButtonState.RightButton = nativeEvent.ChangedButton == NativeEvent::Button::Right;
+				argMouseUp.ButtonState.MiddleButton = nativeEvent.ChangedButton == NativeEvent::Button::Middle;
+
+				if (window->ClientSize.IsInside(argMouseUp.Position))
+				{
+					ArgClick argClick;
+					foundation.ProcessEvents(window, &Renderer::Click, &ControlEvents::Click, argClick);
+				}
+
+				foundation.ProcessEvents(window, &Renderer::MouseUp, &ControlEvents::MouseUp, argMouseUp);
+
+				rootWindowData.Released = rootWindowData.Pressed;
+			}
+			rootWindowData.Pressed = nullptr;
+			break;
+		}
+		case NativeEvent::Type::DoubleClick:
+		{
+			auto window = windowManager.Find(nativeWindow, nativeEvent.Position);
+			if (window && window->Flags.IsEnabled && window == rootWindowData.Released)
+			{
+				ArgMouse argMouse{};
+				argMouse.Position = nativeEvent.Position - windowManager.GetAbsoluteRootPosition(window);
+				argMouse.ButtonState = nativeEvent.ButtonState;
+
+				foundation.ProcessEvents(window, &Renderer::DblClick, &ControlEvents::DblClick, argMouse);
+			}
+			rootWindowData.Released = nullptr;
+			break;
+		}
+		case NativeEvent::Type::MouseLeave:
+		{
+			if (rootWindowData.Hovered && windowManager.Exists(rootWindowData.Hovered))
+			{
+				ArgMouse argMouseLeave;
+				foundation.ProcessEvents(rootWindowData.Hovered, &Renderer::MouseLeave, &ControlEvents::MouseLeave, argMouseLeave);
+
+				rootWindowData.Hovered = nullptr;
+			}
+			break;
+		}
+		case NativeEvent::Type::MouseWheel:
+		{
+			ArgWheel argWheel{};
+			argWheel.WheelDelta = nativeEvent.WheelDelta;
+			argWheel.IsVertical = nativeEvent.IsVertical;
+
+			ProcessMouseWheel(nativeWindow, nativeEvent.Position, argWheel);
+			break;
+		}
+		case NativeEvent::Type::Char:
+		{
+			ArgKeyboard argKeyboard{};
+			argKeyboard.ButtonState = nativeEvent.Modifiers;
+			argKeyboard.Key = nativeEvent.Key;
+
+			auto window = rootWindowData.Focused;
+			if (window == nullptr)
+			{
+				window = nativeWindow;
+			}
+
+			foundation.ProcessEvents(window, &Renderer::KeyChar, &ControlEvents::KeyChar, argKeyboard);
+			break;
+		}
+		case NativeEvent::Type::KeyDown:
+		case NativeEvent::Type::KeyUp:
+		{
+			ArgKeyboard argKeyboard{};
+			argKeyboard.ButtonState = nativeEvent.Modifiers;
+			argKeyboard.Key = nativeEvent.Key;
+
+			ProcessKey(nativeWindow, argKeyboard, nativeEvent.EventType == NativeEvent::Type::KeyUp);
+			break;
+		}
+		case NativeEvent::Type::EnterSizeMove:
+		{
+			rootWindowData.IsSizeMoving = true;
+
+			ArgSizeMove argSizeMove;
+			if (auto events = dynamic_cast<FormEvents*>(nativeWindow->Events.get()))
+			{
+				events->EnterSizeMove.Emit(argSizeMove);
+			}
+			break;
+		}
+		case NativeEvent::Type::ExitSizeMove:
+		{
+			rootWindowData.IsSizeMoving = false;
+
+			ArgSizeMove argSizeMove;
+			if (auto events = dynamic_cast<FormEvents*>(nativeWindow->Events.get()))
+			{
+				events->ExitSizeMove.Emit(argSizeMove);
+			}
+			break;
+		}
+		case NativeEvent::Type::Close:
+		{
+			ArgDisposing argDisposing{ false };
+			if (auto events = dynamic_cast<FormEvents*>(nativeWindow->Events.get()))
+			{
+				events->Disposing.Emit(argDisposing);
+			}
+			if (!argDisposing.Cancel)
+			{
+				API::DestroyNativeWindow(nativeEvent.Target); // What DefWindowProc does with WM_CLOSE.
+			}
+			break;
+		}
+		case NativeEvent::Type::Destroy: // Destroy, next FinalDestroy
+		{
+			windowManager.Destroy(nativeWindow);
+			break;
+		}
+		case NativeEvent::Type::FinalDestroy:
+		{
+			windowManager.Remove(nativeWindow);
+			if (windowManager.NativeWindowCount() == 0)
+			{
+				foundation.GetMessageLoop().Quit(0);
+			}
+			break;
+		}
+		}
+	}
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,667 @@
+/*
+* MIT License
+*
+* Copyright (c) 2024 Edgar Bernal (edgar.bernal@gmail.com)
+*/
+
+#include "btpch.h"
+#include "VirtualDisplay.h"
+
+#ifndef BT_PLATFORM_WINDOWS
+
+#include "Berta/API/PaintAPI.h"
+#include "Berta/Core/MessageLoop.h"
+
+#include <algorithm>
+#include <cstring>
+
+#ifdef BT_PLATFORM_LINUX
+#include <sys/eventfd.h>
+#include <unistd.h>
+#include <cerrno>
+#endif
+
+namespace Berta
+{
+	void VirtualDisplay::Attach(MessageLoop& messageLoop, Dispatcher dispatcher)
+	{
+		m_messageLoop = &messageLoop;
+		m_dispatcher = std::move(dispatcher);
+
+#ifdef BT_PLATFORM_LINUX
+		m_eventFd = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+		if (m_eventFd < 0)
+		{
+			BT_CORE_ERROR << "eventfd Failed (virtual display). errno = " << errno << std::endl;
+		}
+		else if (!messageLoop.WatchFileDescriptor(m_eventFd, [this](uint32_t)
+		{
+			DispatchPending();
+		}))
+		{
+			::close(m_eventFd);
+			m_eventFd = -1;
+		}
+#endif
+		std::lock_guard<std::mutex> lock(m_pendingMutex);
+		if (!m_pending.empty())
+		{
+			m_signaled = true;
+			Signal();
+		}
+	}
+
+	void VirtualDisplay::Detach()
+	{
+#ifdef BT_PLATFORM_LINUX
+		if (m_eventFd >= 0)
+		{
+			m_messageLoop->UnwatchFileDescriptor(m_eventFd);
+			::close(m_eventFd);
+			m_eventFd = -1;
+		}
+#endif
+		m_messageLoop = nullptr;
+		m_dispatcher = {};
+	}
+
+	VirtualWindow* VirtualDisplay::Create(VirtualWindow* parent, const Rectangle& rectangle, const FormStyle& formStyle, bool isNested)
+	{
+		auto window = std::make_unique<VirtualWindow>();
+		window->IsNested = isNested;
+		window->Style = formStyle;
+		window->Position = { rectangle.X, rectangle.Y };
+		if (isNested)
+		{
+			window->Parent = parent;
+		}
+		else if (parent)
+		{
+			window->Owner = parent;
+			window->Position += GetScreenPosition(parent);
+		}
+		window->ClientSize = { rectangle.Width, rectangle.Height };
+		window->DPI = parent ? parent->DPI : m_dpi;
+		if (!m_backend)
+		{
+			window->Framebuffer.resize(static_cast<size_t>(rectangle.Width) * rectangle.Height);
+		}
+
+		auto result = window.get();
+		m_windows.emplace(result, std::move(window));
+		if (m_backend)
+		{
+			m_backend->Create(result);
+		}
+		return result;
+	}
+
+	void VirtualDisplay::Destroy(VirtualWindow* window)
+	{
+		// Like DestroyWindow: owned windows go first, then the window itself and its children.
+		std::vector<VirtualWindow*> owned;
+		std::vector<VirtualWindow*> children;
+		for (auto& [record, _] : m_windows)
+		{
+			if (record->Owner == window)
+			{
+				owned.push_back(record);
+			}
+			else if (record->Parent == window)
+			{
+				children.push_back(record);
+			}
+		}
+
+		for (auto ownedWindow : owned)
+		{
+			if (Exists(ownedWindow))
+			{
+				Destroy(ownedWindow);
+			}
+		}
+
+		NativeEvent destroyEvent;
+		destroyEvent.EventType = NativeEvent::Type::Destroy;
+		destroyEvent.Target = window;
+		Send(std::move(destroyEvent));
+
+		for (auto child : children)
+		{
+			if (Exists(child))
+			{
+				Destroy(child);
+			}
+		}
+
+		NativeEvent finalDestroyEvent;
+		finalDestroyEvent.EventType = NativeEvent::Type::FinalDestroy;
+		finalDestroyEvent.Target = window;
+		Send(std::move(finalDestroyEvent));
+
+		if (m_capture == window)
+		{
+			m_capture = nullptr;
+		}
+		if (m_hovered == window)
+		{
+			m_hovered = nullptr;
+		}
+
+		// The address may be reused by the next window, nothing queued for this one can reach it.
+		auto isStale = [window](const NativeEvent& nativeEvent)
+		{
+			return nativeEvent.Target.Handle == window;
+		};
+		for (auto batch : m_dispatching)
+		{
+			for (auto& nativeEvent : *batch)
+			{
+				if (isStale(nativeEvent))
+				{
+					nativeEvent.Target = {};
+				}
+			}
+		}
+		{
+			std::lock_guard<std::mutex> lock(m_pendingMutex);
+			m_pending.erase(std::remove_if(m_pending.begin(), m_pending.end(), isStale), m_pending.end());
+		}
+
+		if (m_backend)
+		{
+			m_backend->Destroy(window);
+		}
+		m_windows.erase(window);
+	}
+
+	void VirtualDisplay::Show(VirtualWindow* window, bool visible)
+	{
+		if (window->Visible == visible)
+		{
+			return;
+		}
+		window->Visible = visible;
+		if (m_backend)
+		{
+			m_backend->Show(window);
+		}
+
+		NativeEvent showEvent;
+		showEvent.EventType = NativeEvent::Type::Show;
+		showEvent.Target = window;
+		showEvent.Flag = visible;
+		Send(std::move(showEvent));
+
+		if (visible && Exists(window))
+		{
+			NativeEvent paintEvent;
+			paintEvent.EventType = NativeEvent::Type::Paint;
+			paintEvent.Target = window;
+			paintEvent.Area = window->ClientSize.ToRectangle();
+			Post(std::move(paintEvent));
+		}
+	}
+
+	void VirtualDisplay::Move(VirtualWindow* window, const Point& position, const Size& clientSize)
+	{
+		bool moved = false;
+		bool resized = SetBounds(window, position, clientSize, moved);
+		if (m_backend && (moved || resized))
+		{
+			m_backend->Move(window);
+		}
+
+		if (moved)
+		{
+			NativeEvent moveEvent;
+			moveEvent.EventType = NativeEvent::Type::Move;
+			moveEvent.Target = window;
+			moveEvent.Position = window->Position;
+			Send(std::move(moveEvent));
+		}
+
+		if (resized && Exists(window))
+		{
+			NativeEvent resizeEvent;
+			resizeEvent.EventType = NativeEvent::Type::Resize;
+			resizeEvent.Target = window;
+			resizeEvent.NewSize = window->ClientSize;
+			Send(std::move(resizeEvent));
+		}
+	}
+
+	void VirtualDisplay::SetParent(VirtualWindow* window, VirtualWindow* parent)
+	{
+		if (window->IsNested)
+		{
+			window->Parent = parent; // Position stays relative to the (new) parent's client area.
+		}
+		else
+		{
+			window->Owner = parent;
+		}
+
+		if (m_backend)
+		{
+			m_backend->SetParent(window);
+		}
+	}
+
+	void VirtualDisplay::SetCaption(VirtualWindow* window, const std::wstring& caption)
+	{
+		window->Caption = caption;
+		if (m_backend)
+		{
+			m_backend->SetCaption(window);
+		}
+	}
+
+	void VirtualDisplay::SetCursor(VirtualWindow* window, Cursor cursor)
+	{
+		if (window->CurrentCursor == cursor)
+		{
+			return;
+		}
+
+		window->CurrentCursor = cursor;
+		if (m_backend)
+		{
+			m_backend->SetCursor(window);
+		}
+	}
+
+	void VirtualDisplay::Capture(VirtualWindow* window, bool capture)
+	{
+		m_capture = capture ? window : nullptr;
+		if (m_backend)
+		{
+			m_backend->Capture(window, capture);
+		}
+	}
+
+	void VirtualDisplay::Present(VirtualWindow* window, const PaintNativeHandle& source, const Rectangle& area, const Point& sourcePoint)
+	{
+		if (!Exists(window))
+		{
+			return;
+		}
+
+		// Clip against both the framebuffer and the source surface.
+		int dx = area.X;
+		int dy = area.Y;
+		int sx = sourcePoint.X;
+		int sy = sourcePoint.Y;
+		int width = static_cast<int>(area.Width);
+		int height = static_cast<int>(area.Height);
+
+		int skipX = (std::max)({ 0, -dx, -sx });
+		int skipY = (std::max)({ 0, -dy, -sy });
+		dx += skipX;
+		sx += skipX;
+		dy += skipY;
+		sy += skipY;
+		width = (std::min)({ width - skipX, static_cast<int>(window->ClientSize.Width) - dx, static_cast<int>(source.m_size.Width) - sx });
+		height = (std::min)({ height - skipY, static_cast<int>(window->ClientSize.Height) - dy, static_cast<int>(source.m_size.Height) - sy });
+		if (width <= 0 || height <= 0)
+		{
+			return;
+		}
+
+		++window->Presents;
+		++m_statistics.Presents;
+		m_statistics.PixelsPresented += static_cast<uint64_t>(width) * height;
+
+		if (m_backend)
+		{
+			m_backend->Present(window, source, { dx, dy, static_cast<uint32_t>(width), static_cast<uint32_t>(height) }, { sx, sy });
+			return;
+		}
+
+		auto framebufferSize = static_cast<size_t>(window->ClientSize.Width) * window->ClientSize.Height;
+		if (window->Framebuffer.size() != framebufferSize)
+		{
+			window->Framebuffer.assign(framebufferSize, 0u); // Created while a backend was set.
+		}
+		for (int y = 0; y < height; ++y)
+		{
+			auto sourceRow = source.m_pixels.data() + static_cast<size_t>(sy + y) * source.m_size.Width + sx;
+			auto targetRow = window->Framebuffer.data() + static_cast<size_t>(dy + y) * window->ClientSize.Width + dx;
+			std::memcpy(targetRow, sourceRow, static_cast<size_t>(width) * sizeof(uint32_t));
+		}
+	}
+
+	Point VirtualDisplay::GetScreenPosition(const VirtualWindow* window) const
+	{
+		Point position;
+		while (window)
+		{
+			position += window->Position;
+			window = window->IsNested ? window->Parent : nullptr;
+		}
+		return position;
+	}
+
+	bool VirtualDisplay::Exists(const VirtualWindow* window) const
+	{
+		return window && m_windows.find(const_cast<VirtualWindow*>(window)) != m_windows.end();
+	}
+
+	void VirtualDisplay::Send(NativeEvent&& nativeEvent)
+	{
+		++m_statistics.Sent;
+		Dispatch(nativeEvent);
+	}
+
+	void VirtualDisplay::Post(NativeEvent&& nativeEvent)
+	{
+		std::lock_guard<std::mutex> lock(m_pendingMutex);
+		m_pending.emplace_back(std::move(nativeEvent));
+		++m_statistics.Posted;
+		if (!m_signaled)
+		{
+			m_signaled = true;
+			Signal();
+		}
+	}
+
+	void VirtualDisplay::InjectMouseMove(API::NativeWindowHandle target, const Point& position)
+	{
+		PostMouse(NativeEvent::Type::MouseMove, target, position, NativeEvent::Button::Left);
+	}
+
+	void VirtualDisplay::InjectMouseDown(API::NativeWindowHandle target, const Point& position, NativeEvent::Button button)
+	{
+		PostMouse(NativeEvent::Type::MouseDown, target, position, button);
+	}
+
+	void VirtualDisplay::InjectMouseUp(API::NativeWindowHandle target, const Point& position, NativeEvent::Button button)
+	{
+		PostMouse(NativeEvent::Type::MouseUp, target, position, button);
+	}
+
+	void VirtualDisplay::InjectClick(API::NativeWindowHandle target, const Point& position, NativeEvent::Button button)
+	{
+		PostMouse(NativeEvent::Type::MouseDown, target, position, button);
+		PostMouse(NativeEvent::Type::MouseUp, target, position, button);
+	}
+
+	void VirtualDisplay::InjectDoubleClick(API::NativeWindowHandle target, const Point& position)
+	{
+		// Same sequence as Win32: down, up, double click (instead of the second down), up.
+		PostMouse(NativeEvent::Type::MouseDown, target, position, NativeEvent::Button::Left);
+		PostMouse(NativeEvent::Type::MouseUp, target, position, NativeEvent::Button::Left);
+		PostMouse(NativeEvent::Type::DoubleClick, target, position, NativeEvent::Button::Left);
+		PostMouse(NativeEvent::Type::MouseUp, target, position, NativeEvent::Button::Left);
+	}
+
+	void VirtualDisplay::InjectMouseWheel(API::NativeWindowHandle target, const Point& position, int delta, bool isVertical)
+	{
+		NativeEvent wheelEvent;
+		wheelEvent.EventType = NativeEvent::Type::MouseWheel;
+		wheelEvent.Target = target;
+		wheelEvent.Position = position;
+		wheelEvent.WheelDelta = delta;
+		wheelEvent.IsVertical = isVertical;
+		Post(std::move(wheelEvent));
+	}
+
+	void VirtualDisplay::InjectMouseLeave(API::NativeWindowHandle target)
+	{
+		NativeEvent leaveEvent;
+		leaveEvent.EventType = NativeEvent::Type::MouseLeave;
+		leaveEvent.Target = target;
+		Post(std::move(leaveEvent));
+	}
+
+	void VirtualDisplay::InjectKeyDown(API::NativeWindowHandle target, wchar_t key, ArgKeyboard::KeyboardState modifiers, bool isAutoRepeat)
+	{
+		PostKey(NativeEvent::Type::KeyDown, target, key, modifiers, isAutoRepeat);
+	}
+
+	void VirtualDisplay::InjectKeyUp(API::NativeWindowHandle target, wchar_t key, ArgKeyboard::KeyboardState modifiers)
+	{
+		PostKey(NativeEvent::Type::KeyUp, target, key, modifiers, false);
+	}
+
+	void VirtualDisplay::InjectText(API::NativeWindowHandle target, const std::wstring& text)
+	{
+		for (auto character : text)
+		{
+			PostKey(NativeEvent::Type::Char, target, character, {}, false);
+		}
+	}
+
+	void VirtualDisplay::InjectResize(API::NativeWindowHandle target, const Size& newSize)
+	{
+		NativeEvent enterEvent;
+		enterEvent.EventType = NativeEvent::Type::EnterSizeMove;
+		enterEvent.Target = target;
+		Post(std::move(enterEvent));
+
+		NativeEvent resizeEvent;
+		resizeEvent.EventType = NativeEvent::Type::Resize;
+		resizeEvent.Target = target;
+		resizeEvent.NewSize = newSize;
+		Post(std::move(resizeEvent));
+
+		NativeEvent exitEvent;
+		exitEvent.EventType = NativeEvent::Type::ExitSizeMove;
+		exitEvent.Target = target;
+		Post(std::move(exitEvent));
+	}
+
+	void VirtualDisplay::InjectMove(API::NativeWindowHandle target, const Point& position)
+	{
+		NativeEvent moveEvent;
+		moveEvent.EventType = NativeEvent::Type::Move;
+		moveEvent.Target = target;
+		moveEvent.Position = position;
+		Post(std::move(moveEvent));
+	}
+
+	void VirtualDisplay::InjectFocus(API::NativeWindowHandle target, bool focused)
+	{
+		NativeEvent focusEvent;
+		focusEvent.EventType = NativeEvent::Type::Focus;
+		focusEvent.Target = target;
+		focusEvent.Flag = focused;
+		Post(std::move(focusEvent));
+	}
+
+	void VirtualDisplay::InjectClose(API::NativeWindowHandle target)
+	{
+		NativeEvent closeEvent;
+		closeEvent.EventType = NativeEvent::Type::Close;
+		closeEvent.Target = target;
+		Post(std::move(closeEvent));
+	}
+
+	size_t VirtualDisplay::DispatchPending()
+	{
+		std::vector<NativeEvent> batch;
+		{
+			std::lock_guard<std::mutex> lock(m_pendingMutex);
+			batch.swap(m_pending);
+			m_signaled = false;
+#ifdef BT_PLATFORM_LINUX
+			if (m_eventFd >= 0)
+			{
+				uint64_t value;
+				while (::read(m_eventFd, &value, sizeof(value)) > 0)
+				{
+				}
+			}
+#endif
+		}
+
+		size_t dispatched = 0;
+		m_dispatching.push_back(&batch);
+		for (auto& nativeEvent : batch)
+		{
+			if (!Exists(nativeEvent.Target.Handle))
+			{
+				++m_statistics.Dropped;
+				continue;
+			}
+
+			Dispatch(nativeEvent);
+			++dispatched;
+		}
+		m_dispatching.pop_back();
+
+		return dispatched;
+	}
+
+	void VirtualDisplay::Dispatch(NativeEvent& nativeEvent)
+	{
+		auto window = nativeEvent.Target.Handle;
+		switch (nativeEvent.EventType)
+		{
+		case NativeEvent::Type::MouseMove:
+		case NativeEvent::Type::MouseDown:
+		case NativeEvent::Type::MouseUp:
+		case NativeEvent::Type::DoubleClick:
+		case NativeEvent::Type::MouseWheel:
+			RouteMouse(nativeEvent);
+			if (!Exists(nativeEvent.Target.Handle))
+			{
+				return;
+			}
+			break;
+		case NativeEvent::Type::MouseLeave:
+			if (m_hovered == window)
+			{
+				m_hovered = nullptr;
+			}
+			break;
+		case NativeEvent::Type::Resize:
+		{
+			bool moved = false;
+			SetBounds(window, window->Position, nativeEvent.NewSize, moved); // Already applied when it comes from Move.
+			break;
+		}
+		case NativeEvent::Type::Move:
+		{
+			bool moved = false;
+			SetBounds(window, nativeEvent.Position, window->ClientSize, moved);
+			break;
+		}
+		case NativeEvent::Type::DpiChanged:
+			window->DPI = nativeEvent.Dpi;
+			break;
+		default:
+			break;
+		}
+
+		++m_statistics.Dispatched;
+		if (m_dispatcher)
+		{
+			m_dispatcher(nativeEvent);
+		}
+	}
+
+	void VirtualDisplay::RouteMouse(NativeEvent& nativeEvent)
+	{
+		auto screenPosition = nativeEvent.Position + GetScreenPosition(nativeEvent.Target.Handle);
+		if (m_capture && m_capture != nativeEvent.Target.Handle)
+		{
+			nativeEvent.Target = m_capture;
+			nativeEvent.Position = screenPosition - GetScreenPosition(m_capture);
+		}
+		m_mousePosition = screenPosition;
+
+		if (nativeEvent.EventType == NativeEvent::Type::MouseDown || nativeEvent.EventType == NativeEvent::Type::DoubleClick ||
+			nativeEvent.EventType == NativeEvent::Type::MouseUp)
+		{
+			bool isDown = nativeEvent.EventType != NativeEvent::Type::MouseUp;
+			switch (nativeEvent.ChangedButton)
+			{
+			case NativeEvent::Button::Left: m_buttonState.LeftButton = isDown; break;
+			case NativeEvent::Button::Right: m_buttonState.RightButton = isDown; break;
+			case NativeEvent::Button::Middle: m_buttonState.MiddleButton = isDown; break;
+			}
+		}
+		nativeEvent.ButtonState = m_buttonState;
+
+		auto target = nativeEvent.Target.Handle;
+		if (m_hovered != target)
+		{
+			auto previous = m_hovered;
+			m_hovered = target;
+			if (previous)
+			{
+				NativeEvent leaveEvent;
+				leaveEvent.EventType = NativeEvent::Type::MouseLeave;
+				leaveEvent.Target = previous;
+				++m_statistics.Dispatched;
+				if (m_dispatcher)
+				{
+					m_dispatcher(leaveEvent);
+				}
+			}
+		}
+	}
+
+	bool VirtualDisplay::SetBounds(VirtualWindow* window, const Point& position, const Size& clientSize, bool& moved)
+	{
+		moved = window->Position != position;
+		window->Position = position;
+		if (window->ClientSize == clientSize)
+		{
+			return false;
+		}
+
+		window->ClientSize = clientSize;
+		if (!m_backend)
+		{
+			window->Framebuffer.assign(static_cast<size_t>(clientSize.Width) * clientSize.Height, 0u);
+		}
+		return true;
+	}
+
+	void VirtualDisplay::PostMouse(NativeEvent::Type type, API::NativeWindowHandle target, const Point& position, NativeEvent::Button button)
+	{
+		NativeEvent mouseEvent;
+		mouseEvent.EventType = type;
+		mouseEvent.Target = target;
+		mouseEvent.Position = position;
+		mouseEvent.ChangedButton = button;
+		Post(std::move(mouseEvent));
+	}
+
+	void VirtualDisplay::PostKey(NativeEvent::Type type, API::NativeWindowHandle target, wchar_t key, ArgKeyboard::KeyboardState modifiers, bool isAutoRepeat)
+	{
+		NativeEvent keyEvent;
+		keyEvent.EventType = type;
+		keyEvent.Target = target;
+		keyEvent.Key = key;
+		keyEvent.Modifiers = modifiers;
+		keyEvent.IsAutoRepeat = isAutoRepeat;
+		Post(std::move(keyEvent));
+	}
+
+	void VirtualDisplay::Signal()
+	{
+#ifdef BT_PLATFORM_LINUX
+		if (m_eventFd >= 0)
+		{
+			uint64_t value = 1;
+			if (::write(m_eventFd, &value, sizeof(value)) < 0 && errno != EAGAIN)
+			{
+				BT_CORE_ERROR << "eventfd write Failed (virtual display). errno = " << errno << std::endl;
+			}
+			return;
+		}
+#endif
+		if (m_messageLoop)
+		{
+			m_messageLoop->PostTask([this]()
+			{
+				DispatchPending();
+			});
+		}
+	}
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,239 @@
+/*
+* MIT License
+*
+* Copyright (c) 2024 Edgar Bernal (edgar.bernal@gmail.com)
+*/
+
+#ifndef BT_VIRTUAL_DISPLAY_HEADER
+#define BT_VIRTUAL_DISPLAY_HEADER
+
+#ifndef BT_PLATFORM_WINDOWS
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "Berta/API/WindowAPI.h"
+#include "Berta/Core/BasicTypes.h"
+#include "Berta/Core/Delegate.h"
+#include "Berta/GUI/ControlEvents.h"
+
+namespace Berta
+{
+	class MessageLoop;
+	struct PaintNativeHandle;
+
+	// In-memory record of a native window, API::NativeWindowHandle points to it.
+	struct VirtualWindow
+	{
+		VirtualWindow* Parent{ nullptr };	// Nested windows only, their Position is relative to the parent's client area.
+		VirtualWindow* Owner{ nullptr };
+		bool IsNested{ false };
+		FormStyle Style;
+
+		std::wstring Caption;
+		Point Position;						// Screen coordinates unless nested. There is no non client area.
+		Size ClientSize;
+		uint32_t DPI{ 96u };
+		bool Visible{ false };
+		bool Enabled{ true };
+		Cursor CurrentCursor{ Cursor::Default };
+
+		std::vector<uint32_t> Framebuffer;	// Presented pixels, BGRA8 premultiplied, ClientSize.Width per row. Empty with a backend.
+		uint64_t Presents{ 0 };
+	};
+
+	// What a platform window procedure would receive. Most of them are posted by the injection API,
+	// the window API sends some synchronously (see the comments), like SendMessage on Win32.
+	struct NativeEvent
+	{
+		enum class Type
+		{
+			MouseMove,
+			MouseDown,
+			MouseUp,
+			DoubleClick,
+			MouseLeave,
+			MouseWheel,
+			KeyDown,
+			KeyUp,
+			Char,
+			Focus,
+			Activated,
+			EnterSizeMove,
+			ExitSizeMove,
+			Resize,			// Sent by MoveWindow / ResizeWindow too.
+			Move,			// Sent by MoveWindow too.
+			Show,			// Sent by ShowNativeWindow.
+			DpiChanged,		// Sent by SendDpiChanged.
+			Paint,			// Posted by RefreshWindow.
+			Close,			// Disposing, the window is destroyed unless it is cancelled.
+			Destroy,		// Sent by DestroyNativeWindow, before the children are destroyed.
+			FinalDestroy,	// Sent by DestroyNativeWindow, last message of the window.
+			Callback		// Posted by SendCustomMessage.
+		};
+
+		enum class Button
+		{
+			Left,
+			Right,
+			Middle
+		};
+
+		Type EventType{ Type::MouseMove };
+		API::NativeWindowHandle Target;
+
+		Point Position;						// Client coordinates of Target (mouse), new position (Move).
+		MouseButtonState ButtonState{};		// Buttons held, filled in when it is dispatched.
+		Button ChangedButton{ Button::Left };
+		int WheelDelta{ 0 };
+		bool IsVertical{ true };
+		wchar_t Key{ 0 };
+		ArgKeyboard::KeyboardState Modifiers{};
+		bool IsAutoRepeat{ false };
+		bool Flag{ false };					// Focus: gained, Activated: activated, Show: visible.
+		Size NewSize;						// Resize.
+		Rectangle Area;						// Paint, DpiChanged (new screen area).
+		uint32_t Dpi{ 0 };					// DpiChanged.
+		std::function<void()> Callback;
+	};
+
+	// Mirrors the records on a real window system (see Platform/X11). Called on the loop thread, after
+	// the record is updated. Input coming from that system goes through the injection API.
+	class VirtualDisplayBackend
+	{
+	public:
+		virtual ~VirtualDisplayBackend() = default;
+
+		virtual void Create(VirtualWindow* window) = 0;
+		virtual void Destroy(VirtualWindow* window) = 0;
+		virtual void Show(VirtualWindow* window) = 0;
+		virtual void Move(VirtualWindow* window) = 0;
+		virtual void SetParent(VirtualWindow* window) = 0;
+		virtual void SetCaption(VirtualWindow* window) = 0;
+		virtual void SetCursor(VirtualWindow* window) = 0;
+		virtual void Capture(VirtualWindow* window, bool capture) = 0;
+		// The area is already clipped against the window and the source.
+		virtual void Present(VirtualWindow* window, const PaintNativeHandle& source, const Rectangle& area, const Point& sourcePoint) = 0;
+	};
+
+	/*
+	* Headless windowing backend: native windows are VirtualWindow records, presenting copies the root
+	* graphics into VirtualWindow::Framebuffer (or hands it to the backend) and input comes from the
+	* injection API below.
+	* Posted events are queued (Post and Inject* are thread-safe) and dispatched by the message loop
+	* as native messages. Mouse input goes to the capture window, if any, and the previously hovered
+	* native window gets a MouseLeave when the mouse moves to another one, like on Win32.
+	*/
+	class VirtualDisplay
+	{
+	public:
+		using Dispatcher = Delegate<void(NativeEvent&)>;
+
+		struct Statistics
+		{
+			uint64_t Posted{ 0 };
+			uint64_t Sent{ 0 };
+			uint64_t Dispatched{ 0 };
+			uint64_t Dropped{ 0 };		// Posted to a window destroyed in the meantime.
+			uint64_t Presents{ 0 };
+			uint64_t PixelsPresented{ 0 };
+		};
+
+		VirtualDisplay(const VirtualDisplay&) = delete;
+		VirtualDisplay& operator=(const VirtualDisplay&) = delete;
+
+		static VirtualDisplay& GetInstance()
+		{
+			static VirtualDisplay virtualDisplay;
+			return virtualDisplay;
+		}
+
+		// Called by Foundation, the dispatcher is its window procedure.
+		void Attach(MessageLoop& messageLoop, Dispatcher dispatcher);
+		void Detach();
+
+		// Without a backend presents go to VirtualWindow::Framebuffer.
+		void SetBackend(VirtualDisplayBackend* backend) { m_backend = backend; }
+		VirtualDisplayBackend* GetBackend() const { return m_backend; }
+
+		void SetScreenSize(const Size& size) { m_screenSize = size; }
+		const Size& GetScreenSize() const { return m_screenSize; }
+		void SetDpi(uint32_t dpi) { m_dpi = dpi; }
+		uint32_t GetDpi() const { return m_dpi; }
+
+		// Window API backend.
+		VirtualWindow* Create(VirtualWindow* parent, const Rectangle& rectangle, const FormStyle& formStyle, bool isNested);
+		void Destroy(VirtualWindow* window);
+		void Show(VirtualWindow* window, bool visible);
+		void Move(VirtualWindow* window, const Point& position, const Size& clientSize);
+		void SetParent(VirtualWindow* window, VirtualWindow* parent);
+		void SetCaption(VirtualWindow* window, const std::wstring& caption);
+		void SetCursor(VirtualWindow* window, Cursor cursor);
+		void Capture(VirtualWindow* window, bool capture);
+		void Present(VirtualWindow* window, const PaintNativeHandle& source, const Rectangle& area, const Point& sourcePoint);
+		Point GetScreenPosition(const VirtualWindow* window) const;
+		Point GetMousePosition() const { return m_mousePosition; }
+		bool Exists(const VirtualWindow* window) const;
+		void Send(NativeEvent&& nativeEvent);	// Loop thread only, dispatched right away.
+		void Post(NativeEvent&& nativeEvent);
+
+		// Injection API. Positions are client coordinates of the target window.
+		void InjectMouseMove(API::NativeWindowHandle target, const Point& position);
+		void InjectMouseDown(API::NativeWindowHandle target, const Point& position, NativeEvent::Button button = NativeEvent::Button::Left);
+		void InjectMouseUp(API::NativeWindowHandle target, const Point& position, NativeEvent::Button button = NativeEvent::Button::Left);
+		void InjectClick(API::NativeWindowHandle target, const Point& position, NativeEvent::Button button = NativeEvent::Button::Left);
+		void InjectDoubleClick(API::NativeWindowHandle target, const Point& position);
+		void InjectMouseWheel(API::NativeWindowHandle target, const Point& position, int delta, bool isVertical = true);
+		void InjectMouseLeave(API::NativeWindowHandle target);
+		void InjectKeyDown(API::NativeWindowHandle target, wchar_t key, ArgKeyboard::KeyboardState modifiers = {}, bool isAutoRepeat = false);
+		void InjectKeyUp(API::NativeWindowHandle target, wchar_t key, ArgKeyboard::KeyboardState modifiers = {});
+		void InjectText(API::NativeWindowHandle target, const std::wstring& text);
+		void InjectResize(API::NativeWindowHandle target, const Size& newSize); // Interactive, between EnterSizeMove and ExitSizeMove.
+		void InjectMove(API::NativeWindowHandle target, const Point& position); // Screen coordinates, parent client coordinates if nested.
+		void InjectFocus(API::NativeWindowHandle target, bool focused);
+		void InjectClose(API::NativeWindowHandle target);
+
+		// Dispatches everything posted so far, loop thread only. Returns the number of events dispatched.
+		size_t DispatchPending();
+
+		const std::vector<uint32_t>& GetFramebuffer(API::NativeWindowHandle target) const { return target.Handle->Framebuffer; }
+		const Statistics& GetStatistics() const { return m_statistics; }
+		void ResetStatistics() { m_statistics = {}; }
+
+	private:
+		VirtualDisplay() = default;
+
+		void Dispatch(NativeEvent& nativeEvent);
+		void RouteMouse(NativeEvent& nativeEvent);
+		bool SetBounds(VirtualWindow* window, const Point& position, const Size& clientSize, bool& moved);
+		void PostMouse(NativeEvent::Type type, API::NativeWindowHandle target, const Point& position, NativeEvent::Button button);
+		void PostKey(NativeEvent::Type type, API::NativeWindowHandle target, wchar_t key, ArgKeyboard::KeyboardState modifiers, bool isAutoRepeat);
+		void Signal();
+
+		std::unordered_map<VirtualWindow*, std::unique_ptr<VirtualWindow>> m_windows;
+		VirtualWindow* m_capture{ nullptr };
+		VirtualWindow* m_hovered{ nullptr };	// Native window under the mouse, gets a MouseLeave when it changes.
+		Point m_mousePosition;					// Screen coordinates.
+		MouseButtonState m_buttonState{};
+		Size m_screenSize{ 1920, 1080 };
+		VirtualDisplayBackend* m_backend{ nullptr };
+		uint32_t m_dpi{ 96u };
+
+		MessageLoop* m_messageLoop{ nullptr };
+		Dispatcher m_dispatcher;
+		int m_eventFd{ -1 };			// Readable while there are posted events (Linux).
+
+		std::mutex m_pendingMutex;
+		std::vector<NativeEvent> m_pending;
+		bool m_signaled{ false };		// Guarded by m_pendingMutex.
+		std::vector<std::vector<NativeEvent>*> m_dispatching;	// Batches being dispatched (nested loops), Destroy purges them.
+		Statistics m_statistics;
+	};
+}
+
+#endif
+
+#endif
\ No newline at end of file
@@ -0,0 +1,191 @@
+/*
+* MIT License
+*
+* Copyright (c) 2024 Edgar Bernal (edgar.bernal@gmail.com)
+*/
+
+#include "btpch.h"
+#include "Berta/Core/MessageLoop.h"
+
+#ifdef BT_PLATFORM_LINUX
+
+#include <poll.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+
+namespace Berta
+{
+	namespace
+	{
+		constexpr int MaxEpollEvents = 32;
+	}
+
+	void MessageLoop::InitializeNative()
+	{
+		m_epollFd = ::epoll_create1(EPOLL_CLOEXEC);
+		if (m_epollFd < 0)
+		{
+			BT_CORE_ERROR << "epoll_create1 Failed. errno = " << errno << std::endl;
+			return;
+		}
+
+		m_wakeupFd = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+		if (m_wakeupFd < 0)
+		{
+			BT_CORE_ERROR << "eventfd Failed. errno = " << errno << std::endl;
+			return;
+		}
+
+		epoll_event event{};
+		event.events = EPOLLIN;
+		event.data.fd = m_wakeupFd;
+		if (::epoll_ctl(m_epollFd, EPOLL_CTL_ADD, m_wakeupFd, &event) < 0)
+		{
+			BT_CORE_ERROR << "epoll_ctl Failed (wakeup fd). errno = " << errno << std::endl;
+		}
+	}
+
+	void MessageLoop::ShutdownNative()
+	{
+		if (m_wakeupFd >= 0)
+		{
+			::close(m_wakeupFd);
+			m_wakeupFd = -1;
+		}
+
+		if (m_epollFd >= 0)
+		{
+			::close(m_epollFd);
+			m_epollFd = -1;
+		}
+		m_fileDescriptorHandlers.clear();
+	}
+
+	bool MessageLoop::WatchFileDescriptor(int fileDescriptor, FileDescriptorHandler handler)
+	{
+		if (m_epollFd < 0 || fileDescriptor < 0)
+		{
+			return false;
+		}
+
+		epoll_event event{};
+		event.events = EPOLLIN;
+		event.data.fd = fileDescriptor;
+
+		int operation = m_fileDescriptorHandlers.count(fileDescriptor) ? EPOLL_CTL_MOD : EPOLL_CTL_ADD;
+		if (::epoll_ctl(m_epollFd, operation, fileDescriptor, &event) < 0)
+		{
+			BT_CORE_ERROR << "epoll_ctl Failed. errno = " << errno << std::endl;
+			return false;
+		}
+
+		m_fileDescriptorHandlers[fileDescriptor] = std::move(handler);
+		return true;
+	}
+
+	void MessageLoop::UnwatchFileDescriptor(int fileDescriptor)
+	{
+		auto it = m_fileDescriptorHandlers.find(fileDescriptor);
+		if (it == m_fileDescriptorHandlers.end())
+		{
+			return;
+		}
+
+		::epoll_ctl(m_epollFd, EPOLL_CTL_DEL, fileDescriptor, nullptr);
+		m_fileDescriptorHandlers.erase(it);
+	}
+
+	bool MessageLoop::PumpNativeMessages()
+	{
+		if (m_epollFd < 0)
+		{
+			return false;
+		}
+
+		epoll_event events[MaxEpollEvents];
+		int count = ::epoll_wait(m_epollFd, events, MaxEpollEvents, 0);
+		if (count <= 0)
+		{
+			return false;
+		}
+
+		bool didWork = false;
+		for (int i = 0; i < count; ++i)
+		{
+			int fileDescriptor = events[i].data.fd;
+			if (fileDescriptor == m_wakeupFd)
+			{
+				uint64_t value = 0;
+				while (::read(m_wakeupFd, &value, sizeof(value)) > 0)
+				{
+				}
+				continue;
+			}
+
+			auto it = m_fileDescriptorHandlers.find(fileDescriptor);
+			if (it != m_fileDescriptorHandlers.end())
+			{
+				auto handler = it->second; // The handler may unwatch itself.
+				handler(events[i].events);
+
+				++m_statistics.NativeMessages;
+				didWork = true;
+			}
+
+			if (m_quitRequested)
+			{
+				break;
+			}
+		}
+		return didWork;
+	}
+
+	bool MessageLoop::HasPendingNativeMessages() const
+	{
+		if (m_epollFd < 0)
+		{
+			return false;
+		}
+
+		// The epoll descriptor itself is readable while any watched descriptor is ready.
+		pollfd descriptor{ m_epollFd, POLLIN, 0 };
+		return ::poll(&descriptor, 1, 0) > 0;
+	}
+
+	void MessageLoop::WaitForWork(std::chrono::milliseconds timeout)
+	{
+		if (m_epollFd < 0)
+		{
+			return;
+		}
+
+		int nativeTimeout = -1;
+		if (timeout != InfiniteTimeout)
+		{
+			nativeTimeout = static_cast<int>((std::min)(timeout.count(), static_cast<std::chrono::milliseconds::rep>(INT32_MAX)));
+		}
+
+		// Only block here. Ready descriptors are left in the epoll set and dispatched by PumpNativeMessages.
+		epoll_event event{};
+		while (::epoll_wait(m_epollFd, &event, 1, nativeTimeout) < 0 && errno == EINTR)
+		{
+		}
+	}
+
+	void MessageLoop::WakeupNative()
+	{
+		if (m_wakeupFd >= 0)
+		{
+			uint64_t value = 1;
+			if (::write(m_wakeupFd, &value, sizeof(value)) < 0 && errno != EAGAIN)
+			{
+				BT_CORE_ERROR << "eventfd write Failed. errno = " << errno << std::endl;
+			}
+		}
+	}
+}
+
+#endif
\ No newline at end of file
@@ -1,6 +1,8 @@
 #include "btpch.h"
 #include "D2D.h"
 
+#ifdef BT_PLATFORM_WINDOWS
+
 namespace Berta::DirectX
 {
 	D2DModule::D2DModule()
@@ -23,4 +25,28 @@ namespace Berta::DirectX
 			BT_CORE_ERROR << "Error creating D2D write factory." << std::endl;
 		}
 	}
+
+	D2DModule::~D2DModule()
+	{
+		Dispose();
+	}
+
+	void D2DModule::Dispose()
+	{
+		m_geometryCache.Clear();
+
+		if (m_dWriteFactory)
+		{
+			m_dWriteFactory->Release();
+			m_dWriteFactory = nullptr;
+		}
+
+		if (m_factory)
+		{
+			m_factory->Release();
+			m_factory = nullptr;
+		}
+	}
 }
+
+#endif
@@ -12,6 +12,7 @@
 #include <d2d1.h>
 #include <dwrite.h>
 #pragma comment(lib, "dwrite")
+#include "Berta/Platform/Windows/D2DResourceCache.h"
 
 namespace Berta::DirectX
 {
@@ -19,7 +20,11 @@ namespace Berta::DirectX
 	{
 	public:
 		D2DModule();
-		
+		~D2DModule();
+
+		// Clears the geometry cache, then releases the factories. Safe to call more than once.
+		void Dispose();
+
 		ID2D1Factory* GetFactory() const
 		{
 			return m_factory;
@@ -30,6 +35,11 @@ namespace Berta::DirectX
 			return m_dWriteFactory;
 		}
 
+		GeometryCache& GetGeometryCache()
+		{
+			return m_geometryCache;
+		}
+
 		static D2DModule& GetInstance()
 		{
 			static D2DModule d2dModule;
@@ -39,6 +49,7 @@ namespace Berta::DirectX
 	private:
 		ID2D1Factory* m_factory{ nullptr };
 		IDWriteFactory* m_dWriteFactory{ nullptr };
+		GeometryCache m_geometryCache;
 	};
 }
 #endif
@@ -0,0 +1,120 @@
+/*
+* MIT License
+*
+* Copyright (c) 2024 Edgar Bernal (edgar.bernal@gmail.com)
+*/
+
+#include "btpch.h"
+#include "D2DResourceCache.h"
+
+#ifdef BT_PLATFORM_WINDOWS
+
+#include "Berta/Platform/Windows/D2D.h"
+
+namespace Berta::DirectX
+{
+	ID2D1SolidColorBrush* BrushCache::Get(ID2D1RenderTarget* renderTarget, const Color& color)
+	{
+		uint32_t key = color;
+		if (auto brush = m_brushes.Find(key))
+		{
+			return brush->Get();
+		}
+
+		ID2D1SolidColorBrush* brush = nullptr;
+		auto hr = renderTarget->CreateSolidColorBrush(color, &brush);
+		if (FAILED(hr))
+		{
+			BT_CORE_ERROR << "CreateSolidColorBrush Failed. hr = " << hr << std::endl;
+			return nullptr;
+		}
+
+		return m_brushes.Insert(key, ComReference<ID2D1SolidColorBrush>(brush)).Get();
+	}
+
+	ID2D1StrokeStyle* GeometryCache::GetStrokeStyle(D2D1_DASH_STYLE dashStyle)
+	{
+		auto& strokeStyle = m_strokeStyles[dashStyle];
+		if (strokeStyle.Get())
+		{
+			return strokeStyle.Get();
+		}
+
+		D2D1_STROKE_STYLE_PROPERTIES props = D2D1::StrokeStyleProperties
+		(
+			D2D1_CAP_STYLE_ROUND,      // startCap
+			D2D1_CAP_STYLE_ROUND,      // endCap
+			D2D1_CAP_STYLE_FLAT,       // dashCap
+			D2D1_LINE_JOIN_ROUND,      // lineJoin
+			10.0f,                     // miterLimit
+			dashStyle,                 // dashStyle
+			0.0f                       // dashOffset
+		);
+
+		auto factory = D2DModule::GetInstance().GetFactory();
+		if (!factory)
+		{
+			return nullptr;
+		}
+
+		ID2D1StrokeStyle* newStrokeStyle = nullptr;
+		auto hr = factory->CreateStrokeStyle(&props, nullptr, 0, &newStrokeStyle);
+		if (FAILED(hr))
+		{
+			BT_CORE_ERROR << "CreateStrokeStyle Failed. hr = " << hr << std::endl;
+			return nullptr;
+		}
+
+		strokeStyle = ComReference<ID2D1StrokeStyle>(newStrokeStyle);
+		return newStrokeStyle;
+	}
+
+	void GeometryCache::Clear()
+	{
+		for (auto& strokeStyle : m_strokeStyles)
+		{
+			strokeStyle = {};
+		}
+		m_arrows.Clear();
+	}
+
+	ID2D1PathGeometry* GeometryCache::GetArrow(const ArrowKey& key, const D2D1_POINT_2F(&points)[3])
+	{
+		if (auto geometry = m_arrows.Find(key))
+		{
+			return geometry->Get();
+		}
+
+		auto factory = D2DModule::GetInstance().GetFactory();
+		if (!factory)
+		{
+			return nullptr;
+		}
+
+		ID2D1PathGeometry* geometry = nullptr;
+		auto hr = factory->CreatePathGeometry(&geometry);
+		if (FAILED(hr))
+		{
+			return nullptr;
+		}
+
+		ID2D1GeometrySink* sink = nullptr;
+		hr = geometry->Open(&sink);
+		if (FAILED(hr))
+		{
+			geometry->Release();
+			return nullptr;
+		}
+
+		sink->BeginFigure(points[0], key.Filled ? D2D1_FIGURE_BEGIN_FILLED : D2D1_FIGURE_BEGIN_HOLLOW);
+		sink->AddLine(points[1]);
+		sink->AddLine(points[2]);
+		sink->EndFigure(D2D1_FIGURE_END_CLOSED);
+		sink->Close();
+		sink->Release();
+
+		return m_arrows.Insert(key, ComReference<ID2D1PathGeometry>(geometry)).Get();
+	}
+}
+
+#endif
\ No newline at end of file
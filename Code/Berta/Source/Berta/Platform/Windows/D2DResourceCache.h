@@ -0,0 +1,122 @@
+/*
+* MIT License
+*
+* Copyright (c) 2024 Edgar Bernal (edgar.bernal@gmail.com)
+*/
+
+#ifndef BT_D2D_RESOURCE_CACHE_HEADER
+#define BT_D2D_RESOURCE_CACHE_HEADER
+
+#ifdef BT_PLATFORM_WINDOWS
+
+#include <d2d1.h>
+#include <utility>
+#include "Berta/Core/BasicTypes.h"
+#include "Berta/Core/LruCache.h"
+
+namespace Berta::DirectX
+{
+	// Owning reference to a COM object, released with the cache entry holding it.
+	template <typename T>
+	class ComReference
+	{
+	public:
+		ComReference() = default;
+		explicit ComReference(T* pointer) : m_pointer(pointer) {}
+		ComReference(ComReference&& other) noexcept : m_pointer(std::exchange(other.m_pointer, nullptr)) {}
+		~ComReference()
+		{
+			if (m_pointer)
+			{
+				m_pointer->Release();
+			}
+		}
+
+		ComReference& operator=(ComReference&& other) noexcept
+		{
+			std::swap(m_pointer, other.m_pointer);
+			return *this;
+		}
+
+		ComReference(const ComReference&) = delete;
+		ComReference& operator=(const ComReference&) = delete;
+
+		T* Get() const { return m_pointer; }
+
+	private:
+		T* m_pointer{ nullptr };
+	};
+
+	/*
+	* Solid color brushes of one render target, keyed by color. Brushes are device dependent, the
+	* owner (PaintNativeHandle) drops them with the target and clears them when the device is lost.
+	*/
+	class BrushCache
+	{
+	public:
+		static constexpr size_t Capacity = 64;
+
+		BrushCache() : m_brushes(Capacity) {}
+
+		// Owned by the cache, don't store it. It is only valid until a later Get misses and the insert
+		// evicts it (Capacity entries), so use it within the current draw call.
+		ID2D1SolidColorBrush* Get(ID2D1RenderTarget* renderTarget, const Color& color);
+		void Clear() { m_brushes.Clear(); }
+
+		const LruCacheStatistics& GetStatistics() const { return m_brushes.GetStatistics(); }
+
+	private:
+		LruCache<uint32_t, ComReference<ID2D1SolidColorBrush>> m_brushes;
+	};
+
+	/*
+	* Device independent resources shared by every render target: dashed stroke styles and arrow
+	* triangles. Arrows are built around the origin and drawn with a translation, so a tree or a
+	* combo box reuses the same few geometries at any position. Owned by D2DModule, which clears
+	* it before releasing the factory that created them.
+	*/
+	class GeometryCache
+	{
+	public:
+		static constexpr size_t ArrowCapacity = 32;
+
+		struct ArrowKey
+		{
+			int Direction{ 0 };
+			int Length{ 0 };
+			int Width{ 0 };
+			bool Filled{ false };
+
+			bool operator==(const ArrowKey& other) const
+			{
+				return Direction == other.Direction && Length == other.Length && Width == other.Width && Filled == other.Filled;
+			}
+		};
+
+		struct ArrowKeyHash
+		{
+			size_t operator()(const ArrowKey& key) const
+			{
+				return (static_cast<size_t>(key.Direction) << 1 | key.Filled) ^ (static_cast<size_t>(key.Length) << 8) ^ (static_cast<size_t>(key.Width) << 20);
+			}
+		};
+
+		GeometryCache() : m_arrows(ArrowCapacity) {}
+
+		ID2D1StrokeStyle* GetStrokeStyle(D2D1_DASH_STYLE dashStyle);
+		// The points are relative to the center of the arrow, they are only read on a miss.
+		ID2D1PathGeometry* GetArrow(const ArrowKey& key, const D2D1_POINT_2F(&points)[3]);
+
+		void Clear();
+
+		const LruCacheStatistics& GetArrowStatistics() const { return m_arrows.GetStatistics(); }
+
+	private:
+		ComReference<ID2D1StrokeStyle> m_strokeStyles[D2D1_DASH_STYLE_CUSTOM + 1];
+		LruCache<ArrowKey, ComReference<ID2D1PathGeometry>, ArrowKeyHash> m_arrows;
+	};
+}
+
+#endif
+
+#endif
\ No newline at end of file
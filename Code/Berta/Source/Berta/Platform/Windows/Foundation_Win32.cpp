@@ -33,6 +33,7 @@ namespace Berta
 	Foundation Foundation::g_foundation;
 
 	LRESULT CALLBACK Foundation_WndProc(HWND hWnd, uint32_t message, WPARAM wParam, LPARAM lParam);
+	void DispatchInputEvent(const InputEvent& inputEvent);
 	bool ProcessMessage(HWND hWnd, uint32_t message, WPARAM wParam, LPARAM lParam, LRESULT& result);
 
 	HINSTANCE g_hModuleInstance;
@@ -51,6 +52,12 @@ namespace Berta
 		InitializeCore();
 		BT_CORE_TRACE << "Foundation init..." << std::endl;
 
+		m_messageLoop.SetTimerSource(&m_timerWheel);
+		m_inputQueue.SetDispatcher([](const InputEvent& inputEvent)
+		{
+			DispatchInputEvent(inputEvent);
+		});
+
 		//TODO: proper way of implementing dpi awareness.
 		//JustCtrl_Init(): pGetDpiForSystem, pGetDpiForWindow...
 		//https://github.com/sullewarehouse/JustCtrl/blob/main/source/JustCtrl.cpp#L35
@@ -90,15 +97,7 @@ namespace Berta
 
 	void Foundation::ProcessMessages()
 	{
-		MSG msg = { 0 };
-		while (msg.message != WM_QUIT)
-		{
-			if (::PeekMessage(&msg, nullptr, 0, 0, PM_REMOVE))
-			{
-				::TranslateMessage(&msg);
-				::DispatchMessage(&msg);
-			}
-		}
+		m_messageLoop.Run();
 	}
 
 #ifdef BT_PRINT_WND_MESSAGES
@@ -190,6 +189,284 @@ namespace Berta
 	//};
 #endif
 
+	MouseButtonState GetButtonState(WPARAM wParam)
+	{
+		MouseButtonState buttonState{};
+		buttonState.LeftButton = (wParam & MK_LBUTTON) != 0;
+		buttonState.RightButton = (wParam & MK_RBUTTON) != 0;
+		buttonState.MiddleButton = (wParam & MK_MBUTTON) != 0;
+		return buttonState;
+	}
+
+	void ProcessMouseMove(Window* nativeWindow, HWND hWnd, int x, int y, const MouseButtonState& buttonState)
+	{
+		auto& foundation = Foundation::GetInstance();
+		auto& windowManager = foundation.GetWindowManager();
+		auto& rootWindowData = *windowManager.GetFormData(nativeWindow->RootHandle);
+		auto& trackEvent = rootWindowData.TrackEvent;
+
+		auto menuItemReactor = windowManager.GetMenu();
+		if (menuItemReactor)
+		{
+			//TODO: mover esta logica a MenuManager (?)
+			auto currentItemReactor = menuItemReactor;
+			do
+			{
+				auto currentWindow = currentItemReactor->Owner();
+
+				POINT screenToClientPoint{};
+				screenToClientPoint.x = x;
+				screenToClientPoint.y = y;
+				::ClientToScreen(hWnd, &screenToClientPoint);
+
+				::ScreenToClient(currentWindow->RootHandle.Handle, &screenToClientPoint);
+
+				auto localPosition = Point{ (int)screenToClientPoint.x, (int)screenToClientPoint.y } - windowManager.GetAbsoluteRootPosition(currentWindow);
+				if (currentWindow->ClientSize.IsInside(localPosition))
+				{
+					if (rootWindowData.Hovered == nullptr)
+					{
+						ArgMouse argMouseEnter;
+						argMouseEnter.Position = localPosition;
+						argMouseEnter.ButtonState = buttonState;
+
+						//BT_CORE_DEBUG << " - mouse enter / name " << window->Name << ".hovered " << rootWindowData.Hovered << std::endl;
+						foundation.ProcessEvents(currentWindow, &Renderer::MouseEnter, &ControlEvents::MouseEnter, argMouseEnter);
+					}
+
+					ArgMouse argMouseMove;
+					argMouseMove.Position = localPosition;
+					argMouseMove.ButtonState = buttonState;
+
+					//BT_CORE_DEBUG << " - MENU / mouse move name " << currentWindow->Name << ". hovered " << rootWindowData.Hovered << std::endl;
+					foundation.ProcessEvents(currentWindow, &Renderer::MouseMove, &ControlEvents::MouseMove, argMouseMove);
+
+					rootWindowData.Hovered = currentWindow;
+					break;
+				}
+				
+				currentItemReactor = currentItemReactor->Next();
+			} while (currentItemReactor);
+
+			if (currentItemReactor == nullptr && rootWindowData.Hovered)
+			{
+				ArgMouse argMouseLeave;
+				argMouseLeave.Position = Point{ x, y } - windowManager.GetAbsoluteRootPosition(rootWindowData.Hovered);
+				argMouseLeave.ButtonState = buttonState;
+
+				//BT_CORE_DEBUG << " - MENU / mouse leave / name " << rootWindowData.Hovered->Name << ". hovered " << rootWindowData.Hovered << std::endl;
+				foundation.ProcessEvents(rootWindowData.Hovered, &Renderer::MouseLeave, &ControlEvents::MouseLeave, argMouseLeave);
+
+				rootWindowData.Hovered = nullptr;
+			}
+		}
+		else
+		{
+			auto window = windowManager.Find(nativeWindow, { x, y });
+			//BT_CORE_DEBUG << " - window and hovered / window " << (window != nullptr ? window->Name :"NULL") << ". hovered " << (rootWindowData.Hovered != nullptr ? rootWindowData.Hovered->Name : "NULL") << std::endl;
+			if (window && window != rootWindowData.Hovered)
+			{
+				if (rootWindowData.Hovered && windowManager.Exists(rootWindowData.Hovered))
+				{
+					ArgMouse argMouseLeave;
+					argMouseLeave.Position = Point{ x, y } - windowManager.GetAbsoluteRootPosition(rootWindowData.Hovered);
+					argMouseLeave.ButtonState = buttonState;
+
+					//BT_CORE_DEBUG << " - mouse leave / name " << rootWindowData.Hovered->Name << ". hovered " << rootWindowData.Hovered << std::endl;
+					foundation.ProcessEvents(rootWindowData.Hovered, &Renderer::MouseLeave, &ControlEvents::MouseLeave, argMouseLeave);
+				}
+				rootWindowData.Hovered = nullptr;
+			}
+
+			if (window && window->Flags.IsEnabled && !window->Flags.IsDisposed)
+			{
+				Point position = Point{ x, y } - windowManager.GetAbsoluteRootPosition(window);
+				if (window != rootWindowData.Hovered && window->ClientSize.IsInside(position))
+				{
+					ArgMouse argMouseEnter;
+					argMouseEnter.Position = position;
+					argMouseEnter.ButtonState = buttonState;
+
+					//BT_CORE_DEBUG << " - mouse enter / name " << window->Name << ".hovered " << rootWindowData.Hovered << std::endl;
+					foundation.ProcessEvents(window, &Renderer::MouseEnter, &ControlEvents::MouseEnter, argMouseEnter);
+
+					rootWindowData.Hovered = window;
+				}
+
+				if (rootWindowData.Hovered)
+				{
+					ArgMouse argMouseMove;
+					argMouseMove.Position = position;
+					argMouseMove.ButtonState = buttonState;
+
+					//BT_CORE_DEBUG << " - window. MouseMove " << window->Name << std::endl;
+					foundation.ProcessEvents(window, &Renderer::MouseMove, &ControlEvents::MouseMove, argMouseMove);
+				}
+				if (!rootWindowData.IsTracking && window->ClientSize.IsInside(position))
+				{
+					//BT_CORE_DEBUG << " - keep track / name " << window->Name << ". hWnd " << hWnd << std::endl;
+					trackEvent.hwndTrack = hWnd;
+					::TrackMouseEvent(&trackEvent); //Keep track of mouse position to Emit WM_MOUSELEAVE message.
+					rootWindowData.IsTracking = true;
+				}
+			}
+		}
+	}
+
+	void ProcessMouseWheel(Window* nativeWindow, HWND hWnd, const Point& screenPosition, ArgWheel& argWheel)
+	{
+		auto& foundation = Foundation::GetInstance();
+		auto& windowManager = foundation.GetWindowManager();
+
+		POINT screenToClientPoint{};
+		screenToClientPoint.x = screenPosition.X;
+		screenToClientPoint.y = screenPosition.Y;
+		::ScreenToClient(hWnd, &screenToClientPoint);
+
+		auto window = windowManager.Find(nativeWindow, { static_cast<int>(screenToClientPoint.x), static_cast<int>(screenToClientPoint.y) });
+		if (window)
+		{
+			foundation.ProcessEvents(window, &Renderer::MouseWheel, &ControlEvents::MouseWheel, argWheel);
+		}
+	}
+
+	void ProcessResize(Window* nativeWindow, const Size& newSize)
+	{
+		if (newSize.Width > 0 && newSize.Height > 0)
+		{
+			auto& windowManager = Foundation::GetInstance().GetWindowManager();
+			windowManager.Resize(nativeWindow, newSize, false);
+			windowManager.UpdateTree(nativeWindow);
+		}
+	}
+
+	void ProcessKey(Window* nativeWindow, ArgKeyboard& argKeyboard, bool isKeyReleased)
+	{
+		auto& foundation = Foundation::GetInstance();
+		auto& windowManager = foundation.GetWindowManager();
+		auto& rootWindowData = *windowManager.GetFormData(nativeWindow->RootHandle);
+
+		auto target = rootWindowData.Focused;
+		if (target == nullptr)
+		{
+			target = nativeWindow;
+		}
+
+		auto menuItemReactor = windowManager.GetMenu();
+		if (menuItemReactor)
+		{
+			target = menuItemReactor->Owner();
+		}
+
+		if (isKeyReleased)
+		{
+			foundation.ProcessEvents(target, &Renderer::KeyReleased, &ControlEvents::KeyReleased, argKeyboard);
+		}
+		else
+		{
+			foundation.ProcessEvents(target, &Renderer::KeyPressed, &ControlEvents::KeyPressed, argKeyboard);
+		}
+	}
+
+	bool CanCoalesceInput(Window* window)
+	{
+		return window == nullptr || window->Flags.CoalesceInput;
+	}
+
+	bool ToInputEvent(Window* nativeWindow, WindowManager::FormData& rootWindowData, uint32_t message, WPARAM wParam, LPARAM lParam, InputEvent& inputEvent)
+	{
+		if (!nativeWindow->Flags.CoalesceInput)
+		{
+			return false;
+		}
+
+		inputEvent.NativeHandle = nativeWindow->RootHandle;
+		switch (message)
+		{
+		case WM_MOUSEMOVE:
+			if (!CanCoalesceInput(rootWindowData.Hovered) || !CanCoalesceInput(rootWindowData.Pressed))
+			{
+				return false;
+			}
+			inputEvent.EventType = InputEvent::Type::MouseMove;
+			inputEvent.Position = { ((int)(short)LOWORD(lParam)), ((int)(short)HIWORD(lParam)) };
+			inputEvent.ButtonState = GetButtonState(wParam);
+			return true;
+
+		case WM_MOUSEWHEEL:
+		case WM_MOUSEHWHEEL:
+			if (!CanCoalesceInput(rootWindowData.Hovered))
+			{
+				return false;
+			}
+			inputEvent.EventType = InputEvent::Type::MouseWheel;
+			inputEvent.Position = { ((int)(short)LOWORD(lParam)), ((int)(short)HIWORD(lParam)) };
+			inputEvent.Wheel.WheelDelta = ((int)(short)HIWORD(wParam));
+			inputEvent.Wheel.IsVertical = message == WM_MOUSEWHEEL;
+			return true;
+
+		case WM_SIZE:
+			// Programmatic resizes expect the new size right away, only the interactive sizing loop is deferred.
+			if (!rootWindowData.IsSizeMoving)
+			{
+				return false;
+			}
+			inputEvent.EventType = InputEvent::Type::Resize;
+			inputEvent.NewSize = { (uint32_t)LOWORD(lParam), (uint32_t)HIWORD(lParam) };
+			return true;
+
+		case WM_KEYDOWN: // WM_SYSKEYDOWN is left alone, DefWindowProc needs it in order (Alt+F4, Alt menu).
+			if (!CanCoalesceInput(rootWindowData.Focused))
+			{
+				return false;
+			}
+			inputEvent.EventType = InputEvent::Type::KeyPressed;
+			inputEvent.Keyboard.ButtonState.Alt = (0 != (::GetKeyState(VK_MENU) & 0x80));
+			inputEvent.Keyboard.ButtonState.Ctrl = (0 != (::GetKeyState(VK_CONTROL) & 0x80));
+			inputEvent.Keyboard.ButtonState.Shift = (0 != (::GetKeyState(VK_SHIFT) & 0x80));
+			inputEvent.Keyboard.Key = static_cast<wchar_t>(wParam);
+			inputEvent.Keyboard.RepeatCount = (std::max)(1u, static_cast<uint32_t>(LOWORD(lParam)));
+			inputEvent.IsAutoRepeat = (lParam & (1 << 30)) != 0; // Previous key state: down.
+			return true;
+		}
+		return false;
+	}
+
+	void DispatchInputEvent(const InputEvent& inputEvent)
+	{
+		auto& windowManager = Foundation::GetInstance().GetWindowManager();
+		auto nativeWindow = windowManager.Get(inputEvent.NativeHandle);
+		if (nativeWindow == nullptr)
+		{
+			return;
+		}
+
+		DrawBatch drawBatch(nativeWindow);
+		Foundation::RootGuard rootGuard(nativeWindow);
+
+		switch (inputEvent.EventType)
+		{
+		case InputEvent::Type::MouseMove:
+			ProcessMouseMove(nativeWindow, inputEvent.NativeHandle.Handle, inputEvent.Position.X, inputEvent.Position.Y, inputEvent.ButtonState);
+			break;
+		case InputEvent::Type::MouseWheel:
+		{
+			auto argWheel = inputEvent.Wheel;
+			ProcessMouseWheel(nativeWindow, inputEvent.NativeHandle.Handle, inputEvent.Position, argWheel);
+			break;
+		}
+		case InputEvent::Type::Resize:
+			ProcessResize(nativeWindow, inputEvent.NewSize);
+			break;
+		case InputEvent::Type::KeyPressed:
+		{
+			auto argKeyboard = inputEvent.Keyboard;
+			ProcessKey(nativeWindow, argKeyboard, false);
+			break;
+		}
+		}
+	}
+
 	LRESULT CALLBACK Foundation_WndProc(HWND hWnd, uint32_t message, WPARAM wParam, LPARAM lParam)
 	{
 #ifdef BT_PRINT_WND_MESSAGES
@@ -259,6 +536,21 @@ namespace Berta
 		auto& rootWindowData = *windowManager.GetFormData(nativeWindowHandle);
 		auto& trackEvent = rootWindowData.TrackEvent;
 
+		auto& inputQueue = foundation.GetInputQueue();
+		InputEvent inputEvent;
+		if (ToInputEvent(nativeWindow, rootWindowData, message, wParam, lParam, inputEvent))
+		{
+			foundation.QueueInput(inputEvent);
+			if (inputEvent.EventType == InputEvent::Type::KeyPressed)
+			{
+				return ::DefWindowProc(hWnd, message, wParam, lParam);
+			}
+			return 0;
+		}
+
+		// Everything else must see the queued input first.
+		inputQueue.Flush();
+
 		DrawBatch drawBatch(nativeWindow);
 		Berta::Foundation::RootGuard rootGuard(nativeWindow);
 
@@ -294,8 +586,10 @@ namespace Berta
 			ArgActivated argActivated{};
 			argActivated.IsActivated = wParam ? true : false;
 			//BT_CORE_TRACE << "    IsActivated = " << argActivated.IsActivated << ". " << hWnd << std::endl;
-			auto events = dynamic_cast<FormEvents*>(nativeWindow->Events.get());
-			events->Activated.Emit(argActivated);
+			if (auto events = dynamic_cast<FormEvents*>(nativeWindow->Events.get()))
+			{
+				events->Activated.Emit(argActivated);
+			}
 
 			wasHandled = false;
 			break;
@@ -338,7 +632,10 @@ namespace Berta
 
 				ArgVisibility argVisibility;
 				argVisibility.IsVisible = isVisible;
-				nativeWindow->Events->Visibility.Emit(argVisibility);
+				if (nativeWindow->Events)
+				{
+					nativeWindow->Events->Visibility.Emit(argVisibility);
+				}
 
 				auto targetWindow = isVisible ? nativeWindow : nativeWindow->FindFirstNonPanelAncestor();
 				if (targetWindow)
@@ -409,11 +706,7 @@ namespace Berta
 			BT_CORE_DEBUG << "   Size: new size " << newSize << std::endl;
 #endif
 
-			if (newWidth > 0 && newHeight > 0)
-			{
-				windowManager.Resize(nativeWindow, newSize, false);
-				windowManager.UpdateTree(nativeWindow);
-			}
+			ProcessResize(nativeWindow, newSize);
 			wasHandled = true;
 			break;
 		}
@@ -518,124 +811,7 @@ namespace Berta
 			int x = ((int)(short)LOWORD(lParam));
 			int y = ((int)(short)HIWORD(lParam));
 
-			auto menuItemReactor = windowManager.GetMenu();
-			if (menuItemReactor)
-			{
-				//TODO: mover esta logica a MenuManager (?)
-				auto currentItemReactor = menuItemReactor;
-				do
-				{
-					auto currentWindow = currentItemReactor->Owner();
-
-					POINT screenToClientPoint{};
-					screenToClientPoint.x = x;
-					screenToClientPoint.y = y;
-					::ClientToScreen(hWnd, &screenToClientPoint);
-
-					::ScreenToClient(currentWindow->RootHandle.Handle, &screenToClientPoint);
-
-					auto localPosition = Point{ (int)screenToClientPoint.x, (int)screenToClientPoint.y } - windowManager.GetAbsoluteRootPosition(currentWindow);
-					if (currentWindow->ClientSize.IsInside(localPosition))
-					{
-						if (rootWindowData.Hovered == nullptr)
-						{
-							ArgMouse argMouseEnter;
-							argMouseEnter.Position = localPosition;
-							argMouseEnter.ButtonState.LeftButton = (wParam & MK_LBUTTON) != 0;
-							argMouseEnter.ButtonState.RightButton = (wParam & MK_RBUTTON) != 0;
-							argMouseEnter.ButtonState.MiddleButton = (wParam & MK_MBUTTON) != 0;
-
-							//BT_CORE_DEBUG << " - mouse enter / name " << window->Name << ".hovered " << rootWindowData.Hovered << std::endl;
-							foundation.ProcessEvents(currentWindow, &Renderer::MouseEnter, &ControlEvents::MouseEnter, argMouseEnter);
-						}
-
-						ArgMouse argMouseMove;
-						argMouseMove.Position = localPosition;
-						argMouseMove.ButtonState.LeftButton = (wParam & MK_LBUTTON) != 0;
-						argMouseMove.ButtonState.RightButton = (wParam & MK_RBUTTON) != 0;
-						argMouseMove.ButtonState.MiddleButton = (wParam & MK_MBUTTON) != 0;
-
-						//BT_CORE_DEBUG << " - MENU / mouse move name " << currentWindow->Name << ". hovered " << rootWindowData.Hovered << std::endl;
-						foundation.ProcessEvents(currentWindow, &Renderer::MouseMove, &ControlEvents::MouseMove, argMouseMove);
-
-						rootWindowData.Hovered = currentWindow;
-						break;
-					}
-					
-					currentItemReactor = currentItemReactor->Next();
-				} while (currentItemReactor);
-
-				if (currentItemReactor == nullptr && rootWindowData.Hovered)
-				{
-					ArgMouse argMouseLeave;
-					argMouseLeave.Position = Point{ x, y } - windowManager.GetAbsoluteRootPosition(rootWindowData.Hovered);
-					argMouseLeave.ButtonState.LeftButton = (wParam & MK_LBUTTON) != 0;
-					argMouseLeave.ButtonState.RightButton = (wParam & MK_RBUTTON) != 0;
-					argMouseLeave.ButtonState.MiddleButton = (wParam & MK_MBUTTON) != 0;
-
-					//BT_CORE_DEBUG << " - MENU / mouse leave / name " << rootWindowData.Hovered->Name << ". hovered " << rootWindowData.Hovered << std::endl;
-					foundation.ProcessEvents(rootWindowData.Hovered, &Renderer::MouseLeave, &ControlEvents::MouseLeave, argMouseLeave);
-
-					rootWindowData.Hovered = nullptr;
-				}
-			}
-			else
-			{
-				auto window = windowManager.Find(nativeWindow, { x, y });
-				//BT_CORE_DEBUG << " - window and hovered / window " << (window != nullptr ? window->Name :"NULL") << ". hovered " << (rootWindowData.Hovered != nullptr ? rootWindowData.Hovered->Name : "NULL") << std::endl;
-				if (window && window != rootWindowData.Hovered)
-				{
-					if (rootWindowData.Hovered && windowManager.Exists(rootWindowData.Hovered))
-					{
-						ArgMouse argMouseLeave;
-						argMouseLeave.Position = Point{ x, y } - windowManager.GetAbsoluteRootPosition(rootWindowData.Hovered);
-						argMouseLeave.ButtonState.LeftButton = (wParam & MK_LBUTTON) != 0;
-						argMouseLeave.ButtonState.RightButton = (wParam & MK_RBUTTON) != 0;
-						argMouseLeave.ButtonState.MiddleButton = (wParam & MK_MBUTTON) != 0;
-
-						//BT_CORE_DEBUG << " - mouse leave / name " << rootWindowData.Hovered->Name << ". hovered " << rootWindowData.Hovered << std::endl;
-						foundation.ProcessEvents(rootWindowData.Hovered, &Renderer::MouseLeave, &ControlEvents::MouseLeave, argMouseLeave);
-					}
-					rootWindowData.Hovered = nullptr;
-				}
-
-				if (window && window->Flags.IsEnabled && !window->Flags.IsDisposed)
-				{
-					Point position = Point{ x, y } - windowManager.GetAbsoluteRootPosition(window);
-					if (window != rootWindowData.Hovered && window->ClientSize.IsInside(position))
-					{
-						ArgMouse argMouseEnter;
-						argMouseEnter.Position = position;
-						argMouseEnter.ButtonState.LeftButton = (wParam & MK_LBUTTON) != 0;
-						argMouseEnter.ButtonState.RightButton = (wParam & MK_RBUTTON) != 0;
-						argMouseEnter.ButtonState.MiddleButton = (wParam & MK_MBUTTON) != 0;
-
-						//BT_CORE_DEBUG << " - mouse enter / name " << window->Name << ".hovered " << rootWindowData.Hovered << std::endl;
-						foundation.ProcessEvents(window, &Renderer::MouseEnter, &ControlEvents::MouseEnter, argMouseEnter);
-
-						rootWindowData.Hovered = window;
-					}
-
-					if (rootWindowData.Hovered)
-					{
-						ArgMouse argMouseMove;
-						argMouseMove.Position = position;
-						argMouseMove.ButtonState.LeftButton = (wParam & MK_LBUTTON) != 0;
-						argMouseMove.ButtonState.RightButton = (wParam & MK_RBUTTON) != 0;
-						argMouseMove.ButtonState.MiddleButton = (wParam & MK_MBUTTON) != 0;
-
-						//BT_CORE_DEBUG << " - window. MouseMove " << window->Name << std::endl;
-						foundation.ProcessEvents(window, &Renderer::MouseMove, &ControlEvents::MouseMove, argMouseMove);
-					}
-					if (!rootWindowData.IsTracking && window->ClientSize.IsInside(position))
-					{
-						//BT_CORE_DEBUG << " - keep track / name " << window->Name << ". hWnd " << hWnd << std::endl;
-						trackEvent.hwndTrack = hWnd;
-						::TrackMouseEvent(&trackEvent); //Keep track of mouse position to Emit WM_MOUSELEAVE message.
-						rootWindowData.IsTracking = true;
-					}
-				}
-			}
+			ProcessMouseMove(nativeWindow, hWnd, x, y, GetButtonState(wParam));
 			break;
 		}
 		case WM_LBUTTONUP:
@@ -710,23 +886,13 @@ namespace Berta
 		{
 			wasHandled = true;
 
-			int wheelDelta = ((int)(short)HIWORD(wParam));
+			ArgWheel argWheel{};
+			argWheel.WheelDelta = ((int)(short)HIWORD(wParam));
+			argWheel.IsVertical = message == WM_MOUSEWHEEL;
 			int x = ((int)(short)LOWORD(lParam));
 			int y = ((int)(short)HIWORD(lParam));
-			POINT screenToClientPoint{};
-			screenToClientPoint.x = x;
-			screenToClientPoint.y = y;
-			::ScreenToClient(hWnd, &screenToClientPoint);
 
-			auto window = windowManager.Find(nativeWindow, { static_cast<int>(screenToClientPoint.x), static_cast<int>(screenToClientPoint.y) });
-			if (window)
-			{
-				ArgWheel argWheel{};
-				argWheel.WheelDelta = wheelDelta;
-				argWheel.IsVertical = message == WM_MOUSEWHEEL;
-
-				foundation.ProcessEvents(window, &Renderer::MouseWheel, &ControlEvents::MouseWheel, argWheel);
-			}
+			ProcessMouseWheel(nativeWindow, hWnd, { x, y }, argWheel);
 			break;
 		}
 		case WM_CHAR:
@@ -761,51 +927,47 @@ namespace Berta
 			argKeyboard.ButtonState.Shift = (0 != (::GetKeyState(VK_SHIFT) & 0x80));
 			argKeyboard.Key = static_cast<wchar_t>(wParam);
 
-			auto window = rootWindowData.Focused;
-			if (window == nullptr)
-			{
-				window = nativeWindow;
-			}
-			
 			WORD keyFlags = HIWORD(lParam);
 			BOOL isKeyReleased = (keyFlags & KF_UP) == KF_UP;
-
-			auto target = window;
-			auto menuItemReactor = windowManager.GetMenu();
-			if (menuItemReactor)
-			{
-				target = menuItemReactor->Owner();
-			}
-			if (isKeyReleased)
-			{
-				foundation.ProcessEvents(target, &Renderer::KeyReleased, &ControlEvents::KeyReleased, argKeyboard);
-			}
-			else
+			if (!isKeyReleased)
 			{
-				foundation.ProcessEvents(target, &Renderer::KeyPressed, &ControlEvents::KeyPressed, argKeyboard);
+				argKeyboard.RepeatCount = (std::max)(1u, static_cast<uint32_t>(LOWORD(lParam)));
 			}
-			
+
+			ProcessKey(nativeWindow, argKeyboard, isKeyReleased);
 			break;
 		}
 		case WM_ENTERSIZEMOVE:
 		{
+			rootWindowData.IsSizeMoving = true;
+			foundation.GetMessageLoop().EnterNativeModalLoop(hWnd);
+
 			ArgSizeMove argSizeMove;
-			auto events = dynamic_cast<FormEvents*>(nativeWindow->Events.get());
-			events->EnterSizeMove.Emit(argSizeMove);
+			if (auto events = dynamic_cast<FormEvents*>(nativeWindow->Events.get()))
+			{
+				events->EnterSizeMove.Emit(argSizeMove);
+			}
 			break;
 		}
 		case WM_EXITSIZEMOVE:
 		{
+			rootWindowData.IsSizeMoving = false;
+			foundation.GetMessageLoop().ExitNativeModalLoop();
+
 			ArgSizeMove argSizeMove;
-			auto events = dynamic_cast<FormEvents*>(nativeWindow->Events.get());
-			events->ExitSizeMove.Emit(argSizeMove);
+			if (auto events = dynamic_cast<FormEvents*>(nativeWindow->Events.get()))
+			{
+				events->ExitSizeMove.Emit(argSizeMove);
+			}
 			break;
 		}
 		case WM_CLOSE:
 		{
 			ArgDisposing argDisposing{ false };
-			auto events = dynamic_cast<FormEvents*>(nativeWindow->Events.get());
-			events->Disposing.Emit(argDisposing);
+			if (auto events = dynamic_cast<FormEvents*>(nativeWindow->Events.get()))
+			{
+				events->Disposing.Emit(argDisposing);
+			}
 			if (argDisposing.Cancel)
 			{
 				wasHandled = true;
@@ -856,6 +1018,20 @@ namespace Berta
 
 		switch (message)
 		{
+		case WM_TIMER:
+		{
+			if (wParam == MessageLoop::NativeModalTimerId)
+			{
+				Foundation::GetInstance().GetMessageLoop().NativeModalTimerTick();
+				return true;
+			}
+			break;
+		}
+		case static_cast<uint32_t>(CustomMessageId::ModalLoopWakeup):
+		{
+			Foundation::GetInstance().GetMessageLoop().NativeModalTimerTick();
+			return true;
+		}
 		case static_cast<uint32_t>(CustomMessageId::CustomCallback):
 
 		case WM_ERASEBKGND:
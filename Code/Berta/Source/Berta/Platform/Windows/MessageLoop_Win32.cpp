@@ -0,0 +1,144 @@
+/*
+* MIT License
+*
+* Copyright (c) 2024 Edgar Bernal (edgar.bernal@gmail.com)
+*/
+
+#include "btpch.h"
+#include "Berta/Core/MessageLoop.h"
+
+#ifdef BT_PLATFORM_WINDOWS
+
+#include "Berta/Platform/Windows/Messages.h"
+
+#include <algorithm>
+
+namespace Berta
+{
+	void MessageLoop::InitializeNative()
+	{
+		m_wakeupEvent = ::CreateEvent(nullptr, FALSE, FALSE, nullptr);
+		if (m_wakeupEvent == nullptr)
+		{
+			BT_CORE_ERROR << "CreateEvent Failed. GetLastError() = " << ::GetLastError() << std::endl;
+		}
+	}
+
+	void MessageLoop::ShutdownNative()
+	{
+		if (m_wakeupEvent)
+		{
+			::CloseHandle(m_wakeupEvent);
+			m_wakeupEvent = nullptr;
+		}
+	}
+
+	bool MessageLoop::PumpNativeMessages()
+	{
+		bool didWork = false;
+		MSG msg = { 0 };
+		while (::PeekMessage(&msg, nullptr, 0, 0, PM_REMOVE))
+		{
+			if (msg.message == WM_QUIT)
+			{
+				m_exitCode = static_cast<int>(msg.wParam);
+				m_quitRequested = true;
+				return true;
+			}
+
+			::TranslateMessage(&msg);
+			::DispatchMessage(&msg);
+
+			++m_statistics.NativeMessages;
+			didWork = true;
+
+			if (m_quitRequested)
+			{
+				break;
+			}
+		}
+		return didWork;
+	}
+
+	bool MessageLoop::HasPendingNativeMessages() const
+	{
+		// High word: kinds of messages currently in the queue (doesn't remove anything).
+		return HIWORD(::GetQueueStatus(QS_INPUT | QS_PAINT | QS_POSTMESSAGE)) != 0;
+	}
+
+	void MessageLoop::WaitForWork(std::chrono::milliseconds timeout)
+	{
+		DWORD nativeTimeout = INFINITE;
+		if (timeout != InfiniteTimeout)
+		{
+			nativeTimeout = static_cast<DWORD>((std::min)(timeout.count(), static_cast<std::chrono::milliseconds::rep>(INFINITE - 1)));
+		}
+
+		DWORD handleCount = m_wakeupEvent ? 1 : 0;
+
+		// MWMO_INPUTAVAILABLE: wake up even if the input was already seen by a previous PeekMessage.
+		::MsgWaitForMultipleObjectsEx(handleCount, handleCount ? &m_wakeupEvent : nullptr, nativeTimeout, QS_ALLINPUT, MWMO_INPUTAVAILABLE);
+	}
+
+	void MessageLoop::EnterNativeModalLoop(HWND window)
+	{
+		m_modalWindow.store(window);
+		NativeModalTimerTick(); // Runs what was posted before the loop started and arms the timer.
+	}
+
+	void MessageLoop::ExitNativeModalLoop()
+	{
+		// A wakeup message still in flight finds no modal window and is ignored, the event was set as well.
+		if (auto window = m_modalWindow.exchange(nullptr))
+		{
+			::KillTimer(window, NativeModalTimerId);
+		}
+	}
+
+	void MessageLoop::NativeModalTimerTick()
+	{
+		auto window = m_modalWindow.load();
+		if (!window)
+		{
+			return;
+		}
+
+		++m_statistics.Iterations;
+		RunPostedTasks();
+		RunTimers();
+
+		if (!m_tasks.IsEmpty())
+		{
+			Wakeup(); // The time slice ran out, continue with the next message.
+		}
+
+		auto timeout = GetWaitTimeout();
+		if (timeout == InfiniteTimeout)
+		{
+			::KillTimer(window, NativeModalTimerId);
+			return;
+		}
+
+		// SetTimer with the same id replaces the previous interval.
+		auto interval = static_cast<UINT>(std::clamp<std::chrono::milliseconds::rep>(timeout.count(), USER_TIMER_MINIMUM, USER_TIMER_MAXIMUM));
+		if (::SetTimer(window, NativeModalTimerId, interval, nullptr) == 0)
+		{
+			BT_CORE_ERROR << "SetTimer Failed. GetLastError() = " << ::GetLastError() << std::endl;
+		}
+	}
+
+	void MessageLoop::WakeupNative()
+	{
+		if (m_wakeupEvent)
+		{
+			::SetEvent(m_wakeupEvent);
+		}
+
+		if (auto window = m_modalWindow.load())
+		{
+			::PostMessage(window, static_cast<UINT>(CustomMessageId::ModalLoopWakeup), 0, 0);
+		}
+	}
+}
+
+#endif
\ No newline at end of file
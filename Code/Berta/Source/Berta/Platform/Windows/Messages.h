@@ -20,6 +20,7 @@ namespace Berta
 	enum class CustomMessageId : uint32_t
 	{
 		CustomCallback = WM_USER + 1,
+		ModalLoopWakeup = WM_USER + 2,	// See MessageLoop::EnterNativeModalLoop.
 	};
 }
 
@@ -0,0 +1,850 @@
+/*
+* MIT License
+*
+* Copyright (c) 2024 Edgar Bernal (edgar.bernal@gmail.com)
+*/
+
+#include "btpch.h"
+#include "X11Display.h"
+
+#ifdef BT_PLATFORM_X11
+
+#include "Berta/API/PaintAPI.h"
+#include "Berta/Core/MessageLoop.h"
+#include "Berta/GUI/EnumTypes.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+#include <string>
+#include <sys/ipc.h>
+#include <sys/shm.h>
+
+#include <X11/Xlib.h>
+#include <X11/Xutil.h>
+#include <X11/Xatom.h>
+#include <X11/XKBlib.h>
+#include <X11/cursorfont.h>
+#include <X11/keysym.h>
+#include <X11/extensions/XShm.h>
+
+namespace Berta
+{
+	struct X11Display::NativeWindow
+	{
+		::Window Handle{ 0 };
+		XImage* Image{ nullptr };				// Client area sized, recreated on resize.
+		XShmSegmentInfo Shm{};
+		Size ImageSize;
+		std::vector<Rectangle> PendingPuts;		// SHM puts the server may still be reading.
+	};
+
+	namespace
+	{
+		constexpr unsigned long DoubleClickTime = 500;	// Milliseconds, Win32 default.
+		constexpr int DoubleClickDistance = 4;
+		constexpr int WheelDelta = 120;					// WHEEL_DELTA, one notch.
+
+		bool g_shmAttachFailed = false;
+
+		int ShmAttachErrorHandler(::Display*, XErrorEvent*)
+		{
+			g_shmAttachFailed = true;
+			return 0;
+		}
+
+		// Virtual key codes, like Win32 (see KeyboardKey). 0 when there is none.
+		wchar_t ToKeyboardKey(KeySym keySym)
+		{
+			if (keySym >= XK_a && keySym <= XK_z)
+			{
+				return static_cast<wchar_t>('A' + (keySym - XK_a));
+			}
+			if ((keySym >= XK_A && keySym <= XK_Z) || (keySym >= XK_0 && keySym <= XK_9))
+			{
+				return static_cast<wchar_t>(keySym);
+			}
+			if (keySym >= XK_F1 && keySym <= XK_F24)
+			{
+				return static_cast<wchar_t>(0x70 + (keySym - XK_F1));	// VK_F1
+			}
+			if (keySym >= XK_KP_0 && keySym <= XK_KP_9)
+			{
+				return static_cast<wchar_t>(0x60 + (keySym - XK_KP_0));	// VK_NUMPAD0
+			}
+
+			switch (keySym)
+			{
+			case XK_BackSpace: return KeyboardKey::Backspace;
+			case XK_Tab:
+			case XK_ISO_Left_Tab: return 0x09;
+			case XK_Return:
+			case XK_KP_Enter: return KeyboardKey::Enter;
+			case XK_Shift_L:
+			case XK_Shift_R: return KeyboardKey::Shift;
+			case XK_Control_L:
+			case XK_Control_R: return KeyboardKey::Control;
+			case XK_Alt_L:
+			case XK_Alt_R:
+			case XK_Meta_L:
+			case XK_Meta_R: return KeyboardKey::Alt;
+			case XK_Escape: return KeyboardKey::Escape;
+			case XK_space: return KeyboardKey::Space;
+			case XK_Prior:
+			case XK_KP_Prior: return KeyboardKey::PageUp;
+			case XK_Next:
+			case XK_KP_Next: return KeyboardKey::PageDown;
+			case XK_End:
+			case XK_KP_End: return KeyboardKey::End;
+			case XK_Home:
+			case XK_KP_Home: return KeyboardKey::Home;
+			case XK_Left:
+			case XK_KP_Left: return KeyboardKey::ArrowLeft;
+			case XK_Up:
+			case XK_KP_Up: return KeyboardKey::ArrowUp;
+			case XK_Right:
+			case XK_KP_Right: return KeyboardKey::ArrowRight;
+			case XK_Down:
+			case XK_KP_Down: return KeyboardKey::ArrowDown;
+			case XK_Insert:
+			case XK_KP_Insert: return 0x2D;		// VK_INSERT
+			case XK_Delete:
+			case XK_KP_Delete: return KeyboardKey::Delete;
+			default: return 0;
+			}
+		}
+
+		ArgKeyboard::KeyboardState ToModifiers(unsigned int state)
+		{
+			ArgKeyboard::KeyboardState modifiers{};
+			modifiers.Alt = (state & Mod1Mask) != 0;
+			modifiers.Ctrl = (state & ControlMask) != 0;
+			modifiers.Shift = (state & ShiftMask) != 0;
+			return modifiers;
+		}
+
+		std::string ToUtf8(const std::wstring& text)
+		{
+			std::string result;
+			result.reserve(text.size());
+			for (auto character : text)
+			{
+				auto codePoint = static_cast<uint32_t>(character);
+				if (codePoint < 0x80)
+				{
+					result += static_cast<char>(codePoint);
+				}
+				else if (codePoint < 0x800)
+				{
+					result += static_cast<char>(0xC0 | (codePoint >> 6));
+					result += static_cast<char>(0x80 | (codePoint & 0x3F));
+				}
+				else if (codePoint < 0x10000)
+				{
+					result += static_cast<char>(0xE0 | (codePoint >> 12));
+					result += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+					result += static_cast<char>(0x80 | (codePoint & 0x3F));
+				}
+				else
+				{
+					result += static_cast<char>(0xF0 | (codePoint >> 18));
+					result += static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+					result += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+					result += static_cast<char>(0x80 | (codePoint & 0x3F));
+				}
+			}
+			return result;
+		}
+
+		// Xft.dpi of the resource database (what desktops set for scaling), 96 if it is not there.
+		uint32_t GetResourceDpi(::Display* display)
+		{
+			auto resources = XResourceManagerString(display);
+			if (resources)
+			{
+				std::string text(resources);
+				auto position = text.find("Xft.dpi:");
+				if (position != std::string::npos)
+				{
+					auto dpi = std::atoi(text.c_str() + position + 8);
+					if (dpi > 0)
+					{
+						return static_cast<uint32_t>(dpi);
+					}
+				}
+			}
+			return 96u;
+		}
+
+		bool Intersects(const Rectangle& a, const Rectangle& b)
+		{
+			return a.X < b.X + static_cast<int>(b.Width) && b.X < a.X + static_cast<int>(a.Width) &&
+				a.Y < b.Y + static_cast<int>(b.Height) && b.Y < a.Y + static_cast<int>(a.Height);
+		}
+	}
+
+	X11Display::X11Display() = default;
+
+	X11Display::~X11Display()
+	{
+		Close();
+	}
+
+	bool X11Display::Open(MessageLoop& messageLoop)
+	{
+		m_display = XOpenDisplay(nullptr);
+		if (!m_display)
+		{
+			BT_CORE_TRACE << "No X display, staying headless." << std::endl;
+			return false;
+		}
+
+		m_screen = DefaultScreen(m_display);
+		m_root = RootWindow(m_display, m_screen);
+
+		// Root graphics pixels are put as they are.
+		auto visual = DefaultVisual(m_display, m_screen);
+		auto depth = DefaultDepth(m_display, m_screen);
+		if ((depth != 24 && depth != 32) || visual->red_mask != 0xFF0000 || visual->green_mask != 0xFF00 || visual->blue_mask != 0xFF ||
+			ImageByteOrder(m_display) != LSBFirst)
+		{
+			BT_CORE_ERROR << "Unsupported X visual (depth = " << depth << "), staying headless." << std::endl;
+			XCloseDisplay(m_display);
+			m_display = nullptr;
+			return false;
+		}
+
+		m_hasShm = XShmQueryExtension(m_display);
+		m_gc = XCreateGC(m_display, m_root, 0, nullptr);
+		XkbSetDetectableAutoRepeat(m_display, True, nullptr);
+
+		m_wmProtocols = XInternAtom(m_display, "WM_PROTOCOLS", False);
+		m_wmDeleteWindow = XInternAtom(m_display, "WM_DELETE_WINDOW", False);
+		m_netWmName = XInternAtom(m_display, "_NET_WM_NAME", False);
+		m_utf8String = XInternAtom(m_display, "UTF8_STRING", False);
+		m_motifWmHints = XInternAtom(m_display, "_MOTIF_WM_HINTS", False);
+
+		auto& virtualDisplay = VirtualDisplay::GetInstance();
+		virtualDisplay.SetScreenSize({ static_cast<uint32_t>(DisplayWidth(m_display, m_screen)), static_cast<uint32_t>(DisplayHeight(m_display, m_screen)) });
+		virtualDisplay.SetDpi(GetResourceDpi(m_display));
+
+		m_messageLoop = &messageLoop;
+		m_connection = ConnectionNumber(m_display);
+		messageLoop.WatchFileDescriptor(m_connection, [this](uint32_t)
+		{
+			ProcessEvents();
+		});
+		// Round trips (XSync, XGetWindowAttributes, XTranslateCoordinates...) read events into the Xlib queue.
+		// XPending also flushes requests still buffered in Xlib before the loop sleeps.
+		messageLoop.SetPreWaitHandler([this]()
+		{
+			if (XPending(m_display) == 0)
+			{
+				return false;
+			}
+			ProcessEvents();
+			return true;
+		});
+
+		virtualDisplay.SetBackend(this);
+		BT_CORE_TRACE << "X11 display: " << DisplayString(m_display) << ", MIT-SHM = " << m_hasShm << std::endl;
+		return true;
+	}
+
+	void X11Display::Close()
+	{
+		if (!m_display)
+		{
+			return;
+		}
+
+		auto& virtualDisplay = VirtualDisplay::GetInstance();
+		if (virtualDisplay.GetBackend() == this)
+		{
+			virtualDisplay.SetBackend(nullptr);
+		}
+
+		for (auto& [window, nativeWindow] : m_windows)
+		{
+			ReleaseImage(*nativeWindow);
+			XDestroyWindow(m_display, nativeWindow->Handle);
+		}
+		m_windows.clear();
+		m_records.clear();
+
+		for (auto& cursor : m_cursors)
+		{
+			if (cursor)
+			{
+				XFreeCursor(m_display, cursor);
+				cursor = 0;
+			}
+		}
+
+		if (m_messageLoop)
+		{
+			m_messageLoop->UnwatchFileDescriptor(m_connection);
+			m_messageLoop->SetPreWaitHandler({});
+			m_messageLoop = nullptr;
+		}
+		XFreeGC(m_display, m_gc);
+		XCloseDisplay(m_display);
+		m_display = nullptr;
+		m_gc = nullptr;
+		m_connection = -1;
+	}
+
+	void X11Display::Create(VirtualWindow* window)
+	{
+		auto parent = window->IsNested && window->Parent ? GetHandle(window->Parent) : m_root;
+
+		// The server never paints the background, Present covers the exposed area.
+		XSetWindowAttributes attributes{};
+		attributes.background_pixmap = None;
+		attributes.bit_gravity = NorthWestGravity;
+		attributes.event_mask = ExposureMask | StructureNotifyMask | KeyPressMask | KeyReleaseMask | ButtonPressMask | ButtonReleaseMask |
+			PointerMotionMask | LeaveWindowMask | FocusChangeMask;
+		unsigned long valueMask = CWBackPixmap | CWBitGravity | CWEventMask;
+
+		// Popups (menus, drop downs, docking indicators) bypass the window manager, like WS_POPUP tool windows.
+		const auto& style = window->Style;
+		bool isPopup = !window->IsNested && !style.TitleBarAndCaption && !style.AppWindow && !style.Sizable;
+		if (isPopup)
+		{
+			attributes.override_redirect = True;
+			valueMask |= CWOverrideRedirect;
+		}
+
+		auto handle = XCreateWindow(m_display, parent, window->Position.X, window->Position.Y,
+			(std::max)(window->ClientSize.Width, 1u), (std::max)(window->ClientSize.Height, 1u), 0,
+			CopyFromParent, InputOutput, CopyFromParent, valueMask, &attributes);
+
+		if (!window->IsNested)
+		{
+			Atom protocols[] = { m_wmDeleteWindow };
+			XSetWMProtocols(m_display, handle, protocols, 1);
+
+			// Client area position, not the decorations'.
+			XSizeHints sizeHints{};
+			sizeHints.flags = PPosition | PSize | PWinGravity;
+			sizeHints.win_gravity = StaticGravity;
+			if (!style.Sizable)
+			{
+				sizeHints.flags |= PMinSize | PMaxSize;
+				sizeHints.min_width = sizeHints.max_width = static_cast<int>(window->ClientSize.Width);
+				sizeHints.min_height = sizeHints.max_height = static_cast<int>(window->ClientSize.Height);
+			}
+			XSetWMNormalHints(m_display, handle, &sizeHints);
+
+			if (!style.TitleBarAndCaption && !isPopup)
+			{
+				long motifHints[5] = { 2, 0, 0, 0, 0 };	// MWM_HINTS_DECORATIONS, none.
+				XChangeProperty(m_display, handle, m_motifWmHints, m_motifWmHints, 32, PropModeReplace,
+					reinterpret_cast<unsigned char*>(motifHints), 5);
+			}
+			if (window->Owner)
+			{
+				XSetTransientForHint(m_display, handle, GetHandle(window->Owner));
+			}
+		}
+
+		auto nativeWindow = std::make_unique<NativeWindow>();
+		nativeWindow->Handle = handle;
+		m_windows.emplace(window, std::move(nativeWindow));
+		m_records.emplace(handle, window);
+		XFlush(m_display);
+	}
+
+	void X11Display::Destroy(VirtualWindow* window)
+	{
+		auto it = m_windows.find(window);
+		if (it == m_windows.end())
+		{
+			return;
+		}
+
+		ReleaseImage(*it->second);
+		XDestroyWindow(m_display, it->second->Handle);
+		XFlush(m_display);
+		m_records.erase(it->second->Handle);
+		m_windows.erase(it);
+		if (m_lastClickWindow == window)
+		{
+			m_lastClickWindow = nullptr;
+		}
+	}
+
+	void X11Display::Show(VirtualWindow* window)
+	{
+		auto handle = GetHandle(window);
+		if (window->Visible)
+		{
+			XMapRaised(m_display, handle);
+		}
+		else
+		{
+			XUnmapWindow(m_display, handle);
+		}
+		XFlush(m_display);
+	}
+
+	void X11Display::Move(VirtualWindow* window)
+	{
+		XMoveResizeWindow(m_display, GetHandle(window), window->Position.X, window->Position.Y,
+			(std::max)(window->ClientSize.Width, 1u), (std::max)(window->ClientSize.Height, 1u));
+		XFlush(m_display);
+	}
+
+	void X11Display::SetParent(VirtualWindow* window)
+	{
+		auto handle = GetHandle(window);
+		if (window->IsNested)
+		{
+			XReparentWindow(m_display, handle, window->Parent ? GetHandle(window->Parent) : m_root, window->Position.X, window->Position.Y);
+		}
+		else
+		{
+			XSetTransientForHint(m_display, handle, window->Owner ? GetHandle(window->Owner) : m_root);
+		}
+		XFlush(m_display);
+	}
+
+	void X11Display::SetCaption(VirtualWindow* window)
+	{
+		auto handle = GetHandle(window);
+		auto caption = ToUtf8(window->Caption);
+		XChangeProperty(m_display, handle, m_netWmName, m_utf8String, 8, PropModeReplace,
+			reinterpret_cast<const unsigned char*>(caption.c_str()), static_cast<int>(caption.size()));
+		XStoreName(m_display, handle, caption.c_str());	// Older window managers.
+		XFlush(m_display);
+	}
+
+	void X11Display::SetCursor(VirtualWindow* window)
+	{
+		auto index = static_cast<size_t>(window->CurrentCursor);
+		if (index >= std::size(m_cursors))
+		{
+			return;
+		}
+
+		if (!m_cursors[index])
+		{
+			unsigned int shape = XC_left_ptr;
+			switch (window->CurrentCursor)
+			{
+			case Cursor::Default: shape = XC_left_ptr; break;
+			case Cursor::IBeam: shape = XC_xterm; break;
+			case Cursor::Wait: shape = XC_watch; break;
+			case Cursor::SizeWE: shape = XC_sb_h_double_arrow; break;
+			case Cursor::SizeNS: shape = XC_sb_v_double_arrow; break;
+			}
+			m_cursors[index] = XCreateFontCursor(m_display, shape);
+		}
+
+		XDefineCursor(m_display, GetHandle(window), m_cursors[index]);
+		XFlush(m_display);
+	}
+
+	void X11Display::Capture(VirtualWindow* window, bool capture)
+	{
+		if (capture)
+		{
+			auto result = XGrabPointer(m_display, GetHandle(window), True, ButtonPressMask | ButtonReleaseMask | PointerMotionMask,
+				GrabModeAsync, GrabModeAsync, None, None, CurrentTime);
+			if (result != GrabSuccess)
+			{
+				BT_CORE_ERROR << "XGrabPointer Failed. result = " << result << std::endl;
+			}
+		}
+		else
+		{
+			XUngrabPointer(m_display, CurrentTime);
+		}
+		XFlush(m_display);
+	}
+
+	void X11Display::Present(VirtualWindow* window, const PaintNativeHandle& source, const Rectangle& area, const Point& sourcePoint)
+	{
+		auto it = m_windows.find(window);
+		if (it == m_windows.end())
+		{
+			return;
+		}
+
+		auto& nativeWindow = *it->second;
+		if (!EnsureImage(nativeWindow, window->ClientSize))
+		{
+			return;
+		}
+
+		// Disjoint areas can be written while the server reads the previous puts.
+		for (auto& pendingPut : nativeWindow.PendingPuts)
+		{
+			if (Intersects(pendingPut, area))
+			{
+				WaitForPuts();
+				break;
+			}
+		}
+
+		auto image = nativeWindow.Image;
+		auto rowSize = static_cast<size_t>(area.Width) * sizeof(uint32_t);
+		for (uint32_t y = 0; y < area.Height; ++y)
+		{
+			auto sourceRow = source.m_pixels.data() + static_cast<size_t>(sourcePoint.Y + y) * source.m_size.Width + sourcePoint.X;
+			auto targetRow = image->data + static_cast<size_t>(area.Y + y) * image->bytes_per_line + static_cast<size_t>(area.X) * sizeof(uint32_t);
+			std::memcpy(targetRow, sourceRow, rowSize);
+		}
+
+		if (nativeWindow.Shm.shmaddr)
+		{
+			XShmPutImage(m_display, nativeWindow.Handle, m_gc, image, area.X, area.Y, area.X, area.Y, area.Width, area.Height, False);
+			nativeWindow.PendingPuts.push_back(area);
+			m_putsPending = true;
+			++m_statistics.ShmPuts;
+		}
+		else
+		{
+			XPutImage(m_display, nativeWindow.Handle, m_gc, image, area.X, area.Y, area.X, area.Y, area.Width, area.Height);
+			++m_statistics.Puts;
+		}
+		XFlush(m_display);
+	}
+
+	void X11Display::ProcessEvents()
+	{
+		while (XPending(m_display) > 0)
+		{
+			XEvent event;
+			XNextEvent(m_display, &event);
+			++m_statistics.Events;
+			HandleEvent(event);
+
+			if (!m_display)
+			{
+				return;
+			}
+		}
+	}
+
+	void X11Display::HandleEvent(XEvent& event)
+	{
+		if (event.type == MappingNotify)
+		{
+			XRefreshKeyboardMapping(&event.xmapping);
+			return;
+		}
+
+		auto window = GetRecord(event.xany.window);
+		if (!window)
+		{
+			return;
+		}
+
+		auto& virtualDisplay = VirtualDisplay::GetInstance();
+		switch (event.type)
+		{
+		case Expose:
+		{
+			NativeEvent paintEvent;
+			paintEvent.EventType = NativeEvent::Type::Paint;
+			paintEvent.Target = window;
+			paintEvent.Area = { event.xexpose.x, event.xexpose.y, static_cast<uint32_t>(event.xexpose.width), static_cast<uint32_t>(event.xexpose.height) };
+			virtualDisplay.Post(std::move(paintEvent));
+			break;
+		}
+		case ConfigureNotify:
+			HandleConfigure(window, event);
+			break;
+		case MotionNotify:
+			virtualDisplay.InjectMouseMove(window, { event.xmotion.x, event.xmotion.y });
+			break;
+		case ButtonPress:
+		case ButtonRelease:
+		{
+			auto& buttonEvent = event.xbutton;
+			Point position{ buttonEvent.x, buttonEvent.y };
+			if (buttonEvent.button >= Button4 && buttonEvent.button <= 7)
+			{
+				if (event.type == ButtonPress)
+				{
+					bool isVertical = buttonEvent.button <= Button5;
+					int delta = (buttonEvent.button == Button4 || buttonEvent.button == 7) ? WheelDelta : -WheelDelta;	// Up and right are positive.
+					virtualDisplay.InjectMouseWheel(window, position, delta, isVertical);
+				}
+				break;
+			}
+
+			auto button = buttonEvent.button == Button3 ? NativeEvent::Button::Right :
+				(buttonEvent.button == Button2 ? NativeEvent::Button::Middle : NativeEvent::Button::Left);
+			if (event.type == ButtonRelease)
+			{
+				virtualDisplay.InjectMouseUp(window, position, button);
+				break;
+			}
+
+			if (button == NativeEvent::Button::Left)
+			{
+				// X has no double clicks, the second press of a quick pair on the same spot is one.
+				bool isDoubleClick = m_lastClickWindow == window && buttonEvent.time - m_lastClickTime <= DoubleClickTime &&
+					std::abs(position.X - m_lastClickPosition.X) <= DoubleClickDistance && std::abs(position.Y - m_lastClickPosition.Y) <= DoubleClickDistance;
+				m_lastClickWindow = isDoubleClick ? nullptr : window;
+				m_lastClickTime = buttonEvent.time;
+				m_lastClickPosition = position;
+				if (isDoubleClick)
+				{
+					NativeEvent doubleClickEvent;
+					doubleClickEvent.EventType = NativeEvent::Type::DoubleClick;
+					doubleClickEvent.Target = window;
+					doubleClickEvent.Position = position;
+					virtualDisplay.Post(std::move(doubleClickEvent));
+					break;
+				}
+			}
+			virtualDisplay.InjectMouseDown(window, position, button);
+			break;
+		}
+		case LeaveNotify:
+			// Grabs and moves into a nested window are not leaving.
+			if (event.xcrossing.mode == NotifyNormal && event.xcrossing.detail != NotifyInferior)
+			{
+				virtualDisplay.InjectMouseLeave(window);
+			}
+			break;
+		case KeyPress:
+		{
+			char text[32];
+			KeySym keySym = NoSymbol;
+			int length = XLookupString(&event.xkey, text, sizeof(text), &keySym, nullptr);
+
+			auto modifiers = ToModifiers(event.xkey.state);
+			auto key = ToKeyboardKey(XLookupKeysym(&event.xkey, 0));
+			if (key)
+			{
+				bool isAutoRepeat = !m_pressedKeys.insert(event.xkey.keycode).second;
+				virtualDisplay.InjectKeyDown(window, key, modifiers, isAutoRepeat);
+			}
+
+			// Like WM_CHAR: control characters included (backspace, enter, ctrl+letter), not delete.
+			std::wstring characters;
+			if (keySym >= 0x1000100 && keySym <= 0x110FFFF)
+			{
+				characters += static_cast<wchar_t>(keySym - 0x1000000);	// Unicode keysym.
+			}
+			else
+			{
+				for (int i = 0; i < length; ++i)
+				{
+					auto character = static_cast<unsigned char>(text[i]);	// Latin-1.
+					if (character != 0x7F)
+					{
+						characters += static_cast<wchar_t>(character);
+					}
+				}
+			}
+			if (!characters.empty())
+			{
+				virtualDisplay.InjectText(window, characters);
+			}
+			break;
+		}
+		case KeyRelease:
+		{
+			m_pressedKeys.erase(event.xkey.keycode);
+			auto key = ToKeyboardKey(XLookupKeysym(&event.xkey, 0));
+			if (key)
+			{
+				virtualDisplay.InjectKeyUp(window, key, ToModifiers(event.xkey.state));
+			}
+			break;
+		}
+		case FocusIn:
+		case FocusOut:
+		{
+			if (event.xfocus.mode == NotifyGrab || event.xfocus.mode == NotifyUngrab || event.xfocus.detail == NotifyPointer)
+			{
+				break;
+			}
+
+			bool focused = event.type == FocusIn;
+			if (!focused)
+			{
+				m_pressedKeys.clear();
+			}
+			if (!window->IsNested)
+			{
+				NativeEvent activatedEvent;
+				activatedEvent.EventType = NativeEvent::Type::Activated;
+				activatedEvent.Target = window;
+				activatedEvent.Flag = focused;
+				virtualDisplay.Post(std::move(activatedEvent));
+			}
+			virtualDisplay.InjectFocus(window, focused);
+			break;
+		}
+		case ClientMessage:
+			if (event.xclient.message_type == m_wmProtocols && static_cast<Atom>(event.xclient.data.l[0]) == m_wmDeleteWindow)
+			{
+				virtualDisplay.InjectClose(window);
+			}
+			break;
+		default:
+			break;
+		}
+	}
+
+	void X11Display::HandleConfigure(VirtualWindow* window, XEvent& event)
+	{
+		// Nested windows only move when Berta moves them, and the echo of a Move carries the record values.
+		if (window->IsNested)
+		{
+			return;
+		}
+
+		auto& configureEvent = event.xconfigure;
+		Point position{ configureEvent.x, configureEvent.y };
+		if (!configureEvent.send_event)
+		{
+			// Real events are relative to the window manager frame.
+			::Window child;
+			XTranslateCoordinates(m_display, configureEvent.window, m_root, 0, 0, &position.X, &position.Y, &child);
+		}
+		Size size{ static_cast<uint32_t>(configureEvent.width), static_cast<uint32_t>(configureEvent.height) };
+
+		auto& virtualDisplay = VirtualDisplay::GetInstance();
+		if (position != window->Position)
+		{
+			virtualDisplay.InjectMove(window, position);
+		}
+		if (size != window->ClientSize)
+		{
+			virtualDisplay.InjectResize(window, size);
+		}
+	}
+
+	bool X11Display::EnsureImage(NativeWindow& nativeWindow, const Size& size)
+	{
+		if (nativeWindow.Image && nativeWindow.ImageSize == size)
+		{
+			return true;
+		}
+
+		ReleaseImage(nativeWindow);
+		if (size.Width == 0 || size.Height == 0)
+		{
+			return false;
+		}
+
+		auto visual = DefaultVisual(m_display, m_screen);
+		auto depth = static_cast<unsigned int>(DefaultDepth(m_display, m_screen));
+		if (m_hasShm)
+		{
+			auto& shm = nativeWindow.Shm;
+			auto image = XShmCreateImage(m_display, visual, depth, ZPixmap, nullptr, &shm, size.Width, size.Height);
+			if (image)
+			{
+				shm.shmid = ::shmget(IPC_PRIVATE, static_cast<size_t>(image->bytes_per_line) * image->height, IPC_CREAT | 0600);
+				shm.shmaddr = shm.shmid >= 0 ? static_cast<char*>(::shmat(shm.shmid, nullptr, 0)) : reinterpret_cast<char*>(-1);
+				shm.readOnly = False;
+
+				// A remote server fails the attach asynchronously.
+				bool attached = false;
+				if (shm.shmaddr != reinterpret_cast<char*>(-1))
+				{
+					image->data = shm.shmaddr;
+					g_shmAttachFailed = false;
+					auto previousHandler = XSetErrorHandler(ShmAttachErrorHandler);
+					XShmAttach(m_display, &shm);
+					XSync(m_display, False);
+					XSetErrorHandler(previousHandler);
+					attached = !g_shmAttachFailed;
+				}
+				if (shm.shmid >= 0)
+				{
+					::shmctl(shm.shmid, IPC_RMID, nullptr);	// Freed when both sides detach.
+				}
+
+				if (attached)
+				{
+					nativeWindow.Image = image;
+					nativeWindow.ImageSize = size;
+					return true;
+				}
+
+				if (shm.shmaddr != reinterpret_cast<char*>(-1))
+				{
+					::shmdt(shm.shmaddr);
+				}
+				image->data = nullptr;
+				XDestroyImage(image);
+			}
+			shm = {};
+
+			BT_CORE_ERROR << "MIT-SHM image Failed, presenting with XPutImage." << std::endl;
+			m_hasShm = false;
+		}
+
+		auto data = static_cast<char*>(std::malloc(static_cast<size_t>(size.Width) * size.Height * sizeof(uint32_t)));	// Freed by XDestroyImage.
+		auto image = XCreateImage(m_display, visual, depth, ZPixmap, 0, data, size.Width, size.Height, 32, 0);
+		if (!image)
+		{
+			std::free(data);
+			BT_CORE_ERROR << "XCreateImage Failed." << std::endl;
+			return false;
+		}
+
+		nativeWindow.Image = image;
+		nativeWindow.ImageSize = size;
+		return true;
+	}
+
+	void X11Display::ReleaseImage(NativeWindow& nativeWindow)
+	{
+		if (!nativeWindow.Image)
+		{
+			return;
+		}
+
+		if (nativeWindow.Shm.shmaddr)
+		{
+			WaitForPuts();
+			XShmDetach(m_display, &nativeWindow.Shm);
+			::shmdt(nativeWindow.Shm.shmaddr);
+			nativeWindow.Image->data = nullptr;
+			nativeWindow.Shm = {};
+		}
+		XDestroyImage(nativeWindow.Image);
+		nativeWindow.Image = nullptr;
+		nativeWindow.ImageSize = {};
+	}
+
+	void X11Display::WaitForPuts()
+	{
+		if (!m_putsPending)
+		{
+			return;
+		}
+
+		XSync(m_display, False);
+		++m_statistics.Waits;
+		m_putsPending = false;
+		for (auto& [window, nativeWindow] : m_windows)
+		{
+			nativeWindow->PendingPuts.clear();
+		}
+	}
+
+	unsigned long X11Display::GetHandle(VirtualWindow* window) const
+	{
+		auto it = m_windows.find(window);
+		return it != m_windows.end() ? it->second->Handle : m_root;
+	}
+
+	VirtualWindow* X11Display::GetRecord(unsigned long handle) const
+	{
+		auto it = m_records.find(handle);
+		return it != m_records.end() ? it->second : nullptr;
+	}
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,121 @@
+/*
+* MIT License
+*
+* Copyright (c) 2024 Edgar Bernal (edgar.bernal@gmail.com)
+*/
+
+#ifndef BT_X11_DISPLAY_HEADER
+#define BT_X11_DISPLAY_HEADER
+
+#ifdef BT_PLATFORM_X11
+
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include "Berta/Platform/Headless/VirtualDisplay.h"
+
+// Xlib stays in X11Display.cpp, its macros (None, Bool, Status...) clash with Berta names.
+struct _XDisplay;
+struct _XGC;
+union _XEvent;
+
+namespace Berta
+{
+	class MessageLoop;
+
+	/*
+	* X11 backend of VirtualDisplay (BT_PLATFORM_X11, links X11 and Xext): every record gets an X window
+	* and X input is injected into the virtual display, so the window procedure is the headless one.
+	* Presents copy the damaged area of the root graphics into an MIT-SHM image shared with the server and
+	* put only that area, no pixels go through the connection. Without the extension (remote display)
+	* it falls back to XPutImage.
+	*/
+	class X11Display : public VirtualDisplayBackend
+	{
+	public:
+		struct Statistics
+		{
+			uint64_t ShmPuts{ 0 };
+			uint64_t Puts{ 0 };			// XPutImage fallback.
+			uint64_t Waits{ 0 };		// Present waited for the server to finish reading a previous put.
+			uint64_t Events{ 0 };
+		};
+
+		X11Display(const X11Display&) = delete;
+		X11Display& operator=(const X11Display&) = delete;
+
+		static X11Display& GetInstance()
+		{
+			static X11Display x11Display;
+			return x11Display;
+		}
+
+		// Connects to $DISPLAY and becomes the backend of the virtual display. Returns false (stays headless)
+		// when there is no display or its visual is not 32 bits BGRA.
+		bool Open(MessageLoop& messageLoop);
+		void Close();
+		bool IsOpen() const { return m_display != nullptr; }
+		bool HasShm() const { return m_hasShm; }
+
+		void Create(VirtualWindow* window) override;
+		void Destroy(VirtualWindow* window) override;
+		void Show(VirtualWindow* window) override;
+		void Move(VirtualWindow* window) override;
+		void SetParent(VirtualWindow* window) override;
+		void SetCaption(VirtualWindow* window) override;
+		void SetCursor(VirtualWindow* window) override;
+		void Capture(VirtualWindow* window, bool capture) override;
+		void Present(VirtualWindow* window, const PaintNativeHandle& source, const Rectangle& area, const Point& sourcePoint) override;
+
+		// Translates everything the server sent so far, loop thread only.
+		void ProcessEvents();
+
+		const Statistics& GetStatistics() const { return m_statistics; }
+		void ResetStatistics() { m_statistics = {}; }
+
+	private:
+		struct NativeWindow;
+
+		X11Display();
+		~X11Display();
+
+		void HandleEvent(_XEvent& event);
+		void HandleConfigure(VirtualWindow* window, _XEvent& event);
+		bool EnsureImage(NativeWindow& nativeWindow, const Size& size);
+		void ReleaseImage(NativeWindow& nativeWindow);
+		void WaitForPuts();
+		unsigned long GetHandle(VirtualWindow* window) const;
+		VirtualWindow* GetRecord(unsigned long handle) const;
+
+		_XDisplay* m_display{ nullptr };
+		int m_screen{ 0 };
+		unsigned long m_root{ 0 };
+		_XGC* m_gc{ nullptr };
+		bool m_hasShm{ false };
+		MessageLoop* m_messageLoop{ nullptr };
+		int m_connection{ -1 };
+
+		unsigned long m_wmProtocols{ 0 };
+		unsigned long m_wmDeleteWindow{ 0 };
+		unsigned long m_netWmName{ 0 };
+		unsigned long m_utf8String{ 0 };
+		unsigned long m_motifWmHints{ 0 };
+		unsigned long m_cursors[5]{};			// Created on first use, indexed by Cursor.
+
+		std::unordered_map<VirtualWindow*, std::unique_ptr<NativeWindow>> m_windows;
+		std::unordered_map<unsigned long, VirtualWindow*> m_records;
+		bool m_putsPending{ false };			// Some SHM image may still be read by the server.
+
+		std::unordered_set<unsigned int> m_pressedKeys;	// Key codes, a press of a held key is an auto repeat.
+		unsigned long m_lastClickTime{ 0 };
+		VirtualWindow* m_lastClickWindow{ nullptr };
+		Point m_lastClickPosition;
+
+		Statistics m_statistics;
+	};
+}
+
+#endif
+
+#endif
\ No newline at end of file
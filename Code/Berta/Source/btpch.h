@@ -13,6 +13,7 @@
 #include <Windows.h>
 #endif
 
+#include <cstring>
 #include <iostream>
 #include <string>
 #include <vector>
@@ -16,6 +16,96 @@
 #include <iostream>
 #include <filesystem>
 #include <Berta/GUI/ControlDrawBatch.h>
+#include <Berta/GUI/Async.h>
+#include <Berta/GUI/Coroutine.h>
+
+struct FolderEntry
+{
+	std::string Key;
+	std::string Name;
+	bool HasSubfolders{ false };
+};
+
+static std::vector<FolderEntry> ListFolders(const std::string& path, const Berta::CancellationToken& token)
+{
+	std::vector<FolderEntry> folders;
+	try
+	{
+		for (const auto& entry : std::filesystem::directory_iterator(path))
+		{
+			if (token.IsCancelled())
+				return {};
+
+			try
+			{
+				if (std::filesystem::is_directory(entry.symlink_status()) && !std::filesystem::is_symlink(entry))
+				{
+					FolderEntry folder{ entry.path().string(), entry.path().filename().string() };
+
+					auto subEntryPath = entry.path().string() + "/";
+					for (const auto& subEntry : std::filesystem::directory_iterator(subEntryPath))
+					{
+						try
+						{
+							if (std::filesystem::is_directory(subEntry.symlink_status()) && !std::filesystem::is_symlink(subEntry))
+							{
+								folder.HasSubfolders = true;
+								break;
+							}
+						}
+						catch (...)
+						{
+
+						}
+					}
+					folders.emplace_back(std::move(folder));
+				}
+			}
+			catch (...)
+			{
+
+			}
+		}
+	}
+	catch (...)
+	{
+
+	}
+	return folders;
+}
+
+struct FolderContentEntry
+{
+	std::string Name;
+	bool IsFolder{ false };
+};
+
+static std::vector<FolderContentEntry> ListFolderContents(const std::string& path)
+{
+	std::vector<FolderContentEntry> entries;
+	try
+	{
+		for (const auto& entry : std::filesystem::directory_iterator(path))
+		{
+			try
+			{
+				if (std::filesystem::is_symlink(entry))
+					continue;
+
+				entries.push_back({ entry.path().filename().string(), std::filesystem::is_directory(entry.symlink_status()) });
+			}
+			catch (...)
+			{
+
+			}
+		}
+	}
+	catch (...)
+	{
+
+	}
+	return entries;
+}
 
 class TabExplorer : public Berta::Panel
 {
@@ -45,40 +135,13 @@ public:
 		m_treeBox.GetEvents().Selected.Connect([this](const Berta::ArgTreeBoxSelection& args)
 		{
 			m_listBox.Clear();
+			++m_listingGeneration;
 
 			if (args.Items.size() > 1)
 				return;
 
 			auto& treeItem = args.Items[0];
-
-			auto path = m_treeBox.GetKeyPath(treeItem, '/') + "/";
-
-			try
-			{
-				for (const auto& entry : std::filesystem::directory_iterator(path))
-				{
-					try
-					{
-						if (std::filesystem::is_directory(entry.symlink_status()) && !std::filesystem::is_symlink(entry))
-						{
-							auto newItem = m_listBox.Append(entry.path().filename().string());
-							newItem.SetIcon(m_folderImg);
-						}
-						else if (!std::filesystem::is_directory(entry.symlink_status()) && !std::filesystem::is_symlink(entry)) {
-							auto newItem = m_listBox.Append(entry.path().filename().string());
-							newItem.SetIcon(m_fileImg);
-						}
-					}
-					catch (...)
-					{
-
-					}
-				}
-			}
-			catch (...)
-			{
-
-			}
+			ShowFolder(m_treeBox.GetKeyPath(treeItem, '/') + "/");
 		});
 
 		m_treeBox.GetEvents().Expanded.Connect([this](const Berta::ArgTreeBox& args)
@@ -88,42 +151,17 @@ public:
 
 			if (args.Item.FirstChild() && args.Item.FirstChild().GetText() == "...")
 			{
-				auto path = m_treeBox.GetKeyPath(args.Item, '/') + "/";
+				auto keyPath = m_treeBox.GetKeyPath(args.Item, '/');
 
-				auto child = args.Item.FirstChild();
-				m_treeBox.Erase(child);
-				for (const auto& entry : std::filesystem::directory_iterator(path))
+				// Enumerating big folders blocks for a while, do it in the pool and fill the tree back on the UI thread.
+				Berta::GUI::RunAsync(m_treeBox, [path = keyPath + "/"](const Berta::CancellationToken& token)
 				{
-					try
-					{
-						if (std::filesystem::is_directory(entry.symlink_status()) && !std::filesystem::is_symlink(entry))
-						{
-							auto newItem = m_treeBox.Insert(entry.path().string(), entry.path().filename().string());
-							newItem.SetIcon(m_folderImg);
-
-							auto subEntryPath = entry.path().string() + "/";
-							for (const auto& subEntry : std::filesystem::directory_iterator(subEntryPath))
-							{
-								try
-								{
-									if (std::filesystem::is_directory(subEntry.symlink_status()) && !std::filesystem::is_symlink(subEntry))
-									{
-										m_treeBox.Insert(entry.path().string() + "/...", "...");
-										break;
-									}
-								}
-								catch (...)
-								{
-
-								}
-							}
-						}
-					}
-					catch (...)
-					{
-
-					}
-				}
+					return ListFolders(path, token);
+				})
+				.Then([this, keyPath](std::vector<FolderEntry> folders)
+				{
+					InsertFolders(keyPath, folders);
+				});
 			}
 		});
 
@@ -147,50 +185,23 @@ public:
 
 			if (treeItemSelected.FirstChild() && treeItemSelected.FirstChild().GetText() == "...")
 			{
-				auto path = m_treeBox.GetKeyPath(treeItemSelected, '/') + "/";
-
-				auto child = treeItemSelected.FirstChild();
-				m_treeBox.Erase(child);
-				for (const auto& entry : std::filesystem::directory_iterator(path))
+				// Same path as expanding the item: list in the pool, then select the folder, which shows its contents.
+				Berta::GUI::RunAsync(m_treeBox, [path = pathTreeItemSelected + "/"](const Berta::CancellationToken& token)
 				{
-					try
-					{
-						if (std::filesystem::is_directory(entry.symlink_status()) && !std::filesystem::is_symlink(entry))
-						{
-							auto newItem = m_treeBox.Insert(entry.path().string(), entry.path().filename().string());
-							newItem.SetIcon(m_folderImg);
+					return ListFolders(path, token);
+				})
+				.Then([this, keyPath = pathTreeItemSelected, name = first.GetText(0)](std::vector<FolderEntry> folders)
+				{
+					InsertFolders(keyPath, folders);
 
-							auto subEntryPath = entry.path().string() + "/";
-							for (const auto& subEntry : std::filesystem::directory_iterator(subEntryPath))
-							{
-								try
-								{
-									if (std::filesystem::is_directory(subEntry.symlink_status()) && !std::filesystem::is_symlink(subEntry))
-									{
-										m_treeBox.Insert(entry.path().string() + "/...", "...");
-										break;
-									}
-								}
-								catch (...)
-								{
-
-								}
-							}
-						}
-					}
-					catch (...)
+					auto item = m_treeBox.Find(keyPath);
+					auto newSelected = m_treeBox.Find(keyPath + "/" + name);
+					if (item && newSelected)
 					{
-
+						item.Expand();
+						newSelected.Select();
 					}
-				}
-
-				newSelected = m_treeBox.Find(pathTreeItemSelected + "/" + first.GetText(0));
-				if (newSelected)
-				{
-					treeItemSelected.Expand();
-					newSelected.Select();
-					return;
-				}
+				});
 			}
 		});
 
@@ -203,6 +214,49 @@ public:
 	}
 
 private:
+	// Replaces the "..." placeholder of a tree item with its listed subfolders, unless it was already filled.
+	void InsertFolders(const std::string& keyPath, const std::vector<FolderEntry>& folders)
+	{
+		auto item = m_treeBox.Find(keyPath);
+		if (!item || !item.FirstChild() || item.FirstChild().GetText() != "...")
+			return;
+
+		Berta::ControlDrawBatch controlBatch(m_treeBox);
+		auto child = item.FirstChild();
+		m_treeBox.Erase(child);
+		for (auto& folder : folders)
+		{
+			auto newItem = m_treeBox.Insert(folder.Key, folder.Name);
+			newItem.SetIcon(m_folderImg);
+
+			if (folder.HasSubfolders)
+			{
+				m_treeBox.Insert(folder.Key + "/...", "...");
+			}
+		}
+	}
+
+	// Owned by this panel's window: it stops at the next co_await if the panel is destroyed.
+	Berta::Task<> ShowFolder(std::string path)
+	{
+		auto generation = m_listingGeneration;
+		auto entries = co_await Berta::Background([path]()
+		{
+			return ListFolderContents(path);
+		});
+
+		co_await Berta::UiThread();
+		if (generation != m_listingGeneration)
+			co_return; // Another folder was selected meanwhile.
+
+		Berta::ControlDrawBatch controlBatch(m_listBox);
+		for (auto& entry : entries)
+		{
+			auto newItem = m_listBox.Append(entry.Name);
+			newItem.SetIcon(entry.IsFolder ? m_folderImg : m_fileImg);
+		}
+	}
+
 	Berta::TreeBox m_treeBox{ *this };
 	Berta::ListBox m_listBox{ *this };
 
@@ -212,6 +266,7 @@ private:
 	Berta::Image m_hardDriveImg{ "..\\..\\Resources\\Icons\\Hard drive 3 128.png" };
 
 	Berta::Layout m_layout;
+	uint32_t m_listingGeneration{ 0 };
 };
 
 class TabImages : public Berta::Panel